@@ -28,6 +28,9 @@
 #include "crlibm_private.h"
 #include "triple-double.h"
 #include "asincos.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
 
 static inline void p0_quick(double *p_resh, double *p_resm, double x, int32_t xhi) {
 double p_x_0_pow2h, p_x_0_pow2m;
@@ -579,7 +582,7 @@ double asin_rn(double x) {
 
     /* Rounding test */
 
-    if(asinh == (asinh + (asinm * RNROUNDCST))) 
+    if(QUICK_PHASE && asinh == (asinh + (asinm * RNROUNDCST))) 
       return asinh;
 
     /* Rounding test failed, launch accurate phase */
@@ -628,7 +631,7 @@ double asin_rn(double x) {
 
     /* Rounding test */
 
-    if(asinh == (asinh + (asinm * RNROUNDCST))) 
+    if(QUICK_PHASE && asinh == (asinh + (asinm * RNROUNDCST))) 
       return sign * asinh;
 
     /* Rounding test failed, launch accurate phase */
@@ -672,7 +675,7 @@ double asin_rn(double x) {
 
   /* Rounding test */
   
-  if(asinh == (asinh + (asinm * RNROUNDCST))) 
+  if(QUICK_PHASE && asinh == (asinh + (asinm * RNROUNDCST))) 
     return sign * asinh;
   
   /* Rounding test failed, launch accurate phase */
@@ -1467,7 +1470,7 @@ double acos_rn(double x) {
 
     /* Rounding test */
 
-    if(acosh == (acosh + (acosm * RNROUNDCST))) 
+    if(QUICK_PHASE && acosh == (acosh + (acosm * RNROUNDCST))) 
       return acosh;
 
     /* Rounding test failed, launch accurate phase */
@@ -1529,7 +1532,7 @@ double acos_rn(double x) {
 
     /* Rounding test */
 
-    if(acosh == (acosh + (acosm * RNROUNDCST))) 
+    if(QUICK_PHASE && acosh == (acosh + (acosm * RNROUNDCST))) 
       return acosh;
 
     /* Rounding test failed, launch accurate phase */
@@ -1591,7 +1594,7 @@ double acos_rn(double x) {
 
   /* Rounding test */
   
-  if(acosh == (acosh + (acosm * RNROUNDCST))) 
+  if(QUICK_PHASE && acosh == (acosh + (acosm * RNROUNDCST))) 
     return acosh;
   
   /* Rounding test failed, launch accurate phase */
@@ -2321,7 +2324,7 @@ double acospi_rn(double x) {
 
     /* Rounding test */
 
-    if(acosh == (acosh + (acosm * RNROUNDCST))) 
+    if(QUICK_PHASE && acosh == (acosh + (acosm * RNROUNDCST))) 
       return acosh;
 
     /* Rounding test failed, launch accurate phase */
@@ -2383,7 +2386,7 @@ double acospi_rn(double x) {
 
     /* Rounding test */
 
-    if(acosh == (acosh + (acosm * RNROUNDCST))) 
+    if(QUICK_PHASE && acosh == (acosh + (acosm * RNROUNDCST))) 
       return acosh;
 
     /* Rounding test failed, launch accurate phase */
@@ -2449,7 +2452,7 @@ double acospi_rn(double x) {
 
   /* Rounding test */
   
-  if(acosh == (acosh + (acosm * RNROUNDCST))) 
+  if(QUICK_PHASE && acosh == (acosh + (acosm * RNROUNDCST))) 
     return acosh;
   
   /* Rounding test failed, launch accurate phase */
@@ -3130,7 +3133,7 @@ double asinpi_rn(double x) {
 
       Mul122(&xPih,&xPim,x,RECPRPIH,RECPRPIM);
 
-      if(xPih == (xPih + (xPim * RNROUNDCSTASINPI))) 
+      if(QUICK_PHASE && xPih == (xPih + (xPim * RNROUNDCSTASINPI))) 
 	return xPih;
       
       Mul133(&xPihover,&xPimover,&xPilover,x,RECPRPIH,RECPRPIM,RECPRPIL);
@@ -3305,7 +3308,7 @@ double asinpi_rn(double x) {
 
     /* Rounding test */
 
-    if(asinpih == (asinpih + (asinpim * RNROUNDCST))) 
+    if(QUICK_PHASE && asinpih == (asinpih + (asinpim * RNROUNDCST))) 
       return asinpih;
 
     /* Rounding test failed, launch accurate phase */
@@ -3359,7 +3362,7 @@ double asinpi_rn(double x) {
 
     /* Rounding test */
 
-    if(asinpih == (asinpih + (asinpim * RNROUNDCST))) 
+    if(QUICK_PHASE && asinpih == (asinpih + (asinpim * RNROUNDCST))) 
       return sign * asinpih;
 
     /* Rounding test failed, launch accurate phase */
@@ -3406,7 +3409,7 @@ double asinpi_rn(double x) {
 
   /* Rounding test */
   
-  if(asinpih == (asinpih + (asinpim * RNROUNDCST))) 
+  if(QUICK_PHASE && asinpih == (asinpih + (asinpim * RNROUNDCST))) 
     return sign * asinpih;
   
   /* Rounding test failed, launch accurate phase */
@@ -3439,7 +3442,6 @@ double asinpi_rd(double x) {
   double p9h, p9m, p9l, sqrh, sqrm, sqrl;
   double t1h, t1m, t1l;
   double t2h, t2m, t2l;
-  double asinpi;
   double xabs;
   double xScaled;
   double xPih, xPim, xPil;
@@ -3738,9 +3740,11 @@ double asinpi_rd(double x) {
 
     /* Final rounding */    
 
-    RoundDownwards3(&asinpi,asinpih,asinpim,asinpil);
+    asinpih *= sign;
+    asinpim *= sign;
+    asinpil *= sign;
 
-    return sign * asinpi;
+    ReturnRoundDownwards3(asinpih,asinpim,asinpil);
 
   }
 
@@ -3777,9 +3781,11 @@ double asinpi_rd(double x) {
 
   /* Final rounding */
   
-  RoundDownwards3(&asinpi,asinpih,asinpim,asinpil);
-  
-  return sign * asinpi;
+  asinpih *= sign;
+  asinpim *= sign;
+  asinpil *= sign;
+
+  ReturnRoundDownwards3(asinpih,asinpim,asinpil);
   
 }
 
@@ -3793,7 +3799,6 @@ double asinpi_ru(double x) {
   double p9h, p9m, p9l, sqrh, sqrm, sqrl;
   double t1h, t1m, t1l;
   double t2h, t2m, t2l;
-  double asinpi;
   double xabs;
   double xScaled;
   double xPih, xPim, xPil;
@@ -4091,9 +4096,11 @@ double asinpi_ru(double x) {
 
     /* Final rounding */    
 
-    RoundUpwards3(&asinpi,asinpih,asinpim,asinpil);
+    asinpih *= sign;
+    asinpim *= sign;
+    asinpil *= sign;
 
-    return sign * asinpi;
+    ReturnRoundUpwards3(asinpih,asinpim,asinpil);
 
   }
 
@@ -4130,9 +4137,11 @@ double asinpi_ru(double x) {
 
   /* Final rounding */
   
-  RoundUpwards3(&asinpi,asinpih,asinpim,asinpil);
-  
-  return sign * asinpi;
+  asinpih *= sign;
+  asinpim *= sign;
+  asinpil *= sign;
+
+  ReturnRoundUpwards3(asinpih,asinpim,asinpil);
   
 }
 
@@ -4486,3 +4495,166 @@ double asinpi_rz(double x) {
   
 }
 
+
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Quick phase of asin for one bound of an interval. For |x| below
+   ASINSIMPLEBOUND and for |x| >= 1 we set asinh = asinm = 0, so that
+   the rounding test fails and the bound is left to asin_rd or
+   asin_ru, which handle these cases without any polynomial. */
+static void asin_quick_bound(double *asinh, double *asinm, double x) {
+  db_number xdb, zdb;
+  double sign, z, zp, xabs;
+  double p9h, p9m, sqrh, sqrm, t1h, t1m;
+  int index;
+
+  zdb.d = 1.0 + x * x;
+  xdb.d = x;
+  xabs = ABS(x);
+  xdb.i[HI] &= 0x7fffffff;
+
+  if ((xdb.i[HI] < ASINSIMPLEBOUND) || (xdb.i[HI] >= 0x3ff00000)) {
+    *asinh = 0.0;
+    *asinm = 0.0;
+    return;
+  }
+
+  index = (0x000f0000 & zdb.i[HI]) >> 16;
+
+  if (index == 0) {
+    p0_quick(asinh, asinm, x, xdb.i[HI]);
+    return;
+  }
+
+  sign = 1.0;
+  if (x < 0.0) sign = -sign;
+
+  index--;
+  if ((index & 0x8) != 0) {
+    z = xabs - MI_9;
+    zp = 2.0 * (1.0 - xabs);
+    p9_quick(&p9h, &p9m, z);
+    p9h = -p9h;
+    p9m = -p9m;
+    sqrt12_64_unfiltered(&sqrh,&sqrm,zp);
+    Mul22(&t1h,&t1m,sqrh,sqrm,p9h,p9m);
+    Add22(asinh,asinm,PIHALFH,PIHALFM,t1h,t1m);
+  } else {
+    z = xabs - mi_i;
+    p_quick(asinh, asinm, z, index);
+  }
+
+  *asinh *= sign;
+  *asinm *= sign;
+}
+
+
+/* Same as above for acos, with the bound ACOSSIMPLEBOUND */
+static void acos_quick_bound(double *acosh, double *acosm, double x) {
+  db_number xdb, zdb;
+  double z, zp, xabs, asinh, asinm;
+  double p9h, p9m, sqrh, sqrm, t1h, t1m;
+  int index;
+
+  zdb.d = 1.0 + x * x;
+  xdb.d = x;
+  xabs = ABS(x);
+  xdb.i[HI] &= 0x7fffffff;
+
+  if ((xdb.i[HI] < ACOSSIMPLEBOUND) || (xdb.i[HI] >= 0x3ff00000)) {
+    *acosh = 0.0;
+    *acosm = 0.0;
+    return;
+  }
+
+  index = (0x000f0000 & zdb.i[HI]) >> 16;
+
+  if (index == 0) {
+    p0_quick(&asinh, &asinm, x, xdb.i[HI]);
+    Add22(acosh,acosm,PIHALFH,PIHALFM,-asinh,-asinm);
+    return;
+  }
+
+  index--;
+  if ((index & 0x8) != 0) {
+    z = xabs - MI_9;
+    zp = 2.0 * (1.0 - xabs);
+    p9_quick(&p9h, &p9m, z);
+    sqrt12_64_unfiltered(&sqrh,&sqrm,zp);
+    Mul22(&t1h,&t1m,sqrh,sqrm,p9h,p9m);
+    if (x > 0.0) {
+      *acosh = t1h;
+      *acosm = t1m;
+    } else {
+      /* arccos(-x) = Pi - arccos(x) */
+      Add22(acosh,acosm,PIH,PIM,-t1h,-t1m);
+    }
+    return;
+  }
+
+  z = xabs - mi_i;
+  p_quick(&asinh, &asinm, z, index);
+  if (x > 0.0) {
+    asinh = - asinh;
+    asinm = - asinm;
+  }
+  Add22Cond(acosh,acosm,PIHALFH,PIHALFM,asinh,asinm);
+}
+
+
+interval j_asin(interval x)
+{
+  interval res;
+  double x_inf, x_sup, asinh_inf, asinm_inf, asinh_sup, asinm_sup;
+  double res_inf, res_sup;
+  int roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+
+  /* Intersect with the domain [-1, 1] */
+  if (!(x_inf<=x_sup) || (x_sup < -1.0) || (x_inf > 1.0)) RETURN_EMPTY_INTERVAL;
+  if (x_inf < -1.0) x_inf = -1.0;
+  if (x_sup > 1.0) x_sup = 1.0;
+
+  asin_quick_bound(&asinh_inf, &asinm_inf, x_inf);
+  asin_quick_bound(&asinh_sup, &asinm_sup, x_sup);
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, asinh_inf, asinm_inf, res_sup, asinh_sup, asinm_sup, RDROUNDCST, RDROUNDCST);
+  if ((roundable & 1) == 0) res_inf = asin_rd(x_inf);
+  if ((roundable & 2) == 0) res_sup = asin_ru(x_sup);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+
+
+interval j_acos(interval x)
+{
+  interval res;
+  double x_inf, x_sup, acosh_inf, acosm_inf, acosh_sup, acosm_sup;
+  double res_inf, res_sup;
+  int roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+
+  if (!(x_inf<=x_sup) || (x_sup < -1.0) || (x_inf > 1.0)) RETURN_EMPTY_INTERVAL;
+  if (x_inf < -1.0) x_inf = -1.0;
+  if (x_sup > 1.0) x_sup = 1.0;
+
+  /* acos is decreasing: the lower bound comes from x_sup */
+  acos_quick_bound(&acosh_sup, &acosm_sup, x_sup);
+  acos_quick_bound(&acosh_inf, &acosm_inf, x_inf);
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, acosh_sup, acosm_sup, res_sup, acosh_inf, acosm_inf, RDROUNDCST, RDROUNDCST);
+  if ((roundable & 1) == 0) res_inf = acos_rd(x_sup);
+  if ((roundable & 2) == 0) res_sup = acos_ru(x_inf);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "crlibm_private.h"
+#include "triple-double.h"
 #include "atan_accurate.h"
 #include "atan_fast.h"
 
@@ -77,6 +78,7 @@ static void scs_atan(scs_ptr res_scs, scs_ptr x){
   double test;
   int k, i=31;
 
+  SLOW_PATH(CRLIBM_SLOW_SCS_ATAN);
   
   scs_get_d(&db.d, x);  
   
@@ -339,3 +341,64 @@ double scs_atanpi_ru(double x){
   }
 }
 
+
+/* Functions atan_td and atan_dd, see crlibm.h
+
+   The accurate phase, its SCS result being split into a
+   triple-double, with a relative error below 2^-120. Beyond 2^54,
+   atan(x) = Pi/2 - 1/x up to 1/(3x^3), 2^-162 relative to the result;
+   below 2^-60, atan(x) = x - x^3/3 up to x^5/5. */
+
+static const double PIO2_TD[3] = {
+  1.57079632679489655799898173427209258079528808593750e+00,
+  6.12323399573676603586882014729198302312846062338790e-17,
+ -1.49738490485916983294350817710599200835275047616952e-33
+};
+void atan_td(double *resh, double *resm, double *resl, double x){
+  scs_t sc1, res_scs;
+  db_number xdb;
+  double r, rl, ph, pl;
+  int absxhi;
+
+  xdb.d = x;
+  absxhi = xdb.i[HI] & 0x7fffffff;
+  if (absxhi > 0x7ff00000 || (absxhi == 0x7ff00000 && xdb.i[LO] != 0)) {
+    *resh = x+x;		/* NaN */
+    *resm = 0;
+    *resl = 0;
+    return;
+  }
+  if (x < 0) {
+    atan_td(resh, resm, resl, -x);
+    *resh = -*resh;
+    *resm = -*resm;
+    *resl = -*resl;
+    return;
+  }
+  if (absxhi >= 0x43500000) {	/* x >= 2^54 */
+    r = 1.0/x;
+    rl = 0;
+    if (absxhi < 0x46300000) {	/* x < 2^100: low part of 1/x */
+      Mul12(&ph, &pl, r, x);
+      rl = ((1.0 - ph) - pl)/x;
+    }
+    Add33(resh, resm, resl, PIO2_TD[0], PIO2_TD[1], PIO2_TD[2], -r, -rl, 0.0);
+    return;
+  }
+  if (absxhi < 0x3c300000) {	/* x < 2^-60 */
+    *resh = x;
+    *resm = -x*x*x*(1.0/3.0);
+    *resl = 0;
+    return;
+  }
+  scs_set_d(sc1, x);
+  scs_atan(res_scs, sc1);
+  scs_get_td(resh, resm, resl, res_scs);
+}
+
+void atan_dd(double *resh, double *resl, double x){
+  double resm, resll;
+
+  atan_td(resh, &resm, &resll, x);
+  *resl = resm + resll;
+}
@@ -26,6 +26,10 @@
 #include "crlibm.h"
 #include "crlibm_private.h"
 #include "atan_fast.h"
+#include "vector_abi.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
 
 extern double scs_atan_rn(double); 
 extern double scs_atan_rd(double); 
@@ -184,7 +188,7 @@ extern double atan_rn(double x) {
   
   atan_quick(&atanhi, &atanlo,&index_of_e , x_db.d);
   
-  if (atanhi == (atanhi + (atanlo*rncst[index_of_e]))) 
+  if (QUICK_PHASE && atanhi == (atanhi + (atanlo*rncst[index_of_e]))) 
     return sign*atanhi;
   else
     {
@@ -329,6 +333,15 @@ extern double atan_rz(double x) {
 }
 
 
+/* Round to odd, see RETURN_RO_FROM_RZ in crlibm_private.h: the
+   arctangent is exact only for x=0 (atan(+/-Inf) is Pi/2 rounded) */
+extern double atan_ro(double x) {
+  if (x == 0.0)
+    return x;
+  RETURN_RO_FROM_RZ(atan_rz(x));
+}
+
+
 
 
 /*************************************************************
@@ -371,7 +384,7 @@ extern double atanpi_rn(double x) {
   atan_quick(&atanhi, &atanlo,&index_of_e , x_db.d);
   Mul22(&atanpihi,&atanpilo, INVPIH, INVPIL, atanhi,atanlo);
 
-  if (atanpihi == (atanpihi + (atanpilo*rncst[index_of_e]))) 
+  if (QUICK_PHASE && atanpihi == (atanpihi + (atanpilo*rncst[index_of_e]))) 
     return sign*atanpihi;
   else
     /* more accuracy is needed , lauch accurate phase */ 
@@ -504,3 +517,317 @@ extern double atanpi_rz(double x) {
     return atanpi_ru(x);
 }
 
+
+
+
+#ifdef BUILD_VECTOR_ABI
+/*************************************************************
+ *************************************************************
+ *               VECTOR VERSIONS                             *
+ *************************************************************
+ *************************************************************/
+
+/* The lane kernels of the vector variants, see vector_abi.h: the
+   quick phase of atan_quick on |x|, where both the reduced and the
+   unreduced evaluations are computed and selected lane-wise. The
+   binary search of the interval is replaced by the count of the a(i)
+   below x, which gives the same i. The lanes which are special or
+   fail the rounding test go through the scalar function. */
+
+#define ATAN_LANES(name, vd, vl, n)                                     \
+VECTOR_KERNEL void name(double *res, const double *x, int mode) {       \
+  vd xv, xa, bi, atanbhi, atanblo, tmphi, tmplo, x0hi, x0lo, x1hi, x1lo; \
+  vd xmBihi, xmBilo, bighi, biglo, Xredhi, Xredlo, Xred2, q, x2;        \
+  vd atanlolo, tmphi2, tmplo2, atanhi, atanlo, ahi, alo, cst;           \
+  vl xb, sign, i, reduce, big, roundable, fail;                         \
+  int j, l;                                                             \
+                                                                        \
+  memcpy(&xv, x, sizeof(xv));                                           \
+  xb = ((vl) xv) & ULL(7fffffffffffffff);                               \
+  sign = ((vl) xv) & ULL(8000000000000000);                             \
+  xa = (vd) xb;                                                         \
+                                                                        \
+  /* compute i so that a[i] < x < a[i+1], or i=61 for x > b[61] */      \
+  i = VSplat(vl, 0);                                                    \
+  for(j=1; j<nb_of_ai; j++)                                             \
+    i -= (xa >= arctan_table[j][A].d);                                  \
+  big = (xa > arctan_table[61][B].d);                                   \
+  i = VSelect(big, VSplat(vl, 61), i);                                  \
+  VECTOR_UNROLL                                                         \
+  for(l=0; l<n; l++) {                                                  \
+    bi[l] = arctan_table[i[l]][B].d;                                    \
+    atanbhi[l] = arctan_table[i[l]][ATAN_BHI].d;                        \
+    atanblo[l] = arctan_table[i[l]][ATAN_BLO].d;                        \
+  }                                                                     \
+  VAdd12(bighi, biglo, xa, -bi);                                        \
+  xmBihi = VSelect(big, bighi, xa - bi);                                \
+  xmBilo = VSelect(big, biglo, VSplat(vd, 0.0));                        \
+                                                                        \
+  VMul12(tmphi, tmplo, xa, bi);                                         \
+  VAdd22(x0hi, x0lo, tmphi, tmplo, VSplat(vd, 1.0), VSplat(vd, 0.0));   \
+  VAdd22(x1hi, x1lo, VSplat(vd, 1.0), VSplat(vd, 0.0), tmphi, tmplo);   \
+  x0hi = VSelect(xa > 1.0, x0hi, x1hi);                                   \
+  x0lo = VSelect(xa > 1.0, x0lo, x1lo);                                   \
+                                                                        \
+  VDiv22(Xredhi, Xredlo, xmBihi, xmBilo, x0hi, x0lo);                   \
+                                                                        \
+  Xred2 = Xredhi*Xredhi;                                                \
+  q = Xred2*(coef_poly[3]+Xred2*                                        \
+             (coef_poly[2]+Xred2*                                       \
+              (coef_poly[1]+Xred2*                                      \
+               coef_poly[0]))) ;                                        \
+  atanlolo = (Xredlo + atanblo);                                        \
+  atanlolo += Xredhi*q;                                                 \
+  VAdd12(tmphi2, tmplo2, atanbhi, Xredhi);                              \
+  VAdd12(atanhi, atanlo, tmphi2, (tmplo2+atanlolo));                    \
+                                                                        \
+  /* no reduction needed */                                             \
+  x2 = xa*xa;                                                           \
+  q = x2*(coef_poly[3]+x2*                                              \
+          (coef_poly[2]+x2*                                             \
+           (coef_poly[1]+x2*                                            \
+            coef_poly[0]))) ;                                           \
+  VAdd12(ahi, alo, xa, xa*q);                                           \
+                                                                        \
+  reduce = (xa > MIN_REDUCTION_NEEDED);                                 \
+  atanhi = VSelect(reduce, atanhi, ahi);                                \
+  atanlo = VSelect(reduce, atanlo, alo);                                \
+  atanhi = (vd) (((vl) atanhi) ^ sign);                                 \
+  atanlo = (vd) (((vl) atanlo) ^ sign);                                 \
+                                                                        \
+  if(mode==CRLIBM_RN)                                                   \
+    cst = VSelect(reduce, VSelect(i<10, VSplat(vd, rncst[0]), VSplat(vd, rncst[1])), \
+                  VSplat(vd, rncst[2]));                                \
+  else                                                                  \
+    cst = VSelect(reduce, VSelect(i<10, VSplat(vd, epsilon[0]), VSplat(vd, epsilon[1])), \
+                  VSplat(vd, epsilon[2]));                              \
+  VTestAndCopy(roundable, atanhi, atanlo, cst, mode, vd, vl);           \
+  memcpy(res, &atanhi, sizeof(atanhi));                                 \
+                                                                        \
+  /* x >= 2^54, Inf or NaN, and x < 2^-27 are special */                \
+  fail = ~roundable                                                     \
+    | (xb >= (long long int) ULL(4350000000000000))                     \
+    | (xb < (long long int) ULL(3E40000000000000));                     \
+  for(l=0; l<n; l++) {                                                  \
+    if(fail[l]) {                                                       \
+      if(mode==CRLIBM_RN)      res[l] = atan_rn(x[l]);                  \
+      else if(mode==CRLIBM_RU) res[l] = atan_ru(x[l]);                  \
+      else if(mode==CRLIBM_RD) res[l] = atan_rd(x[l]);                  \
+      else                     res[l] = atan_rz(x[l]);                  \
+    }                                                                   \
+  }                                                                     \
+}
+
+VECTOR_LANE_KERNELS(ATAN_LANES, atan_lanes)
+
+VECTOR_ABI_VARIANTS(atan_rn, atan_lanes, CRLIBM_RN)
+VECTOR_ABI_VARIANTS(atan_ru, atan_lanes, CRLIBM_RU)
+VECTOR_ABI_VARIANTS(atan_rd, atan_lanes, CRLIBM_RD)
+VECTOR_ABI_VARIANTS(atan_rz, atan_lanes, CRLIBM_RZ)
+
+#endif /* BUILD_VECTOR_ABI */
+
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Quick phase of atan for one bound of an interval, with the sign
+   applied. Outside [2^-27, 2^54) and for Inf or NaN we set
+   atanhi = atanlo = 0, so that the rounding test fails and the bound
+   is left to atan_rd or atan_ru. */
+static void atan_quick_bound(double *atanhi, double *atanlo, double *maxepsilon, double x) {
+  db_number x_db;
+  int absxhi, index_of_e;
+
+  x_db.d = x;
+  absxhi = x_db.i[HI] & 0x7fffffff;
+  *maxepsilon = epsilon[0];
+  if ((absxhi >= 0x43500000) || (absxhi < 0x3E400000)) {
+    *atanhi = 0.0;
+    *atanlo = 0.0;
+    return;
+  }
+  x_db.i[HI] = absxhi;
+  atan_quick(atanhi, atanlo, &index_of_e, x_db.d);
+  *maxepsilon = epsilon[index_of_e];
+  if (x < 0) {
+    *atanhi = -*atanhi;
+    *atanlo = -*atanlo;
+  }
+}
+
+
+interval j_atan(interval x)
+{
+  interval res;
+  double x_inf, x_sup, atanhi_inf, atanlo_inf, atanhi_sup, atanlo_sup;
+  double eps_inf, eps_sup, res_inf, res_sup;
+  int roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+  if (!(x_inf<=x_sup)) RETURN_EMPTY_INTERVAL;
+
+  /* atan is increasing: evaluate both bounds, then launch the
+     accurate phase only for the ones whose rounding test failed */
+  atan_quick_bound(&atanhi_inf, &atanlo_inf, &eps_inf, x_inf);
+  atan_quick_bound(&atanhi_sup, &atanlo_sup, &eps_sup, x_sup);
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, atanhi_inf, atanlo_inf, res_sup, atanhi_sup, atanlo_sup, eps_inf, eps_sup);
+  if ((roundable & 1) == 0) res_inf = atan_rd(x_inf);
+  if ((roundable & 2) == 0) res_sup = atan_ru(x_sup);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
+
+
+
+
+/*************************************************************
+ *************************************************************
+ *               BINARY32 VERSIONS                           *
+ *************************************************************
+ *************************************************************/
+
+/* atanf, for a float x, in one step in double precision: the
+   argument reduction of atan_quick, where Xred = (|x|-b(i)) /
+   (1+|x|b(i)) is computed in double precision with a relative error
+   of three roundings, and atan(|x|) = atan(b(i)) + Xred + Xred q(Xred^2).
+   As |Xred| < 2^-6.3 < atan(b(i))/2, the result has a relative error
+   below 2^-49 (see TEST_AND_COPY_FLOAT), as well as x + x q(x^2) when
+   no reduction is needed.
+
+   The kernels return 0 for Inf and NaN, so that the rounding test
+   fails and the double function is called. */
+
+static inline double atanf_quick(double x) {
+  db_number xdb;
+  double xa, bi, Xred, Xred2, q, res;
+  int i;
+
+  xdb.d = x;
+  if((xdb.i[HI] & 0x7fffffff) >= 0x7ff00000)
+    return 0.0;
+  xa = (x < 0) ? -x : x;
+
+  if (xa > MIN_REDUCTION_NEEDED) {
+    if (xa > arctan_table[61][B].d)
+      i=61;
+    else {
+      /* compute i so that a[i] < x < a[i+1] */
+      i=31;
+      if (xa < arctan_table[i][A].d) i-= 16;
+      else i+=16;
+      if (xa < arctan_table[i][A].d) i-= 8;
+      else i+= 8;
+      if (xa < arctan_table[i][A].d) i-= 4;
+      else i+= 4;
+      if (xa < arctan_table[i][A].d) i-= 2;
+      else i+= 2;
+      if (xa < arctan_table[i][A].d) i-= 1;
+      else i+= 1;
+      if (xa < arctan_table[i][A].d) i-= 1;
+    }
+    bi = arctan_table[i][B].d;
+    Xred = (xa - bi) / (1.0 + xa * bi);
+    Xred2 = Xred*Xred;
+    q = Xred2*(coef_poly[3]+Xred2*
+               (coef_poly[2]+Xred2*
+                (coef_poly[1]+Xred2*
+                 coef_poly[0]))) ;
+    res = arctan_table[i][ATAN_BHI].d + (arctan_table[i][ATAN_BLO].d + (Xred + Xred*q));
+  }
+  else {
+    Xred2 = xa*xa;
+    q = Xred2*(coef_poly[3]+Xred2*
+               (coef_poly[2]+Xred2*
+                (coef_poly[1]+Xred2*
+                 coef_poly[0]))) ;
+    res = xa + xa*q;
+  }
+  return (x < 0) ? -res : res;
+}
+
+
+#ifdef BUILD_VECTOR_ABI
+/* The same on four lanes, for the batch versions: the binary search
+   of atanf_quick, with one gather per step */
+VECTOR_KERNEL void atanf_lanes_4(v4df *res, const v4df *xp) {
+  v4df x, xa, ai, bi, atanbhi, atanblo, Xred, Xred2, q, x2, r, r0;
+  v4di sign, i;
+  int step, l;
+
+  x = *xp;
+  xa = VAbs(x, v4di);
+  sign = ((v4di) x) & ULL(8000000000000000);
+
+  i = VSplat(v4di, 31);
+  for(step=16; step>=1; step>>=1) {
+    VECTOR_UNROLL
+    for(l=0; l<4; l++)
+      ai[l] = arctan_table[i[l]][A].d;
+    i += step - ((xa < ai) & (2*step));
+  }
+  VECTOR_UNROLL
+  for(l=0; l<4; l++)
+    ai[l] = arctan_table[i[l]][A].d;
+  i += (xa < ai);
+  i = VSelect(xa > arctan_table[61][B].d, VSplat(v4di, 61), i);
+  VECTOR_UNROLL
+  for(l=0; l<4; l++) {
+    bi[l] = arctan_table[i[l]][B].d;
+    atanbhi[l] = arctan_table[i[l]][ATAN_BHI].d;
+    atanblo[l] = arctan_table[i[l]][ATAN_BLO].d;
+  }
+
+  Xred = (xa - bi) / (1.0 + xa * bi);
+  Xred2 = Xred*Xred;
+  q = Xred2*(coef_poly[3]+Xred2*
+             (coef_poly[2]+Xred2*
+              (coef_poly[1]+Xred2*
+               coef_poly[0]))) ;
+  r = atanbhi + (atanblo + (Xred + Xred*q));
+
+  /* no reduction needed */
+  x2 = xa*xa;
+  q = x2*(coef_poly[3]+x2*
+          (coef_poly[2]+x2*
+           (coef_poly[1]+x2*
+            coef_poly[0]))) ;
+  r0 = xa + xa*q;
+
+  r = VSelect(xa > MIN_REDUCTION_NEEDED, r, r0);
+  r = (v4df) (((v4di) r) ^ sign);
+  *res = VSelect(((v4di) xa) < (long long int) ULL(7ff0000000000000), r, VSplat(v4df, 0.0));
+}
+#endif /* BUILD_VECTOR_ABI */
+
+
+static inline float atanf_round(float x, int mode) {
+  float res;
+  int roundable;
+
+  TEST_AND_COPY_FLOAT(roundable, res, atanf_quick(x), mode);
+  if(roundable)
+    return res;
+  return float_from_ro(atan_ro(x), mode);
+}
+
+float atanf_rn(float x){ return atanf_round(x, CRLIBM_RN); }
+float atanf_rd(float x){ return atanf_round(x, CRLIBM_RD); }
+float atanf_ru(float x){ return atanf_round(x, CRLIBM_RU); }
+float atanf_rz(float x){ return atanf_round(x, CRLIBM_RZ); }
+
+#ifdef BUILD_VECTOR_ABI
+VECTOR_FLOAT_BATCH(atanf_rn, atanf_lanes_4, CRLIBM_RN)
+VECTOR_FLOAT_BATCH(atanf_rd, atanf_lanes_4, CRLIBM_RD)
+VECTOR_FLOAT_BATCH(atanf_ru, atanf_lanes_4, CRLIBM_RU)
+VECTOR_FLOAT_BATCH(atanf_rz, atanf_lanes_4, CRLIBM_RZ)
+#else
+FLOAT_BATCH(atanf_rn)
+FLOAT_BATCH(atanf_rd)
+FLOAT_BATCH(atanf_ru)
+FLOAT_BATCH(atanf_rz)
+#endif
@@ -24,6 +24,12 @@
 extern "C" {
 #endif
 
+/* When the library is configured with --enable-latency-histograms,
+   its sources see the functions under other names, see latency.h */
+#ifdef CRLIBM_LATENCY_RAW_NAMES
+#include "latency.h"
+#endif
+
 
 /* An init function which sets FPU flags when needed (mostly on Intel
    architectures with default double extended) */
@@ -33,41 +39,94 @@ extern unsigned long long crlibm_init(void);
    architectures with default double extended) */
 extern  void crlibm_exit(unsigned long long);
 
+/* Only in the library configured with --enable-latency-histograms:
+   one call out of period (64 by default) of each thread is timed, and
+   the latency histograms of all the threads are written as CSV, by
+   function and exit path, to filename (stdout if NULL). The dump
+   returns 0, or -1 if the file cannot be written. */
+extern void crlibm_latency_sampling(unsigned int period);
+extern int crlibm_latency_dump(const char *filename);
+
+/* Only in the library configured with --enable-slow-path-capture: the
+   last calls of each thread which took one of these slow paths are
+   kept in a ring buffer of the thread. crlibm_slow_path_read copies up
+   to n of them, those of all the threads, to calls and returns their
+   number; crlibm_slow_path_dump writes them to filename (stdout if
+   NULL) as a trace for tests/crlibm_mix_bench, and returns 0, or -1 if
+   the file cannot be written. */
+#define CRLIBM_SLOW_ACCURATE  1 /* the accurate phase */
+#define CRLIBM_SLOW_SCS_RR    2 /* the SCS argument reduction of sin, cos, tan */
+#define CRLIBM_SLOW_SCS_ATAN  4 /* the SCS arctangent */
+#define CRLIBM_SLOW_POW_EXACT 8 /* the check of the exact cases of pow */
+typedef struct {
+  const char *function;  /* exp_rn etc */
+  double x, y;           /* the arguments, y for pow_rn only */
+  int paths;             /* CRLIBM_SLOW_ACCURATE etc */
+} crlibm_slow_call;
+extern int crlibm_slow_path_read(crlibm_slow_call *calls, int n);
+extern int crlibm_slow_path_dump(const char *filename);
+
+
+/* The exponential, logarithm, sine, cosine, tangent and arctangent
+   are declared with "#pragma omp declare simd" when compiling with
+   OpenMP (or with CRLIBM_VECTOR_ABI defined, e.g. with gcc
+   -fopenmp-simd) on x86-64. A loop calling them in a "#pragma omp
+   simd" region may then be vectorized against the vector variants
+   exported by the library (_ZGVdN4v_exp_rn etc, see vector_abi.h),
+   which are correctly rounded as well. Define CRLIBM_NO_VECTOR_ABI if
+   the library was configured with --disable-vector-abi. */
+#if defined(__x86_64__) && (defined(_OPENMP) || defined(CRLIBM_VECTOR_ABI)) && !defined(CRLIBM_NO_VECTOR_ABI)
+#define CRLIBM_DECLARE_SIMD _Pragma("omp declare simd notinbranch")
+#else
+#define CRLIBM_DECLARE_SIMD
+#endif
+
 
 /* Finished functions */
 /* These functions are computed in two steps and have an average
    execution time comparable to that of a standard libm
 */
 
+/* The f_ro functions round to odd: they return the result rounded
+   toward zero, with its last bit set if it is inexact. This result
+   may be rounded again to any format of at most 51 bits (float,
+   bfloat16, binary16...) in any rounding mode, and this double
+   rounding is then correct. */
+
 /*  exponential  */
-extern double exp_rn(double); /* to nearest  */
-extern double exp_rd(double); /* toward -inf */ 
-extern double exp_ru(double); /* toward +inf */ 
+CRLIBM_DECLARE_SIMD extern double exp_rn(double); /* to nearest  */
+CRLIBM_DECLARE_SIMD extern double exp_rd(double); /* toward -inf */ 
+CRLIBM_DECLARE_SIMD extern double exp_ru(double); /* toward +inf */ 
 #define exp_rz exp_rd         /* toward zero */ 
+extern double exp_ro(double); /* to odd */
 
 /*  logarithm  */
-extern double log_rn(double); /* to nearest  */
-extern double log_rd(double); /* toward -inf */ 
-extern double log_ru(double); /* toward +inf */ 
-extern double log_rz(double); /* toward zero */ 
+CRLIBM_DECLARE_SIMD extern double log_rn(double); /* to nearest  */
+CRLIBM_DECLARE_SIMD extern double log_rd(double); /* toward -inf */ 
+CRLIBM_DECLARE_SIMD extern double log_ru(double); /* toward +inf */ 
+CRLIBM_DECLARE_SIMD extern double log_rz(double); /* toward zero */ 
+extern double log_ro(double); /* to odd */
 
 /*  cosine  */
-extern double cos_rn(double); /* to nearest  */
-extern double cos_rd(double); /* toward -inf */ 
-extern double cos_ru(double); /* toward +inf */ 
-extern double cos_rz(double); /* toward zero */ 
+CRLIBM_DECLARE_SIMD extern double cos_rn(double); /* to nearest  */
+CRLIBM_DECLARE_SIMD extern double cos_rd(double); /* toward -inf */ 
+CRLIBM_DECLARE_SIMD extern double cos_ru(double); /* toward +inf */ 
+CRLIBM_DECLARE_SIMD extern double cos_rz(double); /* toward zero */ 
+extern double cos_ro(double); /* to odd */
 
 /*  sine  */
-extern double sin_rn(double); /* to nearest  */
-extern double sin_rd(double); /* toward -inf */ 
-extern double sin_ru(double); /* toward +inf */ 
-extern double sin_rz(double); /* toward zero */ 
+CRLIBM_DECLARE_SIMD extern double sin_rn(double); /* to nearest  */
+CRLIBM_DECLARE_SIMD extern double sin_rd(double); /* toward -inf */ 
+CRLIBM_DECLARE_SIMD extern double sin_ru(double); /* toward +inf */ 
+CRLIBM_DECLARE_SIMD extern double sin_rz(double); /* toward zero */ 
+extern double sin_ro(double); /* to odd */
 
 /*  tangent  */
-extern double tan_rn(double); /* to nearest  */
-extern double tan_rd(double); /* toward -inf */ 
-extern double tan_ru(double); /* toward +inf */
-extern double tan_rz(double); /* toward zero */
+CRLIBM_DECLARE_SIMD extern double tan_rn(double); /* to nearest  */
+CRLIBM_DECLARE_SIMD extern double tan_rd(double); /* toward -inf */ 
+CRLIBM_DECLARE_SIMD extern double tan_ru(double); /* toward +inf */
+CRLIBM_DECLARE_SIMD extern double tan_rz(double); /* toward zero */
+extern double tan_ro(double); /* to odd */
  
 /*  cosine of pi times x  */
 extern double cospi_rn(double); /* to nearest  */
@@ -97,10 +156,11 @@ extern double tanpi_rz(double); /* toward zero */
 /* extern double cotan_rz(double); /\* toward zero *\/  */
 
 /*  arctangent  */
-extern double atan_rn(double); /* to nearest  */
-extern double atan_rd(double); /* toward -inf */ 
-extern double atan_ru(double); /* toward +inf */ 
-extern double atan_rz(double); /* toward zero */ 
+CRLIBM_DECLARE_SIMD extern double atan_rn(double); /* to nearest  */
+CRLIBM_DECLARE_SIMD extern double atan_rd(double); /* toward -inf */ 
+CRLIBM_DECLARE_SIMD extern double atan_ru(double); /* toward +inf */ 
+CRLIBM_DECLARE_SIMD extern double atan_rz(double); /* toward zero */ 
+extern double atan_ro(double); /* to odd */
 
 /*  arctangentPi  */
 extern double atanpi_rn(double); /* to nearest  */
@@ -126,6 +186,7 @@ extern double log2_rn(double); /* to nearest  */
 extern double log2_rd(double); /* toward -inf */ 
 extern double log2_ru(double); /* toward +inf */ 
 extern double log2_rz(double); /* towards zero */ 
+extern double log2_ro(double); /* to odd */
 
 /* base 10 logarithm */
 extern double log10_rn(double); /* to nearest  */
@@ -162,12 +223,261 @@ extern double expm1_rn(double); /* to nearest */
 extern double expm1_rd(double); /* toward -inf */
 extern double expm1_ru(double); /* toward +inf */
 extern double expm1_rz(double); /* toward zero */
+extern double expm1_ro(double); /* to odd */
 
 /* log1p = log(1 + x) */
 extern double log1p_rn(double); /* to nearest */
 extern double log1p_rd(double); /* toward -inf */
 extern double log1p_ru(double); /* toward +inf */
 extern double log1p_rz(double); /* toward zero */
+extern double log1p_ro(double); /* to odd */
+
+
+/* Batch versions */
+/* f_xx_batch(res, x, n) computes res[i] = f_xx(x[i]) for 0 <= i < n,
+   with the same correct rounding as f_xx. The inputs are first
+   grouped by evaluation path (range reduction, special cases), so
+   that each group is processed by a homogeneous loop. */
+
+/*  exponential  */
+extern void exp_rn_batch(double *res, const double *x, int n); /* to nearest  */
+extern void exp_rd_batch(double *res, const double *x, int n); /* toward -inf */
+extern void exp_ru_batch(double *res, const double *x, int n); /* toward +inf */
+#define exp_rz_batch exp_rd_batch                              /* toward zero */
+
+/*  logarithm  */
+extern void log_rn_batch(double *res, const double *x, int n); /* to nearest  */
+extern void log_rd_batch(double *res, const double *x, int n); /* toward -inf */
+extern void log_ru_batch(double *res, const double *x, int n); /* toward +inf */
+extern void log_rz_batch(double *res, const double *x, int n); /* toward zero */
+
+/*  cosine  */
+extern void cos_rn_batch(double *res, const double *x, int n); /* to nearest  */
+extern void cos_rd_batch(double *res, const double *x, int n); /* toward -inf */
+extern void cos_ru_batch(double *res, const double *x, int n); /* toward +inf */
+extern void cos_rz_batch(double *res, const double *x, int n); /* toward zero */
+
+/*  sine  */
+extern void sin_rn_batch(double *res, const double *x, int n); /* to nearest  */
+extern void sin_rd_batch(double *res, const double *x, int n); /* toward -inf */
+extern void sin_ru_batch(double *res, const double *x, int n); /* toward +inf */
+extern void sin_rz_batch(double *res, const double *x, int n); /* toward zero */
+
+/*  tangent  */
+extern void tan_rn_batch(double *res, const double *x, int n); /* to nearest  */
+extern void tan_rd_batch(double *res, const double *x, int n); /* toward -inf */
+extern void tan_ru_batch(double *res, const double *x, int n); /* toward +inf */
+extern void tan_rz_batch(double *res, const double *x, int n); /* toward zero */
+
+
+/* Binary32 functions */
+/* These functions are correctly rounded on floats. They are evaluated
+   in one step in double precision, and only the rare inputs for which
+   this step cannot decide the rounding go through the double function
+   rounded to odd (exp_ro etc). The batch versions f_xx_batch(res, x,
+   n) compute res[i] = f_xx(x[i]) for 0 <= i < n. */
+
+/*  exponential  */
+extern float expf_rn(float); /* to nearest  */
+extern float expf_rd(float); /* toward -inf */
+extern float expf_ru(float); /* toward +inf */
+extern float expf_rz(float); /* toward zero */
+extern void expf_rn_batch(float *res, const float *x, int n);
+extern void expf_rd_batch(float *res, const float *x, int n);
+extern void expf_ru_batch(float *res, const float *x, int n);
+extern void expf_rz_batch(float *res, const float *x, int n);
+
+/*  logarithm  */
+extern float logf_rn(float); /* to nearest  */
+extern float logf_rd(float); /* toward -inf */
+extern float logf_ru(float); /* toward +inf */
+extern float logf_rz(float); /* toward zero */
+extern void logf_rn_batch(float *res, const float *x, int n);
+extern void logf_rd_batch(float *res, const float *x, int n);
+extern void logf_ru_batch(float *res, const float *x, int n);
+extern void logf_rz_batch(float *res, const float *x, int n);
+
+/*  expm1 = e^x - 1  */
+extern float expm1f_rn(float); /* to nearest  */
+extern float expm1f_rd(float); /* toward -inf */
+extern float expm1f_ru(float); /* toward +inf */
+extern float expm1f_rz(float); /* toward zero */
+extern void expm1f_rn_batch(float *res, const float *x, int n);
+extern void expm1f_rd_batch(float *res, const float *x, int n);
+extern void expm1f_ru_batch(float *res, const float *x, int n);
+extern void expm1f_rz_batch(float *res, const float *x, int n);
+
+/*  log1p = log(1 + x)  */
+extern float log1pf_rn(float); /* to nearest  */
+extern float log1pf_rd(float); /* toward -inf */
+extern float log1pf_ru(float); /* toward +inf */
+extern float log1pf_rz(float); /* toward zero */
+extern void log1pf_rn_batch(float *res, const float *x, int n);
+extern void log1pf_rd_batch(float *res, const float *x, int n);
+extern void log1pf_ru_batch(float *res, const float *x, int n);
+extern void log1pf_rz_batch(float *res, const float *x, int n);
+
+/*  sine  */
+extern float sinf_rn(float); /* to nearest  */
+extern float sinf_rd(float); /* toward -inf */
+extern float sinf_ru(float); /* toward +inf */
+extern float sinf_rz(float); /* toward zero */
+extern void sinf_rn_batch(float *res, const float *x, int n);
+extern void sinf_rd_batch(float *res, const float *x, int n);
+extern void sinf_ru_batch(float *res, const float *x, int n);
+extern void sinf_rz_batch(float *res, const float *x, int n);
+
+/*  cosine  */
+extern float cosf_rn(float); /* to nearest  */
+extern float cosf_rd(float); /* toward -inf */
+extern float cosf_ru(float); /* toward +inf */
+extern float cosf_rz(float); /* toward zero */
+extern void cosf_rn_batch(float *res, const float *x, int n);
+extern void cosf_rd_batch(float *res, const float *x, int n);
+extern void cosf_ru_batch(float *res, const float *x, int n);
+extern void cosf_rz_batch(float *res, const float *x, int n);
+
+/*  arctangent  */
+extern float atanf_rn(float); /* to nearest  */
+extern float atanf_rd(float); /* toward -inf */
+extern float atanf_ru(float); /* toward +inf */
+extern float atanf_rz(float); /* toward zero */
+extern void atanf_rn_batch(float *res, const float *x, int n);
+extern void atanf_rd_batch(float *res, const float *x, int n);
+extern void atanf_ru_batch(float *res, const float *x, int n);
+extern void atanf_rz_batch(float *res, const float *x, int n);
+
+
+/* Tabulated functions on 16-bit formats */
+/* The results of these functions for all the 65536 inputs of the
+   IEEE binary16 (fp16) and bfloat16 (bf16) formats, correctly rounded
+   to the same format, are generated at build time and installed as a
+   file. crlibm16_init(path) maps this file in memory (path NULL means
+   $CRLIBM16_TABLES, else the installed file) and returns 0, or -1 if
+   it cannot. Afterwards crlibm16_table(function, format, mode)
+   returns the table t of 65536 results, t[x] being the bits of the
+   result for the input of bits x, and crlibm16_batch(res, x, n, t)
+   computes res[i] = t[x[i]] for 0 <= i < n. */
+
+#define CRLIBM16_FP16 0
+#define CRLIBM16_BF16 1
+
+#define CRLIBM16_EXP     0
+#define CRLIBM16_LOG     1
+#define CRLIBM16_TANH    2
+#define CRLIBM16_SIGMOID 3 /* 1/(1+exp(-x)) */
+
+#define CRLIBM16_RN 0 /* to nearest  */
+#define CRLIBM16_RU 1 /* toward +inf */
+#define CRLIBM16_RD 2 /* toward -inf */
+#define CRLIBM16_RZ 3 /* toward zero */
+
+extern int crlibm16_init(const char *path);
+extern const unsigned short *crlibm16_table(int function, int format, int mode);
+extern void crlibm16_batch(unsigned short *res, const unsigned short *x, int n,
+                           const unsigned short *table);
+
+
+/* Double-double and triple-double results */
+/* f_dd(&h, &l, x) and f_td(&h, &m, &l, x) return f(x) as the
+   unevaluated sums h + l and h + m + l, for the computations that
+   need more than a double. Both come from the accurate phase of f: h
+   is the rounding to nearest of the sum, the parts do not overlap, and
+   the relative error of h + m + l is below 2^-110 (2^-113 for exp,
+   2^-117 for log and log2, 2^-120 for sin, cos and atan), that of
+   h + l below 2^-104. The results of exp lose accuracy when their
+   lower parts become subnormal, below x = -634 (-671 for exp_dd).
+   The special cases return their usual result in h, with zero lower
+   parts. */
+
+/*  exponential  */
+extern void exp_dd(double *resh, double *resl, double x);
+extern void exp_td(double *resh, double *resm, double *resl, double x);
+
+/*  logarithm  */
+extern void log_dd(double *resh, double *resl, double x);
+extern void log_td(double *resh, double *resm, double *resl, double x);
+
+/*  log in base 2  */
+extern void log2_dd(double *resh, double *resl, double x);
+extern void log2_td(double *resh, double *resm, double *resl, double x);
+
+/*  sine  */
+extern void sin_dd(double *resh, double *resl, double x);
+extern void sin_td(double *resh, double *resm, double *resl, double x);
+
+/*  cosine  */
+extern void cos_dd(double *resh, double *resl, double x);
+extern void cos_td(double *resh, double *resm, double *resl, double x);
+
+/*  arctangent  */
+extern void atan_dd(double *resh, double *resl, double x);
+extern void atan_td(double *resh, double *resm, double *resl, double x);
+
+/*  hyperbolic sine  */
+extern void sinh_dd(double *resh, double *resl, double x);
+extern void sinh_td(double *resh, double *resm, double *resl, double x);
+
+/*  hyperbolic cosine  */
+extern void cosh_dd(double *resh, double *resl, double x);
+extern void cosh_td(double *resh, double *resm, double *resl, double x);
+
+/* Functions of double-double arguments */
+/* f_dd_rn(xh, xl) returns f(xh + xl) rounded to nearest, for a
+   double-double with |xl| <= ulp(xh)/2, as the last step of a
+   computation carried in double-double. The low part is taken into
+   account by the argument reductions, and f_dd_rn(x, 0) = f_rn(x).
+   The worst cases of the rounding being only known for double
+   arguments, correct rounding is proven unless f(xh + xl) lies within
+   2^-110 (exp, log) or 2^-120 (sin, cos) of the middle of two
+   consecutive doubles, relatively. */
+extern double exp_dd_rn(double xh, double xl);
+extern double log_dd_rn(double xh, double xl);
+extern double sin_dd_rn(double xh, double xl);
+extern double cos_dd_rn(double xh, double xl);
+
+/* Long double functions */
+/* On x86, on the 80-bit double-extended format (64-bit significand),
+   built where fpu_control.h is available. The worst cases of these
+   roundings are unknown: correct rounding is not proven when the
+   result lies within 2^-120 of a rounding boundary, relatively. */
+#if defined(__i386__) || defined(__x86_64__)
+extern long double expl_rn(long double); /* to nearest  */
+extern long double expl_rd(long double); /* toward -inf */
+extern long double expl_ru(long double); /* toward +inf */
+extern long double expl_rz(long double); /* toward zero */
+
+extern long double logl_rn(long double);
+extern long double logl_rd(long double);
+extern long double logl_ru(long double);
+extern long double logl_rz(long double);
+
+extern long double sinl_rn(long double);
+extern long double sinl_rd(long double);
+extern long double sinl_ru(long double);
+extern long double sinl_rz(long double);
+
+extern long double cosl_rn(long double);
+extern long double cosl_rd(long double);
+extern long double cosl_ru(long double);
+extern long double cosl_rz(long double);
+#endif
+
+/* Binary128 functions */
+/* On __float128 (113-bit significand), where the compiler has it.
+   Same caveat: correct rounding is not proven when the result lies
+   within 2^-180 of a rounding boundary, relatively. */
+#ifdef __SIZEOF_FLOAT128__
+extern __float128 expq_rn(__float128); /* to nearest  */
+extern __float128 expq_rd(__float128); /* toward -inf */
+extern __float128 expq_ru(__float128); /* toward +inf */
+extern __float128 expq_rz(__float128); /* toward zero */
+
+extern __float128 logq_rn(__float128);
+extern __float128 logq_rd(__float128);
+extern __float128 logq_ru(__float128);
+extern __float128 logq_rz(__float128);
+#endif
 
 
 /* Unfinished functions */
@@ -194,6 +504,30 @@ extern double pow_rn(double, double);
 #include "interval.h"
 interval j_log(interval x);
 interval j_exp(interval x);
+interval j_expm1(interval x);
+interval j_log2(interval x);
+interval j_log10(interval x);
+interval j_log1p(interval x);
+interval j_sin(interval x);
+interval j_cos(interval x);
+interval j_tan(interval x);
+interval j_sinpi(interval x);
+interval j_cospi(interval x);
+interval j_atan(interval x);
+interval j_asin(interval x);
+interval j_acos(interval x);
+interval j_sinh(interval x);
+interval j_cosh(interval x);
+interval j_pow(interval x, interval y);
+
+/* Batch versions, on intervals given as structure of arrays:
+   j_f_batch(res_inf, res_sup, inf, sup, n) computes the interval
+   [res_inf[i], res_sup[i]] = j_f([inf[i], sup[i]]) for 0 <= i < n.
+   The thin intervals (inf[i] == sup[i]) are evaluated only once. */
+void j_exp_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_log_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_expm1_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_log2_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
 #endif /* BUILD_INTERVAL_FUNCTIONS */
 
 #if defined (__cplusplus)
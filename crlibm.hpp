@@ -0,0 +1,382 @@
+/*
+ * C++ interface to the correctly rounded functions
+ *
+ * The rounding mode is a template parameter:
+ *
+ *   crlibm::exp<crlibm::rounding::up>(x)       is exp_ru(x)
+ *   crlibm::exp(x)                             is exp_rn(x)
+ *
+ * so that generic code selects the function at compile time, and the
+ * call may be inlined, where a table of function pointers indexed by
+ * the rounding mode (as in tests/test_common.c) cannot. The functions
+ * which have no version rounded toward zero in crlibm.h (exp, acos,
+ * acospi) give it by the directed rounding which is equivalent.
+ *
+ * With C++20, each function also has an overload on std::span
+ *
+ *   crlibm::exp<R>(std::span<double> res, std::span<const double> x)
+ *
+ * which computes res[i] = f(x[i]) for all i, by the batch versions of
+ * crlibm.h for exp, log, sin, cos and tan. It throws std::length_error
+ * if res is shorter than x.
+ *
+ * Finally, crlibm::interval<double> is an interval of doubles. Its
+ * operators and elementary functions return the smallest interval of
+ * doubles containing the exact image (up to one ulp close to the
+ * underflow threshold for * and /), by the functions rounded downwards
+ * for the lower bound and upwards for the upper one. A zero bound is
+ * -0 below and +0 above, and 0 times an infinite bound is 0.
+ *
+ * This requires C++17. The vector overloads are in crlibm_simd.hpp.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef CRLIBM_HPP
+#define CRLIBM_HPP
+
+#if __cplusplus < 201703L
+#error "crlibm.hpp requires C++17"
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <climits>
+#include <limits>
+#include <stdexcept>
+#include "crlibm.h"
+
+#if defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#endif
+#endif
+#if defined(__cpp_lib_span)
+#define CRLIBM_HAS_SPAN 1
+#endif
+
+
+namespace crlibm {
+
+enum class rounding { to_nearest, up, down, toward_zero };
+
+
+namespace detail {
+
+#if CRLIBM_HAS_SPAN
+  inline void check_span(std::span<double> res, std::span<const double> x) {
+    if(res.size() < x.size())
+      throw std::length_error("crlibm: result span shorter than the argument span");
+  }
+
+  /* The batch functions take an int count */
+  inline void on_span(void (*f)(double *, const double *, int),
+                      std::span<double> res, std::span<const double> x) {
+    std::size_t i, n;
+    check_span(res, x);
+    for(i = 0; i < x.size(); i += n) {
+      n = x.size() - i;
+      if(n > INT_MAX) n = INT_MAX;
+      f(res.data() + i, x.data() + i, (int) n);
+    }
+  }
+#endif
+
+} /* namespace detail */
+
+
+#define CRLIBM_SELECT(rn, ru, rd, rz, ...)                              \
+  if constexpr (R == rounding::to_nearest) return rn(__VA_ARGS__);      \
+  else if constexpr (R == rounding::up)    return ru(__VA_ARGS__);      \
+  else if constexpr (R == rounding::down)  return rd(__VA_ARGS__);      \
+  else                                     return rz(__VA_ARGS__);
+
+#if CRLIBM_HAS_SPAN
+#define CRLIBM_SPAN_LOOP(f)                                             \
+  template <rounding R = rounding::to_nearest>                          \
+  inline void f(std::span<double> res, std::span<const double> x) {    \
+    detail::check_span(res, x);                                         \
+    for(std::size_t i = 0; i < x.size(); i++)                           \
+      res[i] = f<R>(x[i]);                                              \
+  }
+#define CRLIBM_SPAN_BATCH(f, rn, ru, rd, rz)                            \
+  template <rounding R = rounding::to_nearest>                          \
+  inline void f(std::span<double> res, std::span<const double> x) {    \
+    if constexpr (R == rounding::to_nearest) detail::on_span(rn##_batch, res, x); \
+    else if constexpr (R == rounding::up)    detail::on_span(ru##_batch, res, x); \
+    else if constexpr (R == rounding::down)  detail::on_span(rd##_batch, res, x); \
+    else                                     detail::on_span(rz##_batch, res, x); \
+  }
+#else
+#define CRLIBM_SPAN_LOOP(f)
+#define CRLIBM_SPAN_BATCH(f, rn, ru, rd, rz)
+#endif
+
+#define CRLIBM_FUNCTION(f, rn, ru, rd, rz)                              \
+  template <rounding R = rounding::to_nearest>                          \
+  inline double f(double x) {                                           \
+    CRLIBM_SELECT(::rn, ::ru, ::rd, ::rz, x)                            \
+  }
+
+#define CRLIBM_FUNCTION_LOOP(f, rn, ru, rd, rz)                         \
+  CRLIBM_FUNCTION(f, rn, ru, rd, rz)                                    \
+  CRLIBM_SPAN_LOOP(f)
+
+#define CRLIBM_FUNCTION_BATCH(f, rn, ru, rd, rz)                        \
+  CRLIBM_FUNCTION(f, rn, ru, rd, rz)                                    \
+  CRLIBM_SPAN_BATCH(f, rn, ru, rd, rz)
+
+/* e^x is positive: toward zero is downwards */
+CRLIBM_FUNCTION_BATCH(exp,    exp_rn,    exp_ru,    exp_rd,    exp_rd)
+CRLIBM_FUNCTION_BATCH(log,    log_rn,    log_ru,    log_rd,    log_rz)
+CRLIBM_FUNCTION_BATCH(cos,    cos_rn,    cos_ru,    cos_rd,    cos_rz)
+CRLIBM_FUNCTION_BATCH(sin,    sin_rn,    sin_ru,    sin_rd,    sin_rz)
+CRLIBM_FUNCTION_BATCH(tan,    tan_rn,    tan_ru,    tan_rd,    tan_rz)
+CRLIBM_FUNCTION_LOOP(cospi,   cospi_rn,  cospi_ru,  cospi_rd,  cospi_rz)
+CRLIBM_FUNCTION_LOOP(sinpi,   sinpi_rn,  sinpi_ru,  sinpi_rd,  sinpi_rz)
+CRLIBM_FUNCTION_LOOP(tanpi,   tanpi_rn,  tanpi_ru,  tanpi_rd,  tanpi_rz)
+CRLIBM_FUNCTION_LOOP(atan,    atan_rn,   atan_ru,   atan_rd,   atan_rz)
+CRLIBM_FUNCTION_LOOP(atanpi,  atanpi_rn, atanpi_ru, atanpi_rd, atanpi_rz)
+CRLIBM_FUNCTION_LOOP(cosh,    cosh_rn,   cosh_ru,   cosh_rd,   cosh_rz)
+CRLIBM_FUNCTION_LOOP(sinh,    sinh_rn,   sinh_ru,   sinh_rd,   sinh_rz)
+CRLIBM_FUNCTION_LOOP(log2,    log2_rn,   log2_ru,   log2_rd,   log2_rz)
+CRLIBM_FUNCTION_LOOP(log10,   log10_rn,  log10_ru,  log10_rd,  log10_rz)
+CRLIBM_FUNCTION_LOOP(asin,    asin_rn,   asin_ru,   asin_rd,   asin_rz)
+/* acos(x) and acos(x)/pi are positive: toward zero is downwards */
+CRLIBM_FUNCTION_LOOP(acos,    acos_rn,   acos_ru,   acos_rd,   acos_rd)
+CRLIBM_FUNCTION_LOOP(asinpi,  asinpi_rn, asinpi_ru, asinpi_rd, asinpi_rz)
+CRLIBM_FUNCTION_LOOP(acospi,  acospi_rn, acospi_ru, acospi_rd, acospi_rd)
+CRLIBM_FUNCTION_LOOP(expm1,   expm1_rn,  expm1_ru,  expm1_rd,  expm1_rz)
+CRLIBM_FUNCTION_LOOP(log1p,   log1p_rn,  log1p_ru,  log1p_rd,  log1p_rz)
+
+/* pow is only available rounded to nearest */
+template <rounding R = rounding::to_nearest>
+inline double pow(double x, double y) {
+  static_assert(R == rounding::to_nearest, "crlibm::pow is only rounded to nearest");
+  return ::pow_rn(x, y);
+}
+
+#undef CRLIBM_SELECT
+#undef CRLIBM_SPAN_LOOP
+#undef CRLIBM_SPAN_BATCH
+#undef CRLIBM_FUNCTION
+#undef CRLIBM_FUNCTION_LOOP
+#undef CRLIBM_FUNCTION_BATCH
+
+
+
+/* Directed rounding of the arithmetic operations, without changing
+   the rounding mode of the processor: the operation is computed
+   rounded to nearest, and its exact error (Add12, Mul12 and the
+   remainder of the division, see crlibm_private.h) tells the
+   direction in which it was rounded. This assumes round to nearest in
+   double precision, as all crlibm does. Where the error may not be
+   exact (results close to the underflow), the result is widened by
+   one ulp instead. */
+namespace detail {
+
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+  constexpr double max_double = std::numeric_limits<double>::max();
+  constexpr double tiny = 0x1p-969;  /* Mul12 is exact above */
+  constexpr double huge = 0x1p996;   /* and its splitting overflows above */
+
+  inline double next_up(double x)   { return std::nextafter(x,  infinity); }
+  inline double next_down(double x) { return std::nextafter(x, -infinity); }
+
+  /* Returns the rounded result r of an operation whose exact result
+     is r+e (e<0 if r is above it), or, if r overflowed, the largest
+     finite double of the same sign in the direction of zero */
+  template <rounding R>
+  inline double directed(double r, double e, bool operands_finite) {
+    if(!std::isfinite(r)) {
+      if(std::isinf(r) && operands_finite) {
+        if constexpr (R == rounding::down) return r > 0 ? max_double : r;
+        else return r < 0 ? -max_double : r;
+      }
+      return r;
+    }
+    if constexpr (R == rounding::down) return e < 0 ? next_down(r) : r;
+    else return e > 0 ? next_up(r) : r;
+  }
+
+  /* Knuth's Add12 (no condition on the operands) */
+  template <rounding R>
+  inline double add(double a, double b) {
+    double s = a + b, bb = s - a, e = (a - (s - bb)) + (b - bb);
+    return directed<R>(s, e, std::isfinite(a) && std::isfinite(b));
+  }
+
+  /* Dekker's Mul12 */
+  inline void mul12(double *rh, double *rl, double u, double v) {
+    const double c = 134217729.;   /* 2^27 +1 */
+    double up, u1, u2, vp, v1, v2;
+    up = u*c;        vp = v*c;
+    u1 = (u-up)+up;  v1 = (v-vp)+vp;
+    u2 = u-u1;       v2 = v-v1;
+    *rh = u*v;
+    *rl = (((u1*v1-*rh)+(u1*v2))+(u2*v1))+(u2*v2);
+  }
+
+  /* An operand above huge is divided by 2^53 for Mul12, and the
+     product multiplied back, which keeps its exact error exact: it is
+     then above 2^-131. If both are, the product overflows anyway.
+     Zero times an infinite bound is a zero, not NaN: the bound only
+     stands for the finite values of the interval. */
+  template <rounding R>
+  inline double mul(double a, double b) {
+    double ph, pl, s = 1;
+    if(a == 0 || b == 0) {
+      if(std::isinf(a) || std::isinf(b))
+        return std::copysign(0.0, a) * std::copysign(1.0, b);
+      return a*b;
+    }
+    if(std::fabs(a) > huge)      { a *= 0x1p-53; s = 0x1p53; }
+    else if(std::fabs(b) > huge) { b *= 0x1p-53; s = 0x1p53; }
+    mul12(&ph, &pl, a, b);
+    ph *= s;  pl *= s;
+    if(std::fabs(ph) < tiny)
+      return directed<R>(ph, R == rounding::down ? -1 : 1, true);
+    return directed<R>(ph, pl, std::isfinite(a) && std::isfinite(b));
+  }
+
+  template <rounding R>
+  inline double div(double a, double b) {
+    double q, ph, pl, r;
+    q = a/b;
+    if(!std::isfinite(q) || !std::isfinite(a) || !std::isfinite(b))
+      return directed<R>(q, 0, std::isfinite(a) && std::isfinite(b) && b != 0);
+    if(a == 0)
+      return q;
+    if(std::fabs(q) < tiny || std::fabs(a) < tiny)
+      return directed<R>(q, R == rounding::down ? -1 : 1, true);
+    /* a - q*b is exact, by Sterbenz lemma for a - ph. Above huge, q or
+       b is divided by 2^53 for Mul12, and so is a, exactly: a is then
+       above 2^-78 (|q| > 2^996) or 2^27 (|b| > 2^996, |q| >= tiny), and
+       both cannot be above huge. The remainder keeps its sign. */
+    if(std::fabs(q) > huge)      { mul12(&ph, &pl, q*0x1p-53, b); a *= 0x1p-53; }
+    else if(std::fabs(b) > huge) { mul12(&ph, &pl, q, b*0x1p-53); a *= 0x1p-53; }
+    else                           mul12(&ph, &pl, q, b);
+    r = (a - ph) - pl;
+    return directed<R>(q, b > 0 ? r : -r, true);
+  }
+
+} /* namespace detail */
+
+
+template <class T> struct interval;
+
+template <> struct interval<double> {
+  double lo, hi;
+
+  constexpr interval() : lo(0), hi(0) {}
+  constexpr interval(double x) : lo(x), hi(x) {}
+  constexpr interval(double l, double h) : lo(l), hi(h) {}
+
+  constexpr bool contains(double x) const { return lo <= x && x <= hi; }
+  constexpr bool empty() const { return !(lo <= hi); }
+};
+
+inline interval<double> operator-(interval<double> x) {
+  return interval<double>(-x.hi, -x.lo);
+}
+
+inline interval<double> operator+(interval<double> x, interval<double> y) {
+  return interval<double>(detail::add<rounding::down>(x.lo, y.lo),
+                          detail::add<rounding::up>(x.hi, y.hi));
+}
+
+inline interval<double> operator-(interval<double> x, interval<double> y) {
+  return x + (-y);
+}
+
+inline interval<double> operator*(interval<double> x, interval<double> y) {
+  double l, h, c;
+  l = detail::mul<rounding::down>(x.lo, y.lo);
+  h = detail::mul<rounding::up>(x.lo, y.lo);
+  c = detail::mul<rounding::down>(x.lo, y.hi);  if(c < l) l = c;
+  c = detail::mul<rounding::up>(x.lo, y.hi);    if(c > h) h = c;
+  c = detail::mul<rounding::down>(x.hi, y.lo);  if(c < l) l = c;
+  c = detail::mul<rounding::up>(x.hi, y.lo);    if(c > h) h = c;
+  c = detail::mul<rounding::down>(x.hi, y.hi);  if(c < l) l = c;
+  c = detail::mul<rounding::up>(x.hi, y.hi);    if(c > h) h = c;
+  /* -0 and +0 compare equal: a zero bound is -0 below and +0 above */
+  if(l == 0) l = -0.0;
+  if(h == 0) h = 0.0;
+  return interval<double>(l, h);
+}
+
+/* If y contains zero, the result is the whole line */
+inline interval<double> operator/(interval<double> x, interval<double> y) {
+  double l, h, c;
+  if(y.contains(0))
+    return interval<double>(-detail::infinity, detail::infinity);
+  l = detail::div<rounding::down>(x.lo, y.lo);
+  h = detail::div<rounding::up>(x.lo, y.lo);
+  c = detail::div<rounding::down>(x.lo, y.hi);  if(c < l) l = c;
+  c = detail::div<rounding::up>(x.lo, y.hi);    if(c > h) h = c;
+  c = detail::div<rounding::down>(x.hi, y.lo);  if(c < l) l = c;
+  c = detail::div<rounding::up>(x.hi, y.lo);    if(c > h) h = c;
+  c = detail::div<rounding::down>(x.hi, y.hi);  if(c < l) l = c;
+  c = detail::div<rounding::up>(x.hi, y.hi);    if(c > h) h = c;
+  if(l == 0) l = -0.0;
+  if(h == 0) h = 0.0;
+  return interval<double>(l, h);
+}
+
+
+/* The monotonic functions. Where the domain of the function is
+   bounded, it is the caller's job to intersect with it: the bounds of
+   an interval outside it are NaN. */
+#define CRLIBM_INCREASING(f)                                            \
+  inline interval<double> f(interval<double> x) {                       \
+    return interval<double>(f<rounding::down>(x.lo), f<rounding::up>(x.hi)); \
+  }
+#define CRLIBM_DECREASING(f)                                            \
+  inline interval<double> f(interval<double> x) {                       \
+    return interval<double>(f<rounding::down>(x.hi), f<rounding::up>(x.lo)); \
+  }
+
+CRLIBM_INCREASING(exp)
+CRLIBM_INCREASING(expm1)
+CRLIBM_INCREASING(log)
+CRLIBM_INCREASING(log2)
+CRLIBM_INCREASING(log10)
+CRLIBM_INCREASING(log1p)
+CRLIBM_INCREASING(sinh)
+CRLIBM_INCREASING(atan)
+CRLIBM_INCREASING(atanpi)
+CRLIBM_INCREASING(asin)
+CRLIBM_INCREASING(asinpi)
+CRLIBM_DECREASING(acos)
+CRLIBM_DECREASING(acospi)
+
+#undef CRLIBM_INCREASING
+#undef CRLIBM_DECREASING
+
+/* cosh is decreasing then increasing */
+inline interval<double> cosh(interval<double> x) {
+  if(x.hi <= 0)
+    return interval<double>(cosh<rounding::down>(x.hi), cosh<rounding::up>(x.lo));
+  if(x.lo >= 0)
+    return interval<double>(cosh<rounding::down>(x.lo), cosh<rounding::up>(x.hi));
+  return interval<double>(1.0, cosh<rounding::up>(-x.lo > x.hi ? x.lo : x.hi));
+}
+
+} /* namespace crlibm */
+
+#endif /* CRLIBM_HPP */
@@ -331,8 +331,105 @@ void sqrt12(double *resh, double *resl, double x) {
   
 #if EVAL_PERF==1
 /* counter of calls to the second step (accurate step) */
+#ifdef BUILD_ENTRY_WRAPPERS
+__thread int crlibm_second_step_taken;
+#else
 int crlibm_second_step_taken;
 #endif
+#endif
+
+#ifdef BUILD_SLOW_PATH_CAPTURE
+/* see SLOW_PATH in crlibm_private.h */
+__thread int crlibm_slow_paths;
+#endif
+
+#ifdef BUILD_ACCURATE_HOOK
+/* see QUICK_PHASE in crlibm_private.h */
+int crlibm_force_accurate;
+#endif
+
+
+
+/* Rounding to a float, in the given mode (CRLIBM_RN etc), of a double
+   which was rounded to odd (exp_ro etc): this double rounding is
+   correct. The conversion rounds to nearest; in the directed modes,
+   its result is then replaced with its neighbour when it lies on the
+   wrong side of x. Infinities, zeroes and NaNs are converted as
+   they are. */
+float float_from_ro(double x, int mode) {
+  union {float f; unsigned int i;} r;
+  double rd;
+
+  r.f = (float) x;
+  rd = r.f;
+  if(mode==CRLIBM_RN || rd==x || x!=x)
+    return r.f;
+  if((mode==CRLIBM_RD && rd > x) || (mode==CRLIBM_RU && rd < x)) {
+    if((r.i & 0x7fffffff) == 0)         /* from a zero to the smallest subnormal */
+      r.i = (x < 0) ? 0x80000001 : 1;
+    else if((rd > x) == (rd > 0))       /* toward zero */
+      r.i--;
+    else                                /* away from zero */
+      r.i++;
+  }
+  else if(mode==CRLIBM_RZ && ((rd > 0 && rd > x) || (rd < 0 && rd < x)))
+    r.i--;
+  return r.f;
+}
+
+/* The non-overlapping triple-double nearest to the SCS number x: each
+   part is the rounding to nearest of what the previous ones leave, the
+   subtractions being exact in SCS. The relative error is below 2^-158. */
+void scs_get_td(double *resh, double *resm, double *resl, scs_ptr x) {
+  scs_t t, r;
+
+  scs_get_d(resh, x);
+  scs_set_d(t, *resh);
+  scs_sub(r, x, t);
+  scs_get_d(resm, r);
+  scs_set_d(t, *resm);
+  scs_sub(r, r, t);
+  scs_get_d(resl, r);
+}
+
+/* exp(x - k ln(2)) in SCS, for |x - k ln(2)| <= ln(2), as the accurate
+   phase of the long double and binary128 exponentials: the Taylor
+   series of degree 18 of exp at r = (x - k ln(2))/2^8, whose remainder
+   is below 2^-219, squared 8 times. The relative error is below 2^-200. */
+static const scs sc_ln2_exp =
+  {{0x2c5c85fd, 0x3d1cf79a, 0x2f278ece, 0x1803f2f6,
+    0x2bd03cd0, 0x3267298b, 0x18b62834, 0x175b8baa},
+   DB_ONE,  -1,   1 };
+
+void scs_exp_reduced(scs_ptr res, scs_ptr x, int k) {
+  scs_t t, r, one;
+  int i;
+
+#if EVAL_PERF
+  crlibm_second_step_taken++;
+#endif
+  scs_set(t, (scs_ptr) &sc_ln2_exp);
+  if (k >= 0)
+    scs_mul_ui(t, (unsigned int) k);
+  else {
+    scs_mul_ui(t, (unsigned int) -k);
+    t->sign = -1;
+  }
+  scs_sub(r, x, t);
+  scs_set_d(t, 0x1p-8);
+  scs_mul(r, r, t);
+
+  scs_set_d(one, 1.0);
+  scs_set(res, one);
+  for (i = 18; i > 0; i--) {
+    scs_mul(res, res, r);
+    scs_set_si(t, i);
+    scs_div(res, res, t);
+    scs_add(res, res, one);
+  }
+  for (i = 0; i < 8; i++)
+    scs_square(res, res);
+}
 
 /* A debug functions */
 
@@ -95,10 +95,51 @@ development/debugging phase, until no type warning remains.
 #define EVAL_PERF  1
 
 
+/* The library configured with --enable-latency-histograms or
+   --enable-slow-path-capture observes the calls to its functions in
+   latency.c */
+#if defined(BUILD_LATENCY_HISTOGRAMS) || defined(BUILD_SLOW_PATH_CAPTURE)
+#define BUILD_ENTRY_WRAPPERS 1
+#endif
+
+
 #if EVAL_PERF==1
-/* counter of calls to the second step (accurate step) */
+/* counter of calls to the second step (accurate step), per thread when
+   latency.c uses it to tell the exit path of a call */
+#ifdef BUILD_ENTRY_WRAPPERS
+extern __thread int crlibm_second_step_taken;
+#else
 extern int crlibm_second_step_taken;
 #endif
+#endif
+
+
+/* The slow paths other than the accurate phase, CRLIBM_SLOW_SCS_RR etc
+   of crlibm.h, taken by the current call: with --enable-slow-path-capture,
+   latency.c records the calls which set some of them */
+#ifdef BUILD_SLOW_PATH_CAPTURE
+extern __thread int crlibm_slow_paths;
+#define SLOW_PATH(path) (crlibm_slow_paths |= (path))
+#else
+#define SLOW_PATH(path)
+#endif
+
+
+/* Test-only hook for measuring the cost of the accurate phase
+   (configure --enable-accurate-hook). When bit 0 of
+   crlibm_force_accurate is set, the rounding tests of the quick phase
+   of the scalar functions all fail, so every call goes to the accurate
+   phase. When bit 1 is set, the trigonometric functions use the SCS
+   argument reduction whatever the size of the argument. Without the
+   option both macros are constants and the tests compile as before. */
+#ifdef BUILD_ACCURATE_HOOK
+extern int crlibm_force_accurate;
+#define QUICK_PHASE  (!(crlibm_force_accurate & 1))
+#define FORCE_SCS_RR (crlibm_force_accurate & 2)
+#else
+#define QUICK_PHASE  1
+#define FORCE_SCS_RR 0
+#endif
 
 
 
@@ -134,6 +175,15 @@ extern int crlibm_second_step_taken;
 
 
 
+/* Codes for the rounding modes, used by the code which is shared by
+   the four rounding modes of a function (e.g. the batch versions) */
+#define CRLIBM_RN 0
+#define CRLIBM_RU 1
+#define CRLIBM_RD 2
+#define CRLIBM_RZ 3
+
+
+
 /* Macros for the rounding tests in directed modes */
 /* After Evgeny Gvozdev pointed out a bug in the rounding procedures I
    decided to centralize them here 
@@ -155,7 +205,7 @@ All this does not work for denormals, of course
   __yhdb__.l = __yhdb__.l & 0x7fffffffffffffffLL;  /* compute the absolute value*/ \
   __yldb__.l = __yldb__.l & 0x7fffffffffffffffLL;  /* compute the absolute value*/ \
   u53.l     = (__yhdb__.l & ULL(7ff0000000000000)) +  ULL(0010000000000000); \
-  if(__yldb__.d > __eps__ * u53.d){                                          \
+  if(QUICK_PHASE && __yldb__.d > __eps__ * u53.d){                                      \
     if(!yl_neg) {  /* The case yl==0 is filtered by the above test*/   \
       /* return next up */                                             \
       __yhdb__.d = __yh__;                                                   \
@@ -176,7 +226,7 @@ All this does not work for denormals, of course
   __yhdb__.l = __yhdb__.l & 0x7fffffffffffffffLL;  /* compute the absolute value*/ \
   __yldb__.l = __yldb__.l & 0x7fffffffffffffffLL;  /* compute the absolute value*/ \
   u53.l     = (__yhdb__.l & ULL(7ff0000000000000)) +  ULL(0010000000000000); \
-  if(__yldb__.d > __eps__ * u53.d){                                          \
+  if(QUICK_PHASE && __yldb__.d > __eps__ * u53.d){                                      \
     if(yl_neg) {   /* The case yl==0 is filtered by the above test*/   \
       /* return next down */                                           \
       __yhdb__.d = __yh__;                                                   \
@@ -198,7 +248,7 @@ All this does not work for denormals, of course
   __yhdb__.l = __yhdb__.l & ULL(7fffffffffffffff);  /* compute the absolute value*/\
   __yldb__.l = __yldb__.l & ULL(7fffffffffffffff);  /* compute the absolute value*/\
   u53.l     = (__yhdb__.l & ULL(7ff0000000000000)) +  ULL(0010000000000000); \
-  if(__yldb__.d > __eps__ * u53.d){                                          \
+  if(QUICK_PHASE && __yldb__.d > __eps__ * u53.d){                                      \
     if(yl_neg!=yh_neg) {                                               \
       __yhdb__.d = __yh__;                                                   \
       __yhdb__.l--;                          /* Beware: fails for zero */    \
@@ -220,7 +270,7 @@ All this does not work for denormals, of course
   __yldb__.l = __yldb__.l & 0x7fffffffffffffffLL;  /* compute the absolute value*/ \
   u53.l     = (__yhdb__.l & ULL(7ff0000000000000)) +  ULL(0010000000000000); \
   __cond__ = 0;                                                        \
-  if(__yldb__.d > __eps__ * u53.d){                                          \
+  if(QUICK_PHASE && __yldb__.d > __eps__ * u53.d){                                      \
      __cond__ = 1;                                                     \
     if(!yl_neg) {  /* The case yl==0 is filtered by the above test*/   \
       /* return next up */                                             \
@@ -244,7 +294,7 @@ All this does not work for denormals, of course
   __yldb__.l = __yldb__.l & 0x7fffffffffffffffLL;  /* compute the absolute value*/ \
   u53.l     = (__yhdb__.l & ULL(7ff0000000000000)) +  ULL(0010000000000000); \
   __cond__ = 0;                                                        \
-  if(__yldb__.d > __eps__ * u53.d){                                          \
+  if(QUICK_PHASE && __yldb__.d > __eps__ * u53.d){                                      \
     __cond__ = 1;                                                      \
     if(yl_neg) {  /* The case yl==0 is filtered by the above test*/    \
       /* return next down */                                           \
@@ -269,7 +319,7 @@ All this does not work for denormals, of course
   __yldb__.l = __yldb__.l & ULL(7fffffffffffffff);  /* compute the absolute value*/\
   u53.l     = (__yhdb__.l & ULL(7ff0000000000000)) +  ULL(0010000000000000); \
   __cond__ = 0;                                                        \
-  if(__yldb__.d > __eps__ * u53.d){                                          \
+  if(QUICK_PHASE && __yldb__.d > __eps__ * u53.d){                                      \
     if(yl_neg!=yh_neg) {                                               \
       __yhdb__.d = __yh__;                                                   \
       __yhdb__.l--;                          /* Beware: fails for zero */    \
@@ -279,10 +329,107 @@ All this does not work for denormals, of course
     else {                                                             \
       __res__ = __yh__;                                                \
       __cond__ = 1;                                                    \
+    }                                                                  \
   }                                                                    \
 }
 
 
+/* Round to odd: the result rounded toward zero with its last bit set
+   if it is inexact. A double rounded to odd may then be rounded again
+   to any format of at most 51 bits without double rounding error.
+
+   The TEST_AND_RETURN_RZ tests above only succeed when yl is not
+   zero, that is on inexact results, and the accurate phases only meet
+   exact results on the arguments which the functions filter first
+   (exp(0)=1, log(1)=0, etc). The f_ro functions therefore filter
+   these arguments, then set the last bit of the result of f_rz with
+   the following macro. A zero due to an underflow becomes the
+   smallest subnormal, infinities and NaNs are returned unchanged. */
+#define RETURN_RO_FROM_RZ(__rz__)                                      \
+{                                                                      \
+  db_number __rodb__;                                                  \
+  __rodb__.d = __rz__;                                                 \
+  if((__rodb__.i[HI] & 0x7ff00000) != 0x7ff00000)                      \
+    __rodb__.l |= 1;                                                   \
+  return __rodb__.d;                                                   \
+}
+
+
+
+/* Rounding test of the binary32 functions (expf_rn etc), which are
+   evaluated in one step in double precision: y approximates f(x) with
+   a relative error below 2^-49, that is less than FLOAT_ROUND_MARGIN
+   ulps of y. It can be rounded to a float in the given mode if its 29
+   last bits (the ones a float does not have) are further than that
+   from 0 (directed modes) or from the middle of two floats (round to
+   nearest), and if it is in the range of the normal floats: this
+   fails in particular for y=0, which the kernels return for the
+   arguments they do not handle. The rounding is then computed on the
+   bits of y, by adding the rounding increment and clearing the 29 last
+   bits, so that the conversion to float is exact. */
+#define FLOAT_ROUND_MARGIN 16
+
+#define TEST_AND_COPY_FLOAT(__cond__, __res__, __y__, __mode__)       \
+{                                                                      \
+  db_number __ydb__;  unsigned int __e__;                              \
+  __ydb__.d = __y__;                                                   \
+  __e__ = ((__ydb__.i[HI] >> 20) & 0x7ff) - (1023-126);                \
+  /* the 29 last bits, shifted by the margin (and by half an ulp of a  \
+     float to nearest), are more than twice the margin */              \
+  __cond__ = (__e__ < 254)                                             \
+    & (((__ydb__.l + FLOAT_ROUND_MARGIN                                \
+         - ((__mode__)==CRLIBM_RN ? ULL(10000000) : 0))                \
+        & ULL(1fffffff)) > 2*FLOAT_ROUND_MARGIN);                      \
+  if((__mode__)==CRLIBM_RN)                                            \
+    __ydb__.l += ULL(10000000);                                        \
+  else if(((__mode__)==CRLIBM_RU && __ydb__.i[HI] >= 0)                \
+          || ((__mode__)==CRLIBM_RD && __ydb__.i[HI] < 0))             \
+    __ydb__.l += ULL(20000000);                                        \
+  __ydb__.l &= ~ULL(1fffffff);                                         \
+  __res__ = (float) __ydb__.d;                                         \
+}
+
+/* When the test fails, the binary32 functions round the result of
+   the double function rounded to odd, see crlibm_private.c */
+extern float float_from_ro(double x, int mode);
+
+/* Batch version of a binary32 function, when there are no vector
+   kernels: a loop on the scalar function */
+#define FLOAT_BATCH(f)                                                 \
+void f##_batch(float *res, const float *x, int n) {                    \
+  int i;                                                               \
+  for(i=0; i<n; i++)                                                   \
+    res[i] = f(x[i]);                                                  \
+}
+
+/* Multiplication of the triple-double th + tm + tl by 2^e, with
+   -1076 <= e <= 1026, in two steps which are exact as long as no part
+   becomes subnormal (for the functions returning triple-doubles,
+   exp_td etc) */
+#define Scale3(th, tm, tl, e)                                          \
+{                                                                      \
+  db_number _s1, _s2;                                                  \
+  _s1.l = (int64_t) ((e)/2 + 1023) << 52;                              \
+  _s2.l = (int64_t) ((e) - (e)/2 + 1023) << 52;                        \
+  (th) = ((th) * _s1.d) * _s2.d;                                       \
+  (tm) = ((tm) * _s1.d) * _s2.d;                                       \
+  (tl) = ((tl) * _s1.d) * _s2.d;                                       \
+}
+
+/* The accurate phases in SCS return their result as a triple-double
+   through this function, see crlibm_private.c */
+extern void scs_get_td(double *resh, double *resm, double *resl, scs_ptr x);
+
+/* The SCS logarithm of y*2^E, y in [sqrt(2)/2, sqrt(2)] (log_accurate.c),
+   and the SCS sine or cosine of xh + xl, two SCS numbers of at most
+   three digits each (trigo_accurate.c), for the long double functions */
+extern void scs_log(scs_ptr res, db_number y, int E);
+extern void scs_sincos_scs(scs_ptr res, scs_ptr xh, scs_ptr xl, int cosine);
+
+/* exp(x - k ln(2)) in SCS, see crlibm_private.c */
+extern void scs_exp_reduced(scs_ptr res, scs_ptr x, int k);
+
+
 
 /* If the processor has a FMA, use it !   **/
 
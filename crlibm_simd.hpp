@@ -0,0 +1,232 @@
+/*
+ * Register-level vector versions of the correctly rounded functions,
+ * for C++ code
+ *
+ * For exp, log, sin, cos, tan and atan, and a rounding mode R (a
+ * template parameter, see crlibm.hpp, so that its dispatch compiles
+ * away), this header adds to those of crlibm.hpp the overloads
+ *
+ *   __m128d crlibm::exp<R>(__m128d)                  (SSE2)
+ *   __m256d crlibm::exp<R>(__m256d)                  (if compiled for AVX)
+ *   __m512d crlibm::exp<R>(__m512d)                  (if compiled for AVX-512)
+ *   simd<double, Abi> crlibm::exp<R>(simd<double, Abi>)
+ *                                      (if <experimental/simd> is available)
+ *
+ * and the shorthands crlibm::exp_rn(x) etc for these types. They call
+ * the vector variants exported by the library (see vector_abi.h),
+ * which evaluate the quick phase on the whole register and fall back
+ * to the scalar function, hence the accurate phase, for the lanes
+ * which need it. A simd<double> is processed by chunks of the widest
+ * register width the code is compiled for.
+ *
+ * As in crlibm.h, there is no exp_rz: rounding::toward_zero gives the
+ * exponential rounded downwards.
+ *
+ * This requires C++17, x86-64, and a library configured with the
+ * vector variants (the default with gcc on x86-64).
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef CRLIBM_SIMD_HPP
+#define CRLIBM_SIMD_HPP
+
+#if !defined(__x86_64__)
+#error "crlibm_simd.hpp: the vector variants exist only on x86-64"
+#endif
+#if __cplusplus < 201703L
+#error "crlibm_simd.hpp requires C++17"
+#endif
+
+#include <cstddef>
+#include <immintrin.h>
+#include "crlibm.hpp"
+
+#if defined(__has_include)
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+#endif
+#if defined(__cpp_lib_experimental_parallel_simd)
+#define CRLIBM_HAS_STD_SIMD 1
+#endif
+
+
+/* The vector variants, named after the x86-64 vector function ABI */
+#define CRLIBM_SIMD_DECLARE(f)                          \
+  __m128d _ZGVbN2v_##f(__m128d);                        \
+  __m256d _ZGVcN4v_##f(__m256d);                        \
+  __m256d _ZGVdN4v_##f(__m256d);                        \
+  __m512d _ZGVeN8v_##f(__m512d);
+
+extern "C" {
+CRLIBM_SIMD_DECLARE(exp_rn) CRLIBM_SIMD_DECLARE(exp_ru) CRLIBM_SIMD_DECLARE(exp_rd)
+CRLIBM_SIMD_DECLARE(log_rn) CRLIBM_SIMD_DECLARE(log_ru) CRLIBM_SIMD_DECLARE(log_rd) CRLIBM_SIMD_DECLARE(log_rz)
+CRLIBM_SIMD_DECLARE(sin_rn) CRLIBM_SIMD_DECLARE(sin_ru) CRLIBM_SIMD_DECLARE(sin_rd) CRLIBM_SIMD_DECLARE(sin_rz)
+CRLIBM_SIMD_DECLARE(cos_rn) CRLIBM_SIMD_DECLARE(cos_ru) CRLIBM_SIMD_DECLARE(cos_rd) CRLIBM_SIMD_DECLARE(cos_rz)
+CRLIBM_SIMD_DECLARE(tan_rn) CRLIBM_SIMD_DECLARE(tan_ru) CRLIBM_SIMD_DECLARE(tan_rd) CRLIBM_SIMD_DECLARE(tan_rz)
+CRLIBM_SIMD_DECLARE(atan_rn) CRLIBM_SIMD_DECLARE(atan_ru) CRLIBM_SIMD_DECLARE(atan_rd) CRLIBM_SIMD_DECLARE(atan_rz)
+}
+
+
+namespace crlibm {
+
+namespace detail {
+
+#if defined(__AVX512F__)
+  constexpr std::size_t simd_chunk = 8;
+#elif defined(__AVX__)
+  constexpr std::size_t simd_chunk = 4;
+#else
+  constexpr std::size_t simd_chunk = 2;
+#endif
+
+#if CRLIBM_HAS_STD_SIMD
+  /* Applies f to the lanes of x, by chunks of simd_chunk lanes (the
+     last one padded with ones, which are regular for all the
+     functions) */
+  template <class Abi, class F>
+  inline std::experimental::simd<double, Abi>
+  on_chunks(const std::experimental::simd<double, Abi>& x, F f) {
+    constexpr std::size_t n = std::experimental::simd<double, Abi>::size();
+    constexpr std::size_t nc = (n + simd_chunk - 1) / simd_chunk * simd_chunk;
+    alignas(64) double buf[nc];
+    std::size_t i;
+    x.copy_to(buf, std::experimental::element_aligned);
+    for(i = n; i < nc; i++)
+      buf[i] = 1.0;
+    for(i = 0; i < nc; i += simd_chunk) {
+#if defined(__AVX512F__)
+      _mm512_store_pd(buf + i, f(_mm512_load_pd(buf + i)));
+#elif defined(__AVX__)
+      _mm256_store_pd(buf + i, f(_mm256_load_pd(buf + i)));
+#else
+      _mm_store_pd(buf + i, f(_mm_load_pd(buf + i)));
+#endif
+    }
+    return std::experimental::simd<double, Abi>(buf, std::experimental::element_aligned);
+  }
+#endif
+
+} /* namespace detail */
+
+
+#if defined(__AVX2__)
+#define CRLIBM_SIMD_256(f) _ZGVdN4v_##f
+#else
+#define CRLIBM_SIMD_256(f) _ZGVcN4v_##f
+#endif
+
+#define CRLIBM_SIMD_SELECT(prefix, rn, ru, rd, rz, x)                   \
+  if constexpr (R == rounding::to_nearest) return prefix(rn)(x);        \
+  else if constexpr (R == rounding::up)    return prefix(ru)(x);        \
+  else if constexpr (R == rounding::down)  return prefix(rd)(x);        \
+  else                                     return prefix(rz)(x);
+
+#define CRLIBM_SIMD_128(f) _ZGVbN2v_##f
+#define CRLIBM_SIMD_512(f) _ZGVeN8v_##f
+
+#if defined(__AVX512F__)
+#define CRLIBM_SIMD_FUNCTION_512(f, rn, ru, rd, rz)                     \
+  template <rounding R> inline __m512d f(__m512d x) {                   \
+    CRLIBM_SIMD_SELECT(CRLIBM_SIMD_512, rn, ru, rd, rz, x)              \
+  }
+#else
+#define CRLIBM_SIMD_FUNCTION_512(f, rn, ru, rd, rz)
+#endif
+
+#if defined(__AVX__)
+#define CRLIBM_SIMD_FUNCTION_256(f, rn, ru, rd, rz)                     \
+  template <rounding R> inline __m256d f(__m256d x) {                   \
+    CRLIBM_SIMD_SELECT(CRLIBM_SIMD_256, rn, ru, rd, rz, x)              \
+  }
+#else
+#define CRLIBM_SIMD_FUNCTION_256(f, rn, ru, rd, rz)
+#endif
+
+#if CRLIBM_HAS_STD_SIMD
+#define CRLIBM_SIMD_FUNCTION_STD(f)                                     \
+  template <rounding R, class Abi>                                      \
+  inline std::experimental::simd<double, Abi>                           \
+  f(const std::experimental::simd<double, Abi>& x) {                    \
+    return detail::on_chunks(x, [](auto v) { return f<R>(v); });        \
+  }
+#else
+#define CRLIBM_SIMD_FUNCTION_STD(f)
+#endif
+
+#define CRLIBM_SIMD_FUNCTION(f, rn, ru, rd, rz)                         \
+  template <rounding R> inline __m128d f(__m128d x) {                   \
+    CRLIBM_SIMD_SELECT(CRLIBM_SIMD_128, rn, ru, rd, rz, x)              \
+  }                                                                     \
+  CRLIBM_SIMD_FUNCTION_256(f, rn, ru, rd, rz)                           \
+  CRLIBM_SIMD_FUNCTION_512(f, rn, ru, rd, rz)                           \
+  CRLIBM_SIMD_FUNCTION_STD(f)
+
+CRLIBM_SIMD_FUNCTION(exp,  exp_rn,  exp_ru,  exp_rd,  exp_rd)
+CRLIBM_SIMD_FUNCTION(log,  log_rn,  log_ru,  log_rd,  log_rz)
+CRLIBM_SIMD_FUNCTION(sin,  sin_rn,  sin_ru,  sin_rd,  sin_rz)
+CRLIBM_SIMD_FUNCTION(cos,  cos_rn,  cos_ru,  cos_rd,  cos_rz)
+CRLIBM_SIMD_FUNCTION(tan,  tan_rn,  tan_ru,  tan_rd,  tan_rz)
+CRLIBM_SIMD_FUNCTION(atan, atan_rn, atan_ru, atan_rd, atan_rz)
+
+
+/* The shorthands, for the vector types only */
+#define CRLIBM_SIMD_SHORTHAND(name, f, R)                               \
+  template <class V> inline auto name(const V& x) -> decltype(f<R>(x)) { \
+    return f<R>(x);                                                     \
+  }
+
+CRLIBM_SIMD_SHORTHAND(exp_rn,  exp,  rounding::to_nearest)
+CRLIBM_SIMD_SHORTHAND(exp_ru,  exp,  rounding::up)
+CRLIBM_SIMD_SHORTHAND(exp_rd,  exp,  rounding::down)
+CRLIBM_SIMD_SHORTHAND(log_rn,  log,  rounding::to_nearest)
+CRLIBM_SIMD_SHORTHAND(log_ru,  log,  rounding::up)
+CRLIBM_SIMD_SHORTHAND(log_rd,  log,  rounding::down)
+CRLIBM_SIMD_SHORTHAND(log_rz,  log,  rounding::toward_zero)
+CRLIBM_SIMD_SHORTHAND(sin_rn,  sin,  rounding::to_nearest)
+CRLIBM_SIMD_SHORTHAND(sin_ru,  sin,  rounding::up)
+CRLIBM_SIMD_SHORTHAND(sin_rd,  sin,  rounding::down)
+CRLIBM_SIMD_SHORTHAND(sin_rz,  sin,  rounding::toward_zero)
+CRLIBM_SIMD_SHORTHAND(cos_rn,  cos,  rounding::to_nearest)
+CRLIBM_SIMD_SHORTHAND(cos_ru,  cos,  rounding::up)
+CRLIBM_SIMD_SHORTHAND(cos_rd,  cos,  rounding::down)
+CRLIBM_SIMD_SHORTHAND(cos_rz,  cos,  rounding::toward_zero)
+CRLIBM_SIMD_SHORTHAND(tan_rn,  tan,  rounding::to_nearest)
+CRLIBM_SIMD_SHORTHAND(tan_ru,  tan,  rounding::up)
+CRLIBM_SIMD_SHORTHAND(tan_rd,  tan,  rounding::down)
+CRLIBM_SIMD_SHORTHAND(tan_rz,  tan,  rounding::toward_zero)
+CRLIBM_SIMD_SHORTHAND(atan_rn, atan, rounding::to_nearest)
+CRLIBM_SIMD_SHORTHAND(atan_ru, atan, rounding::up)
+CRLIBM_SIMD_SHORTHAND(atan_rd, atan, rounding::down)
+CRLIBM_SIMD_SHORTHAND(atan_rz, atan, rounding::toward_zero)
+
+} /* namespace crlibm */
+
+#undef CRLIBM_SIMD_DECLARE
+#undef CRLIBM_SIMD_256
+#undef CRLIBM_SIMD_128
+#undef CRLIBM_SIMD_512
+#undef CRLIBM_SIMD_SELECT
+#undef CRLIBM_SIMD_FUNCTION_512
+#undef CRLIBM_SIMD_FUNCTION_256
+#undef CRLIBM_SIMD_FUNCTION_STD
+#undef CRLIBM_SIMD_FUNCTION
+#undef CRLIBM_SIMD_SHORTHAND
+
+#endif /* CRLIBM_SIMD_HPP */
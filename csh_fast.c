@@ -28,6 +28,9 @@
 #include "crlibm_private.h"
 #include "csh_fast.h"
 #include "triple-double.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
 
 void exp13(int *exponent, double *exp_h, double *exp_m, double *exp_l, double x);
 void expm1_13(double *exp_h, double *exp_m, double *exp_l, double x);
@@ -233,7 +236,7 @@ double cosh_rn(double x){
   do_cosh(x, &rh, &rl);
 
   
-  if (rh == (rh + (rl * round_cst_csh))) return rh;
+  if (QUICK_PHASE && rh == (rh + (rl * round_cst_csh))) return rh;
   else{
     int exponent;
     db_number res;
@@ -585,7 +588,7 @@ double sinh_rn(double x){
   
   do_sinh(x, &rh, &rl);
 
-  if (rh == (rh + (rl * round_cst_csh))) return rh;
+  if (QUICK_PHASE && rh == (rh + (rl * round_cst_csh))) return rh;
   else{
     int exponent;
     db_number res;
@@ -719,3 +722,178 @@ double sinh_rz(double x){
   }
 }
 
+
+
+/* Functions cosh_td, sinh_td, cosh_dd and sinh_dd, see crlibm.h
+
+   The accurate phases, scaled by 2^(exponent-1), with a relative
+   error below 2^-110. Below 2^-40 the first terms of the Taylor series
+   are accurate enough. */
+
+static void csh_td(double *resh, double *resm, double *resl, double x, int sine){
+  db_number y;
+  int hx, exponent;
+
+  y.d = x;
+  hx = y.i[HI] & 0x7FFFFFFF;
+  *resm = 0;
+  *resl = 0;
+
+  if (hx >= 0x7ff00000){  /* Infty or NaN */
+    if (((hx&0x000fffff)|y.i[LO])!=0)
+      *resh = x+x;                                         /* NaN */
+    else
+      *resh = (sine) ? x : x*x;                             /* Infty */
+    return;
+  }
+  if (x >= max_input_csh.d || x <= -max_input_csh.d) {
+    *resh = largest_double * largest_double;               /* overflow */
+    if (sine && x < 0)
+      *resh = -*resh;
+    return;
+  }
+  if (hx < 0x3d700000) {                                   /* |x| < 2^-40 */
+    if (sine) {
+      *resh = x;
+      *resm = x*(x*x*(1.0/6.0));
+    }
+    else {
+      *resh = 1.0;
+      *resm = 0.5*x*x;
+    }
+    return;
+  }
+
+  if (sine)
+    do_sinh_accurate(&exponent, resh, resm, resl, x);
+  else
+    do_cosh_accurate(&exponent, resh, resm, resl, x);
+  Scale3(*resh, *resm, *resl, exponent-1);
+}
+
+void cosh_td(double *resh, double *resm, double *resl, double x){
+  csh_td(resh, resm, resl, x, 0);
+}
+
+void sinh_td(double *resh, double *resm, double *resl, double x){
+  csh_td(resh, resm, resl, x, 1);
+}
+
+void cosh_dd(double *resh, double *resl, double x){
+  double resm, resll;
+
+  csh_td(resh, &resm, &resll, x, 0);
+  *resl = resm + resll;
+}
+
+void sinh_dd(double *resh, double *resl, double x){
+  double resm, resll;
+
+  csh_td(resh, &resm, &resll, x, 1);
+  *resl = resm + resll;
+}
+
+
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Quick phases for one bound of an interval. Outside the domain of
+   do_cosh and do_sinh we set rh = rl = 0: the rounding test then
+   fails and the bound is left to the scalar function. */
+static void do_cosh_bound(double x, double* prh, double* prl){
+  db_number y;
+  int hx;
+
+  y.d = x;
+  hx = y.i[HI] & 0x7FFFFFFF;
+  if ((hx < 0x3e500000) || (hx >= 0x7FF00000)
+      || (x >= max_input_csh.d) || (x <= -max_input_csh.d)) {
+    *prh = 0.0;
+    *prl = 0.0;
+    return;
+  }
+  do_cosh(x, prh, prl);
+}
+
+static void do_sinh_bound(double x, double* prh, double* prl){
+  db_number y;
+  int hx;
+
+  y.d = x;
+  hx = y.i[HI] & 0x7FFFFFFF;
+  if ((hx < 0x3e500000) || (hx >= 0x7FF00000)
+      || (x > max_input_csh.d) || (x < -max_input_csh.d)) {
+    *prh = 0.0;
+    *prl = 0.0;
+    return;
+  }
+  do_sinh(x, prh, prl);
+}
+
+
+
+interval j_sinh(interval x)
+{
+  interval res;
+  double x_inf, x_sup, rh_inf, rl_inf, rh_sup, rl_sup, res_inf, res_sup;
+  int roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+  if (!(x_inf<=x_sup)) RETURN_EMPTY_INTERVAL;
+
+  /* sinh is increasing: evaluate both bounds, then launch the
+     accurate phase only for the ones whose rounding test failed */
+  do_sinh_bound(x_inf, &rh_inf, &rl_inf);
+  do_sinh_bound(x_sup, &rh_sup, &rl_sup);
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, rh_inf, rl_inf, res_sup, rh_sup, rl_sup, maxepsilon_csh, maxepsilon_csh);
+  if ((roundable & 1) == 0) res_inf = sinh_rd(x_inf);
+  if ((roundable & 2) == 0) res_sup = sinh_ru(x_sup);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+
+
+
+interval j_cosh(interval x)
+{
+  interval res;
+  double x_inf, x_sup, x_lo, x_hi, rh_inf, rl_inf, rh_sup, rl_sup, res_inf, res_sup;
+  int roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+  if (!(x_inf<=x_sup)) RETURN_EMPTY_INTERVAL;
+
+  /* cosh is even: work on the absolute values of the bounds */
+  if (x_inf >= 0) {
+    x_lo = x_inf;
+    x_hi = x_sup;
+  }
+  else if (x_sup <= 0) {
+    x_lo = -x_sup;
+    x_hi = -x_inf;
+  }
+  else {
+    /* The minimum cosh(0) = 1 is inside the interval */
+    if (-x_inf > x_sup) x_hi = -x_inf; else x_hi = x_sup;
+    ASSIGN_LOW(res,1.0);
+    ASSIGN_UP(res,cosh_ru(x_hi));
+    return res;
+  }
+
+  do_cosh_bound(x_lo, &rh_inf, &rl_inf);
+  do_cosh_bound(x_hi, &rh_sup, &rl_sup);
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, rh_inf, rl_inf, res_sup, rh_sup, rl_sup, maxepsilon_csh, maxepsilon_csh);
+  if ((roundable & 1) == 0) res_inf = cosh_rd(x_lo);
+  if ((roundable & 2) == 0) res_sup = cosh_ru(x_hi);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
@@ -75,7 +75,7 @@ case). However it uses a coarser error estimation.
   yh = (double) y;                          \
   yl = y-yh;                                \
   BACK_TO_DOUBLE_MODE;                      \
-  if(yh==yh + yl*rncst)   return yh;        \
+  if(QUICK_PHASE && yh==yh + yl*rncst)   return yh;\
   DOUBLE_EXTENDED_MODE;                     \
 }
 
@@ -87,7 +87,7 @@ case). However it uses a coarser error estimation.
   _z.d = _y;                                                \
   _yd = (double) _y;                                        \
   _lo = _z.i[DE_MANTISSA_LO] &(_mask);                      \
-  if((_lo!=(0x3ff&(_mask))) && (_lo!= (0x400&(_mask)))) {   \
+  if(QUICK_PHASE && (_lo!=(0x3ff&(_mask))) && (_lo!= (0x400&(_mask)))) {\
     BACK_TO_DOUBLE_MODE;                                    \
     return _yd;                                             \
   }                                                         \
@@ -102,7 +102,7 @@ case). However it uses a coarser error estimation.
   DOUBLE_DOWN_MODE;                                                             \
   _bits = _z.i[DE_MANTISSA_LO] &(_mask);     			                \
   _result = (double)(_y);	                                                \
-  if( (_bits != (0xfff&(_mask)))  && (_bits != (0x000&(_mask))) ) {             \
+  if(QUICK_PHASE && (_bits != (0xfff&(_mask)))  && (_bits != (0x000&(_mask))) ) {\
     BACK_TO_DOUBLE_MODE;	                                                \
     return _result;                                                             \
     }                                                                           \
@@ -116,7 +116,7 @@ case). However it uses a coarser error estimation.
   DOUBLE_UP_MODE;                                                               \
   _bits = _z.i[DE_MANTISSA_LO] &(_mask);     			                \
   _result = (double)(_y);	                                                \
-  if( (_bits != (0xfff&(_mask)))  && (_bits != (0x000&(_mask))) ) {             \
+  if(QUICK_PHASE && (_bits != (0xfff&(_mask)))  && (_bits != (0x000&(_mask))) ) {\
     BACK_TO_DOUBLE_MODE;	                                                \
     return _result;                                                             \
     }                                                                           \
@@ -134,7 +134,7 @@ case). However it uses a coarser error estimation.
   _z.d = _ytest;                                             \
   _y_return_d = (double) (_yreturn);                         \
   _bits = _z.i[DE_MANTISSA_LO] &(_mask);                     \
-  if((_bits!=(0x3ff&(_mask))) && (_bits!= (0x400&(_mask)))) {\
+  if(QUICK_PHASE && (_bits!=(0x3ff&(_mask))) && (_bits!= (0x400&(_mask)))) {\
     BACK_TO_DOUBLE_MODE;                                     \
     return _y_return_d;                                      \
   }                                                          \
@@ -0,0 +1,37 @@
+/*
+ * The tables of 2^(i/2^12) and 2^(j/2^6) in triple-double
+ *
+ * They are shared by the exponential (exp-td.h) and expm1 (expm1.h),
+ * and so by their standalone and vector versions, which used to have a
+ * static copy each: a process which calls several of them keeps one
+ * copy in the caches. They are defined in exp-tables.c, generated by
+ * maple/exp-td.mpl, each starting a cache line.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or 
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  
+ */
+
+#ifndef EXP_TABLES_H
+#define EXP_TABLES_H
+
+typedef struct tPi_t_tag {double hi; double mi; double lo;} tPi_t;  
+
+/* twoPowerIndex1[i] = 2^(i/2^12), twoPowerIndex2[j] = 2^(j/2^6) */
+extern const tPi_t twoPowerIndex1[64];
+extern const tPi_t twoPowerIndex2[64];
+
+#endif /* EXP_TABLES_H */
@@ -85,3 +85,52 @@ void exp13(int *exponent, double *exph, double *expm, double *expl, double x) {
 
   *exponent = M;
 }
+
+
+/* Functions exp_td and exp_dd, see crlibm.h
+
+   The triple-double of exp13 is scaled by 2^exponent. Its relative
+   error, below 2^-113, is kept as long as the lowest part is not
+   subnormal, which holds for x > -634. Below, the lower parts lose
+   bits to subnormals: the double-double is still accurate to 2^-104
+   for x > -671. */
+
+void exp_td(double *resh, double *resm, double *resl, double x) {
+  db_number xdb;
+  int exponent;
+
+  xdb.d = x;
+  *resm = 0;
+  *resl = 0;
+  if ((xdb.i[HI] & 0x7fffffff) >= 0x7ff00000) {
+    if ((xdb.i[HI] & 0x80000000) && ((xdb.i[HI] & 0x000fffff) | xdb.i[LO]) == 0)
+      *resh = 0;                /* exp(-Inf) = 0 */
+    else
+      *resh = x + x;            /* +Inf or NaN */
+    return;
+  }
+  if ((xdb.i[HI] & 0x7ff00000) == 0) {
+    /* zero or subnormal: exp(x) = 1 + x within 2^-2000 */
+    *resh = 1.0;
+    *resm = x;
+    return;
+  }
+  if (x > OVRFLWBOUND) {
+    *resh = LARGEST * LARGEST;
+    return;
+  }
+  if (x <= UNDERFLWBOUND) {
+    *resh = SMALLEST * SMALLEST;
+    return;
+  }
+
+  exp13(&exponent, resh, resm, resl, x);
+  Scale3(*resh, *resm, *resl, exponent);
+}
+
+void exp_dd(double *resh, double *resl, double x) {
+  double resm, resll;
+
+  exp_td(resh, &resm, &resll, x);
+  *resl = resm + resll;
+}
@@ -22,6 +22,7 @@
 #include "crlibm_private.h"
 #include "triple-double.h"
 #include "exp-td.h"
+#include "vector_abi.h"
 #ifdef BUILD_INTERVAL_FUNCTIONS
 #include "interval.h"
 #endif
@@ -348,7 +349,7 @@ double exp_rn(double x){
      the problem of the non-representability of 2^1024 if M = 1024
   */
 
-  if(polyTblh == (polyTblh + (polyTblm * ROUNDCST))) {
+  if(QUICK_PHASE && polyTblh == (polyTblh + (polyTblm * ROUNDCST))) {
     polyTblhdb.d = polyTblh;
     polyTblhdb.i[HI] += M << 20;
     return polyTblhdb.d;
@@ -994,7 +995,192 @@ double exp_rd(double x) {
 } 
  
 
-#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Round to odd, see RETURN_RO_FROM_RZ in crlibm_private.h: the
+   exponential is exact only for x=0 and x=-Inf */
+double exp_ro(double x) {
+  if ((x == 0.0) || (x == -1.0/0.0))
+    return exp_rd(x);
+  RETURN_RO_FROM_RZ(exp_rd(x));
+}
+
+
+
+/*************************************************************
+ *************************************************************
+ *       DOUBLE-DOUBLE ARGUMENT, ROUNDED TO NEAREST          *
+ *************************************************************
+ *************************************************************/
+
+/* exp(xh + xl) for a double-double with |xl| <= ulp(xh)/2.
+
+   The special cases are decided on xh, but for the two bounds
+   OVRFLWBOUND and UNDERFLWBOUND themselves, where the sign and size
+   of xl decide whether the result overflows or underflows to zero:
+   exp(OVRFLWBOUND + xl) rounds to +Inf iff xl >= XL_OVRFLW, and
+   exp(UNDERFLWBOUND + xl) rounds to the smallest denormal iff
+   xl >= XL_UNDERFLW.
+
+   k is computed from xh alone, and xl is added to both argument
+   reductions: the reduced argument is then larger than log(2)/2^(L+1)
+   by at most ulp(xh)/2, which the polynomials do not notice. The
+   addition to the quick phase reduction is exact if k=0 and costs one
+   more rounding error of 2^-78 else, negligible before the 2^-63 of
+   the quick phase, so ROUNDCST is kept. */
+
+#define XL_OVRFLW   0x1.aac9e3b398040p-46
+#define XL_UNDERFLW 0x1.04e7ce353629ep-46
+
+double exp_dd_rn(double xh, double xl){
+  double rh, rm, rl, tbl1h, tbl1m, tbl1l;
+  double tbl2h, tbl2m, tbl2l;
+  double xMultLog2InvMult2L, shiftedXMult, kd;
+  double msLog2Div2LMultKh, msLog2Div2LMultKm, msLog2Div2LMultKl;
+  double t1, t2, t3, t4, polyTblh, polyTblm, polyTbll;
+  db_number shiftedXMultdb, twoPowerMdb, xdb, t4db, t4db2, polyTblhdb, resdb;
+  int k, M, index1, index2, xIntHi, mightBeDenorm;
+  double t5, t6, t7, t8, t9, t10, t11, t12, t13;
+  double rhSquare, rhSquareHalf, rhC3, rhFour, monomialCube;
+  double highPoly, highPolyWithSquare, monomialFour;
+  double tablesh, tablesl;
+  double res;
+  /* Cody and Waite like, accurate to 2^-84 */
+  double Log2h= 0xb.17217f8p-16 ;
+  double Log2l= -0x2.e308654361c4cp-48 ;
+
+  xdb.d = xh;
+  xMultLog2InvMult2L = xh * log2InvMult2L;
+  shiftedXMult = xMultLog2InvMult2L + shiftConst;
+  kd = shiftedXMult - shiftConst;
+  shiftedXMultdb.d = shiftedXMult;
+
+  xIntHi = xdb.i[HI];
+  mightBeDenorm = 0;
+  /* Argument denormal or zero: then xl = 0 */
+  if ((xIntHi & 0x7ff00000) == 0)
+    return 1.0;
+
+  if ((xIntHi & 0x7fffffff) >= OVRUDRFLWSMPLBOUND) {
+    if ((xIntHi & 0x7fffffff) >= 0x7ff00000) {
+      if (((xIntHi & 0x000fffff) | xdb.i[LO]) != 0)
+	return xh + xh;
+      if ((xIntHi & 0x80000000)==0)
+	return xh;
+      else
+	return 0;
+    }
+    if ((xh > OVRFLWBOUND) || ((xh == OVRFLWBOUND) && (xl >= XL_OVRFLW)))
+      return LARGEST * LARGEST;
+    if (xh < UNDERFLWBOUND)
+      return SMALLEST * SMALLEST;
+    if (xh == UNDERFLWBOUND)
+      return (xl >= XL_UNDERFLW) ? SMALLEST : SMALLEST * SMALLEST;
+    if (xh <= DENORMBOUND)
+      mightBeDenorm = 1;
+  }
+
+  Add12Cond(rh,rm, xh-kd*Log2h, -kd*Log2l + xl);
+
+  k = shiftedXMultdb.i[LO];
+  M = k >> L;
+  index1 = k & INDEXMASK1;
+  index2 = (k & INDEXMASK2) >> LHALF;
+
+  tbl1h = twoPowerIndex1[index1].hi;
+  tbl1m = twoPowerIndex1[index1].mi;
+  tbl2h = twoPowerIndex2[index2].hi;
+  tbl2m = twoPowerIndex2[index2].mi;
+
+  if (mightBeDenorm == 0) {
+    /* Quick phase, as in exp_rn */
+    rhSquare = rh * rh;
+    rhC3 = c3 * rh;
+    rhSquareHalf = 0.5 * rhSquare;
+    monomialCube = rhC3 * rhSquare;
+    rhFour = rhSquare * rhSquare;
+    monomialFour = c4 * rhFour;
+    highPoly = monomialCube + monomialFour;
+    highPolyWithSquare = rhSquareHalf + highPoly;
+
+    Mul22(&tablesh,&tablesl,tbl1h,tbl1m,tbl2h,tbl2m);
+
+    t8 = rm + highPolyWithSquare;
+    t9 = rh + t8;
+    t10 = tablesh * t9;
+    Add12(t11,t12,tablesh,t10);
+    t13 = t12 + tablesl;
+    Add12(polyTblh,polyTblm,t11,t13);
+
+    if(QUICK_PHASE && polyTblh == (polyTblh + (polyTblm * ROUNDCST))) {
+      polyTblhdb.d = polyTblh;
+      polyTblhdb.i[HI] += M << 20;
+      return polyTblhdb.d;
+    }
+  }
+
+  /* Accurate phase: the reduction of exp_rn, to which xl is added */
+  Mul133(&msLog2Div2LMultKh,&msLog2Div2LMultKm,&msLog2Div2LMultKl,kd,msLog2Div2Lh,msLog2Div2Lm,msLog2Div2Ll);
+  t1 = xh + msLog2Div2LMultKh;
+  Add12Cond(rh,t2,t1,msLog2Div2LMultKm);
+  Add12Cond(rm,rl,t2,msLog2Div2LMultKl);
+  Add133Cond(&t3,&t5,&t6,xl,rh,rm,rl);
+  Renormalize3(&rh,&rm,&rl,t3,t5,t6);
+
+  tbl1l = twoPowerIndex1[index1].lo;
+  tbl2l = twoPowerIndex2[index2].lo;
+
+  exp_td_accurate(&polyTblh, &polyTblm, &polyTbll, rh, rm, rl, tbl1h, tbl1m, tbl1l, tbl2h, tbl2m, tbl2l);
+
+  if (mightBeDenorm == 0) {
+    RoundToNearest3(&res,polyTblh,polyTblm,polyTbll);
+    resdb.d = res;
+    resdb.i[HI] += M << 20;
+    return resdb.d;
+  }
+
+  /* Denormal result, see exp_rn */
+  t3 = polyTblh * twoPowerM1000;
+  twoPowerMdb.i[LO] = 0;
+  twoPowerMdb.i[HI] = (M + 2023) << 20;
+  t4 = t3 * twoPowerMdb.d;
+
+  t4db.d = t4;   /* Do not #if-ify this line, we need the copy */
+#if defined(CRLIBM_TYPECPU_AMD64) || defined(CRLIBM_TYPECPU_X86)
+  t4db2.i[HI] = t4db.i[HI];
+  t4db2.i[LO] = t4db.i[LO];
+  t4 = t4db2.d;
+#endif
+
+  M *= -1;
+  twoPowerMdb.i[LO] = 0;
+  twoPowerMdb.i[HI] = (M + 23) << 20;
+  t5 = t4 * twoPowerMdb.d;
+  t6 = t5 * twoPower1000;
+  t7 = polyTblh - t6;
+
+  twoPowerMdb.i[LO] = 0;
+  twoPowerMdb.i[HI] = (M - 52) << 20;
+
+  if (ABS(t7) != twoPowerMdb.d) return t4;
+
+  polyTblm = polyTblm + polyTbll;
+
+  if (t7 > 0.0) {
+    if (polyTblm > 0.0) {
+      t4db.l++;
+      return t4db.d;
+    } else return t4;
+  } else {
+    if (polyTblm < 0.0) {
+      t4db.l--;
+      return t4db.d;
+    } else return t4;
+  }
+}
+
+
+/* Interleaved scalar version; with the vector variants, j_exp is 
+   defined below on the lane kernel */
+#if defined(BUILD_INTERVAL_FUNCTIONS) && !defined(BUILD_VECTOR_ABI)
 interval j_exp(interval x)
 {
   interval res;
@@ -1361,3 +1547,428 @@ interval j_exp(interval x)
 }
 #endif
 
+
+
+
+/*************************************************************
+ *************************************************************
+ *               BATCH VERSIONS                              *
+ *************************************************************
+ *************************************************************/
+
+/* The batch versions compute res[i]=exp(x[i]) for 0<=i<n.
+
+   The inputs are processed by blocks of EXP_BATCH_BLOCK lanes. A
+   first pass partitions the lanes of a block without any
+   data-dependent branch: zero and denormal arguments, arguments
+   larger than approx. 709 in magnitude (which might overflow,
+   underflow or have a denormal result), infinities and NaNs are
+   appended to a list of special lanes, handled by the scalar
+   function; all the other lanes are appended to a compacted list of
+   regular lanes. The quick phase is then run on the regular lanes by
+   a homogeneous loop, the rounding test is performed lane-wise, and
+   only the lanes which fail it are handed to the scalar function,
+   which will launch the accurate phase.
+*/
+
+#define EXP_BATCH_BLOCK 256
+
+static void exp_batch(double *res, const double *x, int n, int mode) {
+  int regular[EXP_BATCH_BLOCK], special[EXP_BATCH_BLOCK], failed[EXP_BATCH_BLOCK];
+  int Mb[EXP_BATCH_BLOCK];
+  double polyTblhb[EXP_BATCH_BLOCK], polyTblmb[EXP_BATCH_BLOCK];
+  double rh, rm, tbl1h, tbl1m, tbl2h, tbl2m, kd, xi;
+  double t8, t9, t10, t11, t12, t13;
+  double rhSquare, rhSquareHalf, rhC3, rhFour, monomialCube;
+  double highPoly, highPolyWithSquare, monomialFour;
+  double tablesh, tablesl;
+  double (*scalar)(double);
+  const double *xb;
+  double *resb;
+  db_number xdb, shiftedXMultdb, resdb;
+  int k, index1, index2, xIntHi, isregular, roundable;
+  int nb, nregular, nspecial, nfailed, i, j, base;
+
+  /* Cody and Waite like, accurate to 2^-84 */
+  double Log2h= 0xb.17217f8p-16 ;
+  double Log2l= -0x2.e308654361c4cp-48 ;
+
+  if(mode==CRLIBM_RN)      scalar = exp_rn;
+  else if(mode==CRLIBM_RU) scalar = exp_ru;
+  else                     scalar = exp_rd;
+
+  for(base=0; base<n; base+=EXP_BATCH_BLOCK) {
+    nb = (n-base < EXP_BATCH_BLOCK) ? n-base : EXP_BATCH_BLOCK;
+    xb = x + base;
+    resb = res + base;
+
+    /* Partition of the lanes */
+    nregular = 0;
+    nspecial = 0;
+    for(i=0; i<nb; i++) {
+      xdb.d = xb[i];
+      xIntHi = xdb.i[HI] & 0x7fffffff;
+      isregular = ((xIntHi & 0x7ff00000) != 0) & (xIntHi < OVRUDRFLWSMPLBOUND);
+      regular[nregular] = i;
+      special[nspecial] = i;
+      nregular += isregular;
+      nspecial += !isregular;
+    }
+
+    for(j=0; j<nspecial; j++) {
+      i = special[j];
+      resb[i] = scalar(xb[i]);
+    }
+
+    /* Quick phase on the regular lanes, see exp_rn */
+    for(j=0; j<nregular; j++) {
+      xi = xb[regular[j]];
+      shiftedXMultdb.d = xi * log2InvMult2L + shiftConst;
+      kd = shiftedXMultdb.d - shiftConst;
+      Add12Cond(rh,rm, xi-kd*Log2h, -kd*Log2l);
+
+      k = shiftedXMultdb.i[LO];
+      Mb[j] = k >> L;
+      index1 = k & INDEXMASK1;
+      index2 = (k & INDEXMASK2) >> LHALF;
+
+      tbl1h = twoPowerIndex1[index1].hi;
+      tbl1m = twoPowerIndex1[index1].mi;
+      tbl2h = twoPowerIndex2[index2].hi;
+      tbl2m = twoPowerIndex2[index2].mi;
+
+      rhSquare = rh * rh;
+      rhC3 = c3 * rh;
+      rhSquareHalf = 0.5 * rhSquare;
+      monomialCube = rhC3 * rhSquare;
+      rhFour = rhSquare * rhSquare;
+      monomialFour = c4 * rhFour;
+      highPoly = monomialCube + monomialFour;
+      highPolyWithSquare = rhSquareHalf + highPoly;
+
+      Mul22(&tablesh,&tablesl,tbl1h,tbl1m,tbl2h,tbl2m);
+
+      t8 = rm + highPolyWithSquare;
+      t9 = rh + t8;
+      t10 = tablesh * t9;
+      Add12(t11,t12,tablesh,t10);
+      t13 = t12 + tablesl;
+      Add12(polyTblhb[j],polyTblmb[j],t11,t13);
+    }
+
+    /* Lane-wise rounding test and multiplication with 2^M, 
+       implemented in integer computations as in the scalar functions */
+    nfailed = 0;
+    for(j=0; j<nregular; j++) {
+      resdb.d = polyTblhb[j];
+      if(mode==CRLIBM_RN) {
+	roundable = (polyTblhb[j] == (polyTblhb[j] + (polyTblmb[j] * ROUNDCST)));
+      }
+      else if(mode==CRLIBM_RU) {
+	TEST_AND_COPY_RU(roundable,resdb.d,polyTblhb[j],polyTblmb[j],RDROUNDCST);
+      }
+      else {
+	TEST_AND_COPY_RD(roundable,resdb.d,polyTblhb[j],polyTblmb[j],RDROUNDCST);
+      }
+      resdb.i[HI] += Mb[j] << 20;
+      resb[regular[j]] = resdb.d;
+      failed[nfailed] = regular[j];
+      nfailed += !roundable;
+    }
+
+    /* Accurate phase for the lanes which failed the rounding test */
+    for(j=0; j<nfailed; j++) {
+      i = failed[j];
+      resb[i] = scalar(xb[i]);
+    }
+  }
+}
+
+
+void exp_rn_batch(double *res, const double *x, int n){ exp_batch(res, x, n, CRLIBM_RN); }
+void exp_ru_batch(double *res, const double *x, int n){ exp_batch(res, x, n, CRLIBM_RU); }
+void exp_rd_batch(double *res, const double *x, int n){ exp_batch(res, x, n, CRLIBM_RD); }
+
+
+
+#ifdef BUILD_VECTOR_ABI
+/*************************************************************
+ *************************************************************
+ *               VECTOR VERSIONS                             *
+ *************************************************************
+ *************************************************************/
+
+/* The lane kernels of the vector variants, see vector_abi.h: the
+   quick phase of exp_rn etc, where the special lanes compute
+   meaningless values (the table indices stay in range) which are then
+   replaced by the result of the scalar function. The argument
+   reduction takes k from the bits of the shifted value, and the
+   scaling by 2^M is the integer addition of M to the exponent. */
+
+#define EXP_LANES(name, vd, vl, n)                                      \
+VECTOR_KERNEL void name(double *res, const double *x, int mode) {       \
+  vd xv, kd, shifted, rh, rm, tbl1h, tbl1m, tbl2h, tbl2m, yh, yl;       \
+  vd t8, t9, t10, t11, t12, t13;                                        \
+  vd rhSquare, rhSquareHalf, rhC3, rhFour, monomialCube;                \
+  vd highPoly, highPolyWithSquare, monomialFour;                        \
+  vd tablesh, tablesl;                                                  \
+  vl k, index1, index2, xAbs, roundable, fail;                          \
+  int l;                                                                \
+                                                                        \
+  /* Cody and Waite like, accurate to 2^-84 */                          \
+  const double Log2h= 0xb.17217f8p-16 ;                                 \
+  const double Log2l= -0x2.e308654361c4cp-48 ;                          \
+                                                                        \
+  memcpy(&xv, x, sizeof(xv));                                           \
+  xAbs = ((vl) xv) & ULL(7fffffffffffffff);                             \
+                                                                        \
+  shifted = xv * log2InvMult2L + shiftConst;                            \
+  kd = shifted - shiftConst;                                            \
+  k = ((vl) shifted) - ((vl) VSplat(vd, shiftConst));                   \
+  VAdd12Cond(rh, rm, xv - kd*Log2h, kd*(-Log2l));                       \
+                                                                        \
+  index1 = k & INDEXMASK1;                                              \
+  index2 = (k & INDEXMASK2) >> LHALF;                                   \
+  VECTOR_UNROLL                                                         \
+  for(l=0; l<n; l++) {                                                  \
+    tbl1h[l] = twoPowerIndex1[index1[l]].hi;                            \
+    tbl1m[l] = twoPowerIndex1[index1[l]].mi;                            \
+    tbl2h[l] = twoPowerIndex2[index2[l]].hi;                            \
+    tbl2m[l] = twoPowerIndex2[index2[l]].mi;                            \
+  }                                                                     \
+                                                                        \
+  rhSquare = rh * rh;                                                   \
+  rhC3 = c3 * rh;                                                       \
+  rhSquareHalf = 0.5 * rhSquare;                                        \
+  monomialCube = rhC3 * rhSquare;                                       \
+  rhFour = rhSquare * rhSquare;                                         \
+  monomialFour = c4 * rhFour;                                           \
+  highPoly = monomialCube + monomialFour;                               \
+  highPolyWithSquare = rhSquareHalf + highPoly;                         \
+                                                                        \
+  VMul22(tablesh, tablesl, tbl1h, tbl1m, tbl2h, tbl2m);                 \
+                                                                        \
+  t8 = rm + highPolyWithSquare;                                         \
+  t9 = rh + t8;                                                         \
+  t10 = tablesh * t9;                                                   \
+  VAdd12(t11, t12, tablesh, t10);                                       \
+  t13 = t12 + tablesl;                                                  \
+  VAdd12(yh, yl, t11, t13);                                             \
+                                                                        \
+  VTestAndCopy(roundable, yh, yl,                                       \
+               (mode==CRLIBM_RN) ? ROUNDCST : RDROUNDCST, mode, vd, vl); \
+                                                                        \
+  /* Multiplication with 2^M, M = k >> L, in integer computations */    \
+  yh = (vd) (((vl) yh) + ((k & ~ULL(fff)) << (52 - L)));                \
+  memcpy(res, &yh, sizeof(yh));                                         \
+  if(mode==VECTOR_THIN) {                                               \
+    yh = VNextUp(yh, vl);                                               \
+    memcpy(res+n, &yh, sizeof(yh));                                     \
+  }                                                                     \
+                                                                        \
+  fail = ~roundable                                                     \
+    | ((xAbs & ULL(7ff0000000000000)) == 0)                             \
+    | (xAbs >= (((long long int) OVRUDRFLWSMPLBOUND) << 32));           \
+  for(l=0; l<n; l++) {                                                  \
+    if(fail[l]) {                                                       \
+      if(mode==CRLIBM_RN)      res[l] = exp_rn(x[l]);                   \
+      else if(mode==CRLIBM_RU                                           \
+              || (mode==VECTOR_RDRU && (l&1))) res[l] = exp_ru(x[l]);   \
+      else                     res[l] = exp_rd(x[l]);                   \
+      if(mode==VECTOR_THIN)    res[n+l] = exp_ru(x[l]);                 \
+    }                                                                   \
+  }                                                                     \
+}
+
+VECTOR_LANE_KERNELS(EXP_LANES, exp_lanes)
+
+VECTOR_ABI_VARIANTS(exp_rn, exp_lanes, CRLIBM_RN)
+VECTOR_ABI_VARIANTS(exp_ru, exp_lanes, CRLIBM_RU)
+VECTOR_ABI_VARIANTS(exp_rd, exp_lanes, CRLIBM_RD)
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Both bounds in the two lanes of one SSE2 register: the lower one
+   rounded down, the upper one rounded up. The special cases go to
+   exp_rd and exp_ru as in the scalar version. */
+interval j_exp(interval x)
+{
+  interval res;
+  v2df v = VPair(LOW(x), UP(x)), r;
+
+  exp_lanes_2((double *) &r, (const double *) &v, VECTOR_RDRU);
+  ASSIGN_LOW(res,r[0]);
+  ASSIGN_UP(res,r[1]);
+  return res;
+}
+
+/* Any interval goes through the kernels, as in j_exp */
+#define J_EXP_SPECIAL(inf, sup) 0
+
+VECTOR_INTERVAL_BATCH(j_exp, exp_lanes, J_EXP_SPECIAL)
+#endif /* BUILD_INTERVAL_FUNCTIONS */
+
+#endif /* BUILD_VECTOR_ABI */
+
+#if defined(BUILD_INTERVAL_FUNCTIONS) && !defined(BUILD_VECTOR_ABI)
+INTERVAL_BATCH(j_exp)
+#endif
+
+
+
+/*************************************************************
+ *************************************************************
+ *               BINARY32 VERSIONS                           *
+ *************************************************************
+ *************************************************************/
+
+/* expf and expm1f, for a float x, in one step: the argument reduction
+   of exp_rn with the tables of 2^(i/2^12), where r is |r| < 2^-13.5
+   and exact but for the last subtraction, and the polynomial of its
+   quick phase. The result has a relative error below 2^-49 (see
+   TEST_AND_COPY_FLOAT). 
+
+   For exp(x) = 2^M (1+p(r)) * tbl1h * tbl2h, the tables and the final
+   multiplication and addition account for four rounding errors of
+   2^-53. For expm1, the product of the tables is a double-double th +
+   tl, and expm1(x) = (2^M th - 1) + 2^M (tl + th p(r)): around 0,
+   where the cancellation would be a problem, 2^M th - 1 is exact and
+   the second term is computed with a relative error of 2^-53.
+
+   The kernels return 0 for |x| > 104, including Inf and NaN, so that
+   the rounding test fails and the double function is called. */
+
+#define EXPF_XMAX 104.0
+
+static inline double expf_quick(double x, int minusone) {
+  double shifted, kd, r, p, th, tl, y;
+  db_number shifteddb, twoMdb;
+  int k, M, index1, index2;
+  const double Log2h= 0xb.17217f8p-16 ;
+  const double Log2l= -0x2.e308654361c4cp-48 ;
+
+  if(!((x > -EXPF_XMAX) && (x < EXPF_XMAX)))
+    return 0.0;
+
+  shifted = x * log2InvMult2L + shiftConst;
+  kd = shifted - shiftConst;
+  shifteddb.d = shifted;
+  k = shifteddb.i[LO];
+  r = (x - kd*Log2h) - kd*Log2l;
+
+  M = k >> L;
+  index1 = k & INDEXMASK1;
+  index2 = (k & INDEXMASK2) >> LHALF;
+  twoMdb.l = ((long long int) (M + 1023)) << 52;
+
+  p = r + (r*r) * (0.5 + r * (c3 + r * c4));
+
+  if(!minusone) {
+    th = twoPowerIndex1[index1].hi * twoPowerIndex2[index2].hi;
+    y = th + th * p;
+    return y * twoMdb.d;
+  }
+  else {
+    Mul12(&th, &tl, twoPowerIndex1[index1].hi, twoPowerIndex2[index2].hi);
+    tl += twoPowerIndex1[index1].hi * twoPowerIndex2[index2].mi 
+      + twoPowerIndex1[index1].mi * twoPowerIndex2[index2].hi;
+    return (th * twoMdb.d - 1.0) + twoMdb.d * (tl + th * p);
+  }
+}
+
+
+#ifdef BUILD_VECTOR_ABI
+/* The same on four lanes, for the batch versions */
+VECTOR_KERNEL void expf_lanes(v4df *res, const v4df *xp, int minusone) {
+  v4df x, shifted, kd, r, p, tbl1h, tbl1m, tbl2h, tbl2m, th, tl, twoM, y;
+  v4di k, index1, index2;
+  int l;
+  const double Log2h= 0xb.17217f8p-16 ;
+  const double Log2l= -0x2.e308654361c4cp-48 ;
+
+  x = *xp;
+
+  shifted = x * log2InvMult2L + shiftConst;
+  kd = shifted - shiftConst;
+  k = ((v4di) shifted) - ((v4di) VSplat(v4df, shiftConst));
+  r = (x - kd*Log2h) - kd*Log2l;
+
+  index1 = k & INDEXMASK1;
+  index2 = (k & INDEXMASK2) >> LHALF;
+  VECTOR_UNROLL
+  for(l=0; l<4; l++) {
+    tbl1h[l] = twoPowerIndex1[index1[l]].hi;
+    tbl1m[l] = twoPowerIndex1[index1[l]].mi;
+    tbl2h[l] = twoPowerIndex2[index2[l]].hi;
+    tbl2m[l] = twoPowerIndex2[index2[l]].mi;
+  }
+  /* 2^M, M = k >> L; garbage in the lanes which are returned as 0 */
+  twoM = (v4df) ((((k >> L) + 1023) & 0x7ff) << 52);
+
+  p = r + (r*r) * (0.5 + r * (c3 + r * c4));
+
+  if(!minusone) {
+    th = tbl1h * tbl2h;
+    y = (th + th * p) * twoM;
+  }
+  else {
+    VMul12(th, tl, tbl1h, tbl2h);
+    tl += tbl1h * tbl2m + tbl1m * tbl2h;
+    y = (th * twoM - 1.0) + twoM * (tl + th * p);
+  }
+  *res = VSelect((x > -EXPF_XMAX) & (x < EXPF_XMAX), y, VSplat(v4df, 0.0));
+}
+
+VECTOR_KERNEL void expf_lanes_4(v4df *res, const v4df *x)   { expf_lanes(res, x, 0); }
+VECTOR_KERNEL void expm1f_lanes_4(v4df *res, const v4df *x) { expf_lanes(res, x, 1); }
+#endif /* BUILD_VECTOR_ABI */
+
+
+static inline float expf_round(float x, int mode) {
+  float res;
+  int roundable;
+
+  TEST_AND_COPY_FLOAT(roundable, res, expf_quick(x, 0), mode);
+  if(roundable)
+    return res;
+  return float_from_ro(exp_ro(x), mode);
+}
+
+static inline float expm1f_round(float x, int mode) {
+  float res;
+  int roundable;
+
+  TEST_AND_COPY_FLOAT(roundable, res, expf_quick(x, 1), mode);
+  if(roundable)
+    return res;
+  return float_from_ro(expm1_ro(x), mode);
+}
+
+float expf_rn(float x){ return expf_round(x, CRLIBM_RN); }
+float expf_rd(float x){ return expf_round(x, CRLIBM_RD); }
+float expf_ru(float x){ return expf_round(x, CRLIBM_RU); }
+float expf_rz(float x){ return expf_round(x, CRLIBM_RZ); }
+
+float expm1f_rn(float x){ return expm1f_round(x, CRLIBM_RN); }
+float expm1f_rd(float x){ return expm1f_round(x, CRLIBM_RD); }
+float expm1f_ru(float x){ return expm1f_round(x, CRLIBM_RU); }
+float expm1f_rz(float x){ return expm1f_round(x, CRLIBM_RZ); }
+
+#ifdef BUILD_VECTOR_ABI
+VECTOR_FLOAT_BATCH(expf_rn, expf_lanes_4, CRLIBM_RN)
+VECTOR_FLOAT_BATCH(expf_rd, expf_lanes_4, CRLIBM_RD)
+VECTOR_FLOAT_BATCH(expf_ru, expf_lanes_4, CRLIBM_RU)
+VECTOR_FLOAT_BATCH(expf_rz, expf_lanes_4, CRLIBM_RZ)
+VECTOR_FLOAT_BATCH(expm1f_rn, expm1f_lanes_4, CRLIBM_RN)
+VECTOR_FLOAT_BATCH(expm1f_rd, expm1f_lanes_4, CRLIBM_RD)
+VECTOR_FLOAT_BATCH(expm1f_ru, expm1f_lanes_4, CRLIBM_RU)
+VECTOR_FLOAT_BATCH(expm1f_rz, expm1f_lanes_4, CRLIBM_RZ)
+#else
+FLOAT_BATCH(expf_rn)
+FLOAT_BATCH(expf_rd)
+FLOAT_BATCH(expf_ru)
+FLOAT_BATCH(expf_rz)
+FLOAT_BATCH(expm1f_rn)
+FLOAT_BATCH(expm1f_rd)
+FLOAT_BATCH(expm1f_ru)
+FLOAT_BATCH(expm1f_rz)
+#endif
@@ -430,7 +430,7 @@ double expm1_rn(double x) {
     }
 
     /* Rounding test */
-    if(expm1h == (expm1h + (expm1m * ROUNDCSTDIRECTRN)))
+    if(QUICK_PHASE && expm1h == (expm1h + (expm1m * ROUNDCSTDIRECTRN)))
      return expm1h;
    else 
      {
@@ -535,7 +535,7 @@ double expm1_rn(double x) {
 
 
   /* Rounding test */
-  if(expm1h == (expm1h + (expm1m * ROUNDCSTCOMMONRN))) {
+  if(QUICK_PHASE && expm1h == (expm1h + (expm1m * ROUNDCSTCOMMONRN))) {
     return expm1h;
   } else {
     /* Rest of argument reduction for accurate phase */
@@ -1538,6 +1538,15 @@ double expm1_rz(double x) {
   /* We cannot be here since we return before in any case */
 }
 
+
+/* Round to odd, see RETURN_RO_FROM_RZ in crlibm_private.h: expm1 is
+   exact only for x=0 and x=-Inf */
+double expm1_ro(double x) {
+  if ((x == 0.0) || (x == -1.0/0.0))
+    return expm1_rz(x);
+  RETURN_RO_FROM_RZ(expm1_rz(x));
+}
+
 #ifdef BUILD_INTERVAL_FUNCTIONS
 interval j_expm1(interval x)
 {
@@ -2512,4 +2521,6 @@ interval j_expm1(interval x)
   ASSIGN_UP(res,res_sup);
   return res;
 }
+
+INTERVAL_BATCH(j_expm1)
 #endif
@@ -0,0 +1,429 @@
+/*
+ * Correctly rounded exp and log on binary128 (__float128, 113-bit
+ * significand)
+ *
+ * Two phases, like the double functions:
+ *
+ * - the quick phase works in triple-double, some 150 bits, which
+ *   leaves 20 bits beyond the format for the rounding test: relative
+ *   error below 2^-135;
+ *
+ * - the accurate phase works in SCS (240 bits): scs_exp_reduced for
+ *   exp, and for log either a series in SCS near 1, or a Newton step
+ *   on exp from the quick result. Relative error below 2^-180.
+ *
+ * The triple-double result is rounded to binary128 by q_round below,
+ * in binary128 arithmetic (soft-float, rounding to nearest). The worst
+ * cases of the rounding to binary128 being unknown, correct rounding
+ * is not proven: when the accurate phase cannot decide, the rounding
+ * of its result is returned.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+
+#ifdef __SIZEOF_FLOAT128__
+
+#include "triple-double.h"
+#include "float128.h"
+
+typedef union {
+  __float128 f;
+  unsigned long long w[2];
+} q_number;
+
+#ifdef WORDS_BIGENDIAN
+#define QHI 0
+#define QLO 1
+#else
+#define QHI 1
+#define QLO 0
+#endif
+
+#define QMANTISSA_MASK 0x0000ffffffffffffULL
+
+#define SQRT_2 1.4142135623730950489e0
+#define INV_LN2 0x1.71547652b82fep0
+#define SHIFT 0x1.8p52
+
+/* exp overflows above, and is below half the smallest subnormal below */
+#define EXPQ_OVERFLOW   11357.0
+#define EXPQ_UNDERFLOW -11434.0
+
+static const __float128 largest_q = 0x1.ffffffffffffffffffffffffffffp16383Q;
+
+
+/* 2^e as a binary128, for -16382 <= e <= 16383 */
+static __float128 q_pow2(int e) {
+  q_number u;
+
+  u.w[QHI] = (unsigned long long) (e + 16383) << 48;
+  u.w[QLO] = 0;
+  return u.f;
+}
+
+/* x as the exact sum of three doubles, for x in the double range */
+static void q_split(double *xh, double *xm, double *xl, __float128 x) {
+  *xh = (double) x;
+  x -= *xh;
+  *xm = (double) x;
+  *xl = (double) (x - *xm);
+}
+
+
+/* Rounds (h + m + l) * 2^k to binary128 in the given mode, as ld_round
+   does to long double (longdouble.c): h + m + l is a non-overlapping
+   triple-double with h a normal double, of relative error below eps.
+   Returns 1 with the rounding in *res, or 0 if it cannot be decided,
+   unless eps is negative.
+
+   s = RN(RN(h + m) + l) on 113 bits and t = h + m + l - s, with two
+   Fast2Sum (l may exceed the ulp of h + m here). lo is s rounded to
+   the precision of the result (of the subnormals if the result is
+   one), d = s + t - lo is at most one ulp u of lo, and the spacing
+   below lo is ub. */
+static int q_round(__float128 *res, double h, double m, double l, int k,
+                   __float128 eps, int mode) {
+  __float128 s, t, u, ub, lo, d, ad, err, half, r;
+  q_number sq;
+  int neg, away, ex, ue, k1;
+
+  s = (__float128) h + m;
+  t = m - (s - h);
+  r = s + l;
+  t += l - (r - s);
+  s = r;
+  neg = (s < 0);
+  if (neg) {
+    s = -s;
+    t = -t;
+  }
+  away = (mode == CRLIBM_RU && !neg) || (mode == CRLIBM_RD && neg);
+
+  sq.f = s;
+  ex = (int) ((sq.w[QHI] >> 48) & 0x7fff) - 16383;
+  if (ex + k > 16383) {
+    r = (mode == CRLIBM_RN || away) ? q_pow2(16383)*2 : largest_q;
+    *res = neg ? -r : r;
+    return 1;
+  }
+
+  if (ex + k < -16382) {
+    ue = -16494 - k;
+    u  = q_pow2(ue);
+    lo = (s + q_pow2(ue + 112)) - q_pow2(ue + 112);
+    ub = u;
+  }
+  else {
+    ue = ex - 112;
+    u  = q_pow2(ue);
+    lo = s;
+    ub = (s == q_pow2(ex) && ex + k > -16382) ? u*0.5Q : u;
+  }
+  d  = (s - lo) + t;
+  ad = (d < 0) ? -d : d;
+  err = (eps < 0) ? -1 : (eps + 0x1p-200Q) * s;
+
+  if (mode == CRLIBM_RN) {
+    half = (d < 0) ? ub*0.5Q : u*0.5Q;
+    if (ad - half <= err && half - ad <= err)
+      return 0;
+    if (ad <= half)
+      r = lo;
+    else
+      r = (d < 0) ? lo - ub : lo + u;
+  }
+  else {
+    if (ad <= err || (d > 0 && u - d <= err) || (d < 0 && ub + d <= err))
+      return 0;
+    if (away)
+      r = (d > 0) ? lo + u : lo;
+    else
+      r = (d < 0) ? lo - ub : lo;
+  }
+
+  k1 = k/2;
+  r = (r * q_pow2(k1)) * q_pow2(k - k1);
+  *res = neg ? -r : r;
+  return 1;
+}
+
+
+
+/*************************************************************
+ *                         exp                               *
+ *************************************************************/
+
+/* exp(x) = 2^M 2^(j/256) exp(r), with k = 256 M + j the integer
+   nearest to x 256/ln(2) and r = x - k ln(2)/256, |r| < 2^-9.
+
+   x = xh + xm + xl exactly. xh - k LN2_256_1 is exact (k has at most
+   22 bits), k LN2_256_2 and k LN2_256_3 are exact by Mul12, and the
+   rest is added in triple-double: the absolute error on r is below
+   2^-150.
+
+   exp(r) is its Taylor series of degree 12 (remainder below 2^-156),
+   the terms of degree 9 and above in double, the others in
+   triple-double, and is multiplied by the triple-double 2^(j/256). The
+   relative error of the 20 triple-double operations is below 2^-143. */
+
+static __float128 expq_mode(__float128 x, int mode) {
+  q_number xq;
+  __float128 res;
+  double xh, xm, xl, kd, a, ph, pl, rh, rm, rl, p, qh, qm, ql, th, tm, tl;
+  scs_t X, T, P;
+  int e, k, M, j, n;
+
+  xq.f = x;
+  e = (int) ((xq.w[QHI] >> 48) & 0x7fff);
+  if (e == 0x7fff) {
+    if ((xq.w[QHI] & QMANTISSA_MASK) != 0 || xq.w[QLO] != 0)
+      return x + x;                         /* NaN */
+    return (xq.w[QHI] >> 63) ? 0 : x;       /* exp(-inf) = 0, exp(inf) = inf */
+  }
+  if (e < 16383 - 120) {
+    /* |x| < 2^-120: exp(x) is 1 + x within 2^-240 */
+    if (x == 0)
+      return 1;
+    if (mode == CRLIBM_RU && x > 0)
+      return 0x1.0000000000000000000000000001p0Q;
+    if ((mode == CRLIBM_RD || mode == CRLIBM_RZ) && x < 0)
+      return 0x1.ffffffffffffffffffffffffffffp-1Q;
+    return 1;
+  }
+  if (x > EXPQ_OVERFLOW)
+    return (mode == CRLIBM_RU || mode == CRLIBM_RN) ? q_pow2(16383)*2 : largest_q;
+  if (x < EXPQ_UNDERFLOW)
+    return (mode == CRLIBM_RU) ? 0x1p-16494Q : 0;
+
+  q_split(&xh, &xm, &xl, x);
+  kd = (xh * EXPQ_256_OVER_LN2 + SHIFT) - SHIFT;
+  k = (int) kd;
+  M = k >> 8;
+  j = k & 0xff;
+
+  a = xh - kd * LN2_256_1;
+  Mul12(&ph, &pl, kd, LN2_256_2);
+  Add233Cond(&rh, &rm, &rl, -ph, -pl, a, 0, 0);
+  Mul12(&ph, &pl, kd, LN2_256_3);
+  Add233Cond(&qh, &qm, &ql, -ph, -pl, rh, rm, rl);
+  Add133Cond(&rh, &rm, &rl, xm, qh, qm, ql);
+  Add133Cond(&th, &tm, &tl, xl - kd * LN2_256_4, rh, rm, rl);
+  Renormalize3(&rh, &rm, &rl, th, tm, tl);
+
+  p = EXPQ_C12;
+  p = p * rh + EXPQ_C11;
+  p = p * rh + EXPQ_C10;
+  p = p * rh + EXPQ_C9;
+  qh = p; qm = 0; ql = 0;
+  for (n = 8; n >= 0; n--) {
+    Mul33(&th, &tm, &tl, rh, rm, rl, qh, qm, ql);
+    Add33Cond(&qh, &qm, &ql, expq_coeff_td[n][0], expq_coeff_td[n][1], expq_coeff_td[n][2], th, tm, tl);
+    Renormalize3(&qh, &qm, &ql, qh, qm, ql);
+  }
+  Mul33(&th, &tm, &tl, expq_table[j][0], expq_table[j][1], expq_table[j][2], qh, qm, ql);
+  Renormalize3(&qh, &qm, &ql, th, tm, tl);
+
+  if (q_round(&res, qh, qm, ql, M, 0x1p-135Q, mode))
+    return res;
+
+  /* Accurate phase, on x - M' ln(2) with M' the integer nearest to
+     x/ln(2) */
+  M = (k + 128) >> 8;
+  scs_set_d(X, xh);
+  scs_set_d(T, xm);
+  scs_add(X, X, T);
+  scs_set_d(T, xl);
+  scs_add(X, X, T);
+  scs_exp_reduced(P, X, M);
+  scs_get_td(&qh, &qm, &ql, P);
+
+  if (!q_round(&res, qh, qm, ql, M, 0x1p-180Q, mode))
+    q_round(&res, qh, qm, ql, M, -1, mode);
+  return res;
+}
+
+
+
+/*************************************************************
+ *                         log                               *
+ *************************************************************/
+
+/* log(x) = E ln(2) + log(m) with m in [sqrt(2)/2, sqrt(2)] and m = mh
+   + mm + ml exactly. With i the integer nearest to 256 mh and c_i
+   close to 256/i on 12 bits (c_256 = 1), z = m c_i - 1 is exact in
+   triple-double and |z| < 2^-8.3, and log(m) = -log(c_i) + log(1+z).
+
+   log(1+z) is its Taylor series of degree 17 (remainder below 2^-141
+   relatively), the terms of degree 12 and above in double. For E = 0
+   and i = 256 the result is log(1+z) alone, with no cancellation;
+   otherwise |log(x)| > 2^-9.5, and E ln(2) and log(m) cancel by one bit
+   at most. The relative error is below 2^-140.
+
+   The accurate phase computes, for E = 0 and i = 256, log(1+z) =
+   2 atanh(z/(2+z)) by the series of degree 25 in SCS; otherwise one
+   Newton step y + x exp(-y) - 1 from the quick result y, whose error
+   is below 2^-130: the error left is that of scs_exp_reduced. Very
+   close to 1 (|x - 1| < 2^-90) log(x) may lie within 2^-180 of a
+   rounding boundary, and the rounding of the accurate result is
+   returned. */
+
+static __float128 logq_mode(__float128 x, int mode) {
+  q_number xq;
+  __float128 res;
+  double mh, mm, ml, ci, p1, p2, p3, p4, zh, zm, zl, p, qh, qm, ql, th, tm, tl;
+  double eh, em, el, sh, sm, sl, scale, kd;
+  scs_t Y, Z, S, S2, Q, T, P, one;
+  int e, E, i, n, k;
+
+  xq.f = x;
+  e = (int) ((xq.w[QHI] >> 48) & 0x7fff);
+  if (e == 0x7fff) {
+    if ((xq.w[QHI] & QMANTISSA_MASK) != 0 || xq.w[QLO] != 0)
+      return x + x;                                  /* NaN */
+    return (xq.w[QHI] >> 63) ? (x - x) : x;          /* log(-inf) = NaN, log(inf) = inf */
+  }
+  if (x == 0)
+    return -1.0/0.0;
+  if (x < 0)
+    return (x - x)/0;
+  if (x == 1)
+    return 0;
+
+  E = 0;
+  if (e == 0) {
+    /* subnormal */
+    xq.f = x * 0x1p113Q;
+    e = (int) ((xq.w[QHI] >> 48) & 0x7fff);
+    E = -113;
+  }
+  E += e - 16383;
+  xq.w[QHI] = (xq.w[QHI] & QMANTISSA_MASK) | (16383ULL << 48);
+  if (xq.f > SQRT_2) {
+    xq.f *= 0.5Q;
+    E++;
+  }
+  q_split(&mh, &mm, &ml, xq.f);
+
+  i = (int) (mh * 256 + 0.5);
+  ci = logq_table[i - 181][0];
+  Mul12(&p1, &p2, ci, mh);
+  Mul12(&p3, &p4, ci, mm);
+  Add133Cond(&th, &tm, &tl, p2, p1 - 1, 0, 0);
+  Add133Cond(&zh, &zm, &zl, p3, th, tm, tl);
+  Add133Cond(&th, &tm, &tl, p4 + ci * ml, zh, zm, zl);
+  Renormalize3(&zh, &zm, &zl, th, tm, tl);
+
+  p = LOGQ_C17;
+  p = p * zh + LOGQ_C16;
+  p = p * zh + LOGQ_C15;
+  p = p * zh + LOGQ_C14;
+  p = p * zh + LOGQ_C13;
+  p = p * zh + LOGQ_C12;
+  qh = p; qm = 0; ql = 0;
+  for (n = 10; n >= 0; n--) {
+    Mul33(&th, &tm, &tl, zh, zm, zl, qh, qm, ql);
+    Add33Cond(&qh, &qm, &ql, logq_coeff_td[n][0], logq_coeff_td[n][1], logq_coeff_td[n][2], th, tm, tl);
+    Renormalize3(&qh, &qm, &ql, qh, qm, ql);
+  }
+  Mul33(&th, &tm, &tl, zh, zm, zl, qh, qm, ql);
+  Renormalize3(&qh, &qm, &ql, th, tm, tl);
+
+  if (E != 0 || i != 256) {
+    Mul133(&eh, &em, &el, (double) E, LN2Q_H, LN2Q_M, LN2Q_L);
+    Add33Cond(&sh, &sm, &sl, eh, em, el, logq_table[i - 181][1], logq_table[i - 181][2], logq_table[i - 181][3]);
+    Renormalize3(&sh, &sm, &sl, sh, sm, sl);
+    Add33Cond(&th, &tm, &tl, sh, sm, sl, qh, qm, ql);
+    Renormalize3(&qh, &qm, &ql, th, tm, tl);
+  }
+
+  if (q_round(&res, qh, qm, ql, 0, 0x1p-135Q, mode))
+    return res;
+
+  /* Accurate phase */
+  scs_set_d(one, 1.0);
+  if (E == 0 && i == 256) {
+    /* z = m - 1, S = z/(2+z), log(1+z) = 2 S sum S^2n/(2n+1) */
+    scs_set_d(Z, mh - 1);
+    scs_set_d(T, mm);
+    scs_add(Z, Z, T);
+    scs_set_d(T, ml);
+    scs_add(Z, Z, T);
+    scs_set_d(T, 2.0);
+    scs_add(T, T, Z);
+    scs_div(S, Z, T);
+    scs_square(S2, S);
+    scs_set_si(T, 25);
+    scs_div(Q, one, T);
+    for (n = 11; n >= 0; n--) {
+      scs_mul(Q, Q, S2);
+      scs_set_si(T, 2*n + 1);
+      scs_div(T, one, T);
+      scs_add(Q, Q, T);
+    }
+    scs_mul(Y, S, Q);
+    scs_add(Y, Y, Y);
+  }
+  else {
+    /* y + m 2^E exp(-y) - 1, exp(-y) = 2^-k exp(k ln(2) - y) with k
+       the integer nearest to y/ln(2), so that k - E is -1, 0 or 1 */
+    kd = (qh * INV_LN2 + SHIFT) - SHIFT;
+    k = (int) kd;
+    scs_set_d(Y, qh);
+    scs_set_d(T, qm);
+    scs_add(Y, Y, T);
+    scs_set_d(T, ql);
+    scs_add(Y, Y, T);
+    Y->sign = -Y->sign;
+    scs_exp_reduced(P, Y, -k);
+    Y->sign = -Y->sign;
+    scale = (E > k) ? 2.0 : (E < k) ? 0.5 : 1.0;
+    scs_set_d(Z, mh * scale);
+    scs_set_d(T, mm * scale);
+    scs_add(Z, Z, T);
+    scs_set_d(T, ml * scale);
+    scs_add(Z, Z, T);
+    scs_mul(Z, Z, P);
+    scs_sub(Z, Z, one);         /* w, below 2^-130 */
+    scs_square(T, Z);
+    scs_div_2(T);
+    scs_sub(Z, Z, T);
+    scs_add(Y, Y, Z);
+  }
+  scs_get_td(&qh, &qm, &ql, Y);
+
+  if (!q_round(&res, qh, qm, ql, 0, 0x1p-180Q, mode))
+    q_round(&res, qh, qm, ql, 0, -1, mode);
+  return res;
+}
+
+
+
+__float128 expq_rn(__float128 x) { return expq_mode(x, CRLIBM_RN); }
+__float128 expq_ru(__float128 x) { return expq_mode(x, CRLIBM_RU); }
+__float128 expq_rd(__float128 x) { return expq_mode(x, CRLIBM_RD); }
+__float128 expq_rz(__float128 x) { return expq_mode(x, CRLIBM_RZ); }
+
+__float128 logq_rn(__float128 x) { return logq_mode(x, CRLIBM_RN); }
+__float128 logq_ru(__float128 x) { return logq_mode(x, CRLIBM_RU); }
+__float128 logq_rd(__float128 x) { return logq_mode(x, CRLIBM_RD); }
+__float128 logq_rz(__float128 x) { return logq_mode(x, CRLIBM_RZ); }
+
+#endif /* __SIZEOF_FLOAT128__ */
@@ -0,0 +1,506 @@
+#include "crlibm.h"
+#include "crlibm_private.h"
+
+/* Tables of the binary128 exp and log (float128.c), computed in
+   exact rational arithmetic: every constant is rounded to nearest,
+   each part of a triple-double from what the previous ones leave */
+
+/* ln(2)/256 = LN2_256_1 + LN2_256_2 + LN2_256_3 + LN2_256_4, LN2_256_1 on 31 bits */
+#define LN2_256_1 0x1.62e42ff000000p-9
+#define LN2_256_2 -0x1.718432a1b0e26p-43
+#define LN2_256_3 -0x1.9ff0342542fc3p-98
+#define LN2_256_4 -0x1.79b31ace93a4fp-153
+
+#define EXPQ_256_OVER_LN2 0x1.71547652b82fep+8
+
+/* ln(2) as a triple-double */
+#define LN2Q_H 0x1.62e42fefa39efp-1
+#define LN2Q_M 0x1.abc9e3b39803fp-56
+#define LN2Q_L 0x1.7b57a079a1934p-111
+
+/* 2^(j/256) as triple-doubles */
+static const double expq_table[256][3] = {
+  {0x1.0000000000000p+0, 0.0, 0.0},
+  {0x1.00b1afa5abcbfp+0, -0x1.4f6b2a7609f71p-55, -0x1.b55dd523f3c08p-111},
+  {0x1.0163da9fb3335p+0, 0x1.b61299ab8cdb7p-54, 0x1.bf48007d80987p-109},
+  {0x1.02168143b0281p+0, -0x1.2bf310fc54eb6p-55, 0x1.9953ea727ff0bp-109},
+  {0x1.02c9a3e778061p+0, -0x1.19083535b085dp-56, -0x1.9085b0a3d74d5p-110},
+  {0x1.037d42e11bbccp+0, 0x1.56811eeade11ap-57, 0x1.1313d5abd77e9p-111},
+  {0x1.04315e86e7f85p+0, -0x1.0a31c1977c96ep-54, -0x1.912fbf44b4040p-112},
+  {0x1.04e5f72f654b1p+0, 0x1.4c3793aa0d08dp-55, -0x1.f9c132b72afe2p-109},
+  {0x1.059b0d3158574p+0, 0x1.d73e2a475b465p-55, 0x1.05ff94f8d257ep-110},
+  {0x1.0650a0e3c1f89p+0, -0x1.5cb7b5799c397p-54, 0x1.3e0adfe6c4c98p-108},
+  {0x1.0706b29ddf6dep+0, -0x1.c91dfe2b13c27p-55, 0x1.fb41f2e2c24abp-110},
+  {0x1.07bd42b72a836p+0, 0x1.3233454458700p-55, -0x1.92b8d5099366ep-111},
+  {0x1.0874518759bc8p+0, 0x1.186be4bb284ffp-57, 0x1.15820d96b414fp-111},
+  {0x1.092bdf66607e0p+0, -0x1.68063800a3fd1p-54, 0x1.4189ff8d63ef8p-111},
+  {0x1.09e3ecac6f383p+0, 0x1.1487818316136p-54, -0x1.48b45d1fdc259p-108},
+  {0x1.0a9c79b1f3919p+0, 0x1.5d16c873d1d38p-55, -0x1.cf8d9770223ddp-109},
+  {0x1.0b5586cf9890fp+0, 0x1.8a62e4adc610bp-54, -0x1.67c9bd6ebf74cp-108},
+  {0x1.0c0f145e46c85p+0, 0x1.4f98906d21cefp-54, 0x1.39d71c412378ep-111},
+  {0x1.0cc922b7247f7p+0, 0x1.01edc16e24f71p-54, 0x1.e8aac564e6fe3p-108},
+  {0x1.0d83b23395decp+0, -0x1.bc14de43f316ap-54, -0x1.696bec12e389cp-110},
+  {0x1.0e3ec32d3d1a2p+0, 0x1.03a1727c57b53p-59, -0x1.5aa76994e9ddbp-113},
+  {0x1.0efa55fdfa9c5p+0, -0x1.49db9bc54021bp-54, -0x1.d4ad57103f1fcp-108},
+  {0x1.0fb66affed31bp+0, -0x1.b9bedc44ebd7bp-57, -0x1.aeb1f49d84259p-112},
+  {0x1.1073028d7233ep+0, 0x1.d46eb1692fdd5p-55, 0x1.f57015b4875a8p-110},
+  {0x1.11301d0125b51p+0, -0x1.6c51039449b3ap-54, 0x1.9d58b988f562dp-109},
+  {0x1.11edbab5e2ab6p+0, -0x1.ca454f703fb72p-54, 0x1.3454b21b02588p-112},
+  {0x1.12abdc06c31ccp+0, -0x1.1b514b36ca5c7p-58, -0x1.08d8f42083120p-112},
+  {0x1.136a814f204abp+0, -0x1.7108fba48dcf0p-57, 0x1.c9a4e34e91caap-111},
+  {0x1.1429aaea92de0p+0, -0x1.32fbf9af1369ep-54, -0x1.2fe7bb4c76416p-108},
+  {0x1.14e95934f312ep+0, -0x1.b91e839bf44abp-55, -0x1.7ddfed6937232p-109},
+  {0x1.15a98c8a58e51p+0, 0x1.2406ab9eeab0ap-55, -0x1.01b575279c474p-110},
+  {0x1.166a45471c3c2p+0, 0x1.8f23b82ea1a32p-58, 0x1.cec6f65f9f480p-112},
+  {0x1.172b83c7d517bp+0, -0x1.19041b9d78a76p-55, 0x1.4f2406aa13ff0p-109},
+  {0x1.17ed48695bbc0p+0, 0x1.09e3fe2ac5a64p-56, 0x1.0f94cec9c9210p-111},
+  {0x1.18af9388c8deap+0, -0x1.11023d1970f6cp-54, 0x1.725f0040b97c5p-110},
+  {0x1.1972658375d2fp+0, 0x1.4aadd85f17e08p-54, 0x1.629678a30a399p-109},
+  {0x1.1a35beb6fcb75p+0, 0x1.e5b4c7b4968e4p-55, 0x1.ad36183926ae8p-111},
+  {0x1.1af99f8138a1cp+0, 0x1.7bf85a4b69280p-54, -0x1.5c2c423bf7bd0p-110},
+  {0x1.1bbe084045cd4p+0, -0x1.95386352ef607p-54, -0x1.40ca69503718ep-109},
+  {0x1.1c82f95281c6bp+0, 0x1.009778010f8c9p-54, -0x1.875b881c94e67p-110},
+  {0x1.1d4873168b9aap+0, 0x1.e016e00a2643cp-54, 0x1.ea62d0881b918p-110},
+  {0x1.1e0e75eb44027p+0, -0x1.6fdd8088cb6dep-54, -0x1.0459f81668706p-108},
+  {0x1.1ed5022fcd91dp+0, -0x1.1df98027bb78cp-54, 0x1.e504d36c47475p-108},
+  {0x1.1f9c18438ce4dp+0, -0x1.bf524a097af5cp-54, -0x1.786d77f83061cp-109},
+  {0x1.2063b88628cd6p+0, 0x1.dc775814a8495p-55, -0x1.781dbc16f1ea4p-111},
+  {0x1.212be3578a819p+0, 0x1.3592d2cfcaac9p-54, -0x1.664b40209c8aap-110},
+  {0x1.21f49917ddc96p+0, 0x1.2a97e9494a5eep-55, -0x1.693c2b3b7106bp-109},
+  {0x1.22bdda27912d1p+0, 0x1.d34fb5577d69fp-55, -0x1.b872152843078p-110},
+  {0x1.2387a6e756238p+0, 0x1.9b07eb6c70573p-54, -0x1.4d89f9af532e0p-109},
+  {0x1.2451ffb82140ap+0, 0x1.acfcc911ca996p-55, 0x1.8463b513c7000p-110},
+  {0x1.251ce4fb2a63fp+0, 0x1.ac155bef4f4a4p-55, 0x1.1a9c8afdcf797p-112},
+  {0x1.25e85711ece75p+0, 0x1.3e1a24ac31b2cp-54, 0x1.5ba6e76088bcdp-108},
+  {0x1.26b4565e27cddp+0, 0x1.2bd339940e9d9p-55, 0x1.277393a461b77p-110},
+  {0x1.2780e341ddf29p+0, 0x1.e067c05f9e76cp-54, -0x1.bd4b7cee4538bp-108},
+  {0x1.284dfe1f56381p+0, -0x1.a4c3a8c3f0d7ep-54, 0x1.67fdaa2e52d7dp-108},
+  {0x1.291ba7591bb70p+0, -0x1.2cc7228401cbdp-55, 0x1.7a3902d46e4c4p-114},
+  {0x1.29e9df51fdee1p+0, 0x1.612e8afad1255p-55, 0x1.de54485604690p-111},
+  {0x1.2ab8a66d10f13p+0, -0x1.95743191690a7p-54, -0x1.dde6d7e73b7f6p-109},
+  {0x1.2b87fd0dad990p+0, -0x1.10adcd6381aa4p-59, 0x1.0885fb8796dbdp-113},
+  {0x1.2c57e39771b2fp+0, -0x1.50145a6eb5124p-54, -0x1.e245c425cbfd4p-108},
+  {0x1.2d285a6e4030bp+0, 0x1.0024754db41d5p-54, -0x1.ee9d8f8cb9307p-110},
+  {0x1.2df961f641589p+0, 0x1.d16cffbbce198p-54, 0x1.aadc67a5cf780p-109},
+  {0x1.2ecafa93e2f56p+0, 0x1.1ca0f45d52383p-56, 0x1.d7b08dee6d12ap-111},
+  {0x1.2f9d24abd886bp+0, -0x1.53c55532bda93p-57, 0x1.286089c742098p-111},
+  {0x1.306fe0a31b715p+0, 0x1.6f46ad23182e4p-55, 0x1.7b7b2f09cd0d9p-110},
+  {0x1.31432edeeb2fdp+0, 0x1.959a3f3f3fcd1p-55, -0x1.91ceb071b81b5p-109},
+  {0x1.32170fc4cd831p+0, 0x1.a9ce78e18047cp-55, 0x1.b778c882b85e8p-110},
+  {0x1.32eb83ba8ea32p+0, -0x1.c45e83cb4f318p-54, -0x1.b78c73a0898b9p-108},
+  {0x1.33c08b26416ffp+0, 0x1.32721843659a6p-54, -0x1.406a2ea6cfc6bp-108},
+  {0x1.3496266e3fa2dp+0, -0x1.35a75930881a4p-55, -0x1.475af6a7b6cc9p-111},
+  {0x1.356c55f929ff1p+0, -0x1.b5cee5c4e4628p-55, -0x1.8e524e520d5f2p-109},
+  {0x1.36431a2de883bp+0, -0x1.c3144a06cb85ep-55, 0x1.f8bb041238096p-109},
+  {0x1.371a7373aa9cbp+0, -0x1.63aeabf42eae2p-54, 0x1.87e3e12516bfap-108},
+  {0x1.37f26231e754ap+0, -0x1.9f5ca9eceb23cp-54, 0x1.57469ed7e12f8p-111},
+  {0x1.38cae6d05d866p+0, -0x1.e958d3c9904bdp-54, 0x1.0a77a61404f21p-109},
+  {0x1.39a401b7140efp+0, -0x1.9a9a5fc8e2934p-54, -0x1.18ff8ae910b7ap-108},
+  {0x1.3a7db34e59ff7p+0, -0x1.5e436d661f5e3p-56, 0x1.9b0b1ff17c296p-111},
+  {0x1.3b57fbfec6cf4p+0, 0x1.54c66e26fff18p-54, 0x1.d68f8b2e3be80p-108},
+  {0x1.3c32dc313a8e5p+0, -0x1.efff8375d29c3p-54, -0x1.1143f2a93395ap-109},
+  {0x1.3d0e544ede173p+0, 0x1.fe8d08c284c71p-56, 0x1.1ba164ea65915p-115},
+  {0x1.3dea64c123422p+0, 0x1.ada0911f09ebcp-55, -0x1.808ba68fa8fb7p-109},
+  {0x1.3ec70df1c5175p+0, -0x1.af6637b8c9bcap-55, -0x1.9bcdef349ba26p-111},
+  {0x1.3fa4504ac801cp+0, -0x1.7d023f956f9f3p-54, -0x1.0473e3724200dp-108},
+  {0x1.40822c367a024p+0, 0x1.bddf8b6f4d048p-55, 0x1.28b1c754495cfp-109},
+  {0x1.4160a21f72e2ap+0, -0x1.ef3691c309278p-58, -0x1.32b43eafc6518p-114},
+  {0x1.423fb2709468ap+0, -0x1.8462dc0b314ddp-54, -0x1.1cad978fffe80p-108},
+  {0x1.431f5d950a897p+0, -0x1.1c7dde35f7999p-55, 0x1.903c496195fefp-109},
+  {0x1.43ffa3f84b9d4p+0, 0x1.880be9704c003p-55, -0x1.94966ca4958dfp-109},
+  {0x1.44e086061892dp+0, 0x1.89b7a04ef80d0p-59, -0x1.0ac312de3d922p-114},
+  {0x1.45c2042a7d232p+0, -0x1.8641982fb1f8ep-57, -0x1.85a39e45a5ac8p-112},
+  {0x1.46a41ed1d0057p+0, 0x1.c944bd1648a76p-54, 0x1.7df404ff21f3ap-108},
+  {0x1.4786d668b3237p+0, -0x1.c20f0ed445733p-54, -0x1.cb6afa23d3b08p-110},
+  {0x1.486a2b5c13cd0p+0, 0x1.3c1a3b69062f0p-56, 0x1.e1eebae743ac0p-111},
+  {0x1.494e1e192aed2p+0, -0x1.3b2895e499ea0p-55, 0x1.f5c05bb2372a6p-109},
+  {0x1.4a32af0d7d3dep+0, 0x1.9cb62f3d1be56p-54, 0x1.91876c761e2c7p-110},
+  {0x1.4b17dea6db7d7p+0, -0x1.125b87f2897f0p-55, 0x1.824406a11ee2dp-110},
+  {0x1.4bfdad5362a27p+0, 0x1.d4397afec42e2p-56, 0x1.c06c7745c2b39p-113},
+  {0x1.4ce41b817c114p+0, 0x1.05e29690abd5dp-54, -0x1.b977421877867p-109},
+  {0x1.4dcb299fddd0dp+0, 0x1.8ecdbbc6a7833p-54, 0x1.212c969559b43p-110},
+  {0x1.4eb2d81d8abffp+0, -0x1.5257d2e5d7a52p-54, -0x1.e770e5a11db22p-109},
+  {0x1.4f9b2769d2ca7p+0, -0x1.4b309d25957e3p-54, -0x1.1aa1fd7b685cdp-112},
+  {0x1.508417f4531eep+0, 0x1.a249b49b7465fp-56, -0x1.f426d5f0a11f8p-111},
+  {0x1.516daa2cf6642p+0, -0x1.f768569bd93efp-55, 0x1.90e718226177dp-112},
+  {0x1.5257de83f4eefp+0, -0x1.c998d43efef71p-56, -0x1.0974a1675d1e8p-110},
+  {0x1.5342b569d4f82p+0, -0x1.07abe1db13cadp-55, 0x1.fa733951f214cp-111},
+  {0x1.542e2f4f6ad27p+0, 0x1.7926d192d5f7ep-55, -0x1.126782ea06baap-110},
+  {0x1.551a4ca5d920fp+0, -0x1.d689cefede59bp-55, 0x1.9c991771b0493p-110},
+  {0x1.56070dde910d2p+0, -0x1.0fb6e168eebf0p-54, 0x1.91129ae575c71p-108},
+  {0x1.56f4736b527dap+0, 0x1.9bb2c011d93adp-54, -0x1.ff86852a613ffp-111},
+  {0x1.57e27dbe2c4cfp+0, -0x1.0b98c8a57b9c4p-54, -0x1.d39891f4faa20p-108},
+  {0x1.58d12d497c7fdp+0, 0x1.295e15b9a1de8p-55, -0x1.a26d92ad1e4c6p-109},
+  {0x1.59c0827ff07ccp+0, -0x1.7e2cee467e60fp-54, 0x1.d0c772f1bbc25p-109},
+  {0x1.5ab07dd485429p+0, 0x1.6324c054647adp-54, -0x1.744ee506fdafep-109},
+  {0x1.5ba11fba87a03p+0, -0x1.b77a14c233e1ap-54, 0x1.476dfb1884200p-108},
+  {0x1.5c9268a5946b7p+0, 0x1.c4b1b816986a2p-60, 0x1.ec2735254978cp-119},
+  {0x1.5d84590998b93p+0, -0x1.cd6a7a8b45643p-54, 0x1.26dcfecd1b7fbp-108},
+  {0x1.5e76f15ad2148p+0, 0x1.ba6f93080e65ep-54, -0x1.95f9ab75fa7d6p-108},
+  {0x1.5f6a320dceb71p+0, -0x1.9eadde3cdcf92p-55, 0x1.0e1a6fbc77479p-109},
+  {0x1.605e1b976dc09p+0, -0x1.3e2429b56de47p-54, -0x1.32c54b92e2588p-110},
+  {0x1.6152ae6cdf6f4p+0, 0x1.e4b3e4ab84c27p-54, -0x1.5a3ca64325ac8p-111},
+  {0x1.6247eb03a5585p+0, -0x1.383c17e40b497p-54, 0x1.5d8e757cfb991p-111},
+  {0x1.633dd1d1929fdp+0, 0x1.84710beb964e5p-54, 0x1.72e21510bddb6p-108},
+  {0x1.6434634ccc320p+0, -0x1.c483c759d8933p-55, 0x1.3904000c1c40fp-110},
+  {0x1.652b9febc8fb7p+0, -0x1.ae3d5c9a73e09p-54, 0x1.3fda68a873c1ap-108},
+  {0x1.6623882552225p+0, -0x1.bb60987591c34p-54, 0x1.4a337f4dc0a3bp-108},
+  {0x1.671c1c70833f6p+0, -0x1.e8732586c6134p-55, 0x1.f59e80d44da25p-109},
+  {0x1.68155d44ca973p+0, 0x1.038ae44f73e65p-57, -0x1.f2803633b04ffp-113},
+  {0x1.690f4b19e9538p+0, 0x1.804bd9aeb445dp-55, -0x1.8f8eac8bcebaap-109},
+  {0x1.6a09e667f3bcdp+0, -0x1.bdd3413b26456p-54, 0x1.57d3e3adec175p-108},
+  {0x1.6b052fa75173ep+0, 0x1.a38f52c9a9d0ep-56, 0x1.96bba59626d18p-111},
+  {0x1.6c012750bdabfp+0, -0x1.2895667ff0b0dp-56, 0x1.fef5c58766c19p-111},
+  {0x1.6cfdcddd47645p+0, 0x1.c7aa9b6f17309p-54, -0x1.880cb27e97d9ep-111},
+  {0x1.6dfb23c651a2fp+0, -0x1.bbe3a683c88abp-57, 0x1.a59f88abbe778p-115},
+  {0x1.6ef9298593ae5p+0, -0x1.0b9749e1ac8b2p-54, -0x1.a8db3ca2ad190p-110},
+  {0x1.6ff7df9519484p+0, -0x1.83c0f25860ef6p-55, -0x1.001923f4a956ep-110},
+  {0x1.70f7466f42e87p+0, 0x1.9d644d45aa65fp-58, -0x1.d9ca88f47a2a1p-113},
+  {0x1.71f75e8ec5f74p+0, -0x1.16e4786887a99p-55, -0x1.269796953a4c3p-109},
+  {0x1.72f8286ead08ap+0, -0x1.20aa02cd62c72p-54, -0x1.88dfb7e0baf87p-109},
+  {0x1.73f9a48a58174p+0, -0x1.0a8d96c65d53cp-54, 0x1.82ae217f3a768p-108},
+  {0x1.74fbd35d7cbfdp+0, 0x1.047fd618a6e1cp-54, 0x1.b42033fadb904p-108},
+  {0x1.75feb564267c9p+0, -0x1.0245957316dd3p-54, -0x1.8f8e7fa19e5e8p-108},
+  {0x1.77024b1ab6e09p+0, 0x1.b7877169147f8p-54, -0x1.eb9c5d1e7b193p-112},
+  {0x1.780694fde5d3fp+0, 0x1.866b80a02162dp-54, -0x1.44d42307932f7p-108},
+  {0x1.790b938ac1cf6p+0, 0x1.349a862aadd3ep-54, -0x1.0b109d64fbd5fp-110},
+  {0x1.7a11473eb0187p+0, -0x1.41577ee04992fp-55, -0x1.4217a932d10d4p-113},
+  {0x1.7b17b0976cfdbp+0, -0x1.bebb58468dc88p-54, -0x1.303754b0bc06dp-109},
+  {0x1.7c1ed0130c132p+0, 0x1.f124cd1164dd6p-54, -0x1.d4d236cc2bb03p-108},
+  {0x1.7d26a62ff86f0p+0, 0x1.1bddbfb72b8b4p-54, -0x1.9da5eb6946f8cp-108},
+  {0x1.7e2f336cf4e62p+0, 0x1.05d02ba15797ep-56, 0x1.70a1427f8fcdfp-112},
+  {0x1.7f3878491c491p+0, -0x1.07f11cf9311aep-55, 0x1.19f0b3685b7ffp-109},
+  {0x1.80427543e1a12p+0, -0x1.27c86626d972bp-54, 0x1.d4e0d71c9b16ep-109},
+  {0x1.814d2add106d9p+0, 0x1.464370d151d4dp-54, 0x1.c694d6561d277p-108},
+  {0x1.82589994cce13p+0, -0x1.d4c1dd41532d8p-54, 0x1.0f6ad65cbbac1p-112},
+  {0x1.8364c1eb941f7p+0, 0x1.99b9a31df2bd5p-54, 0x1.e5100ab05208bp-109},
+  {0x1.8471a4623c7adp+0, -0x1.8d684a341cdfbp-55, -0x1.591e15c16efd1p-109},
+  {0x1.857f4179f5b21p+0, -0x1.ba748f8b216d0p-58, 0x1.a58e6e72eee90p-112},
+  {0x1.868d99b4492edp+0, -0x1.fc6f89bd4f6bap-54, -0x1.f16f65181d921p-109},
+  {0x1.879cad931a436p+0, 0x1.5d2d7d2db47bdp-55, -0x1.79679c19ea91fp-110},
+  {0x1.88ac7d98a6699p+0, 0x1.994c2f37cb53ap-54, 0x1.d61283ef385dep-108},
+  {0x1.89bd0a478580fp+0, 0x1.d53954475202bp-54, -0x1.ffd8e923800f4p-108},
+  {0x1.8ace5422aa0dbp+0, 0x1.6e9f156864b27p-54, -0x1.30644a7836333p-110},
+  {0x1.8be05bad61778p+0, 0x1.ecb5efc43446ep-54, 0x1.e4ef1b4f47e60p-108},
+  {0x1.8cf3216b5448cp+0, -0x1.0d55e32e9e3aap-56, -0x1.3dab3db839dd6p-111},
+  {0x1.8e06a5e0866d9p+0, -0x1.7114a6fc9b2e6p-54, 0x1.1d162ae347ca3p-108},
+  {0x1.8f1ae99157736p+0, 0x1.5cc13a2e3976cp-55, 0x1.3bf26d2b85163p-114},
+  {0x1.902fed0282c8ap+0, 0x1.592ca85fe3fd2p-54, 0x1.9aaeca60a407ap-108},
+  {0x1.9145b0b91ffc6p+0, -0x1.dd6792e582524p-54, 0x1.c03855204534ap-109},
+  {0x1.925c353aa2fe2p+0, -0x1.3455fa639db7fp-55, -0x1.a049aab220b43p-109},
+  {0x1.93737b0cdc5e5p+0, -0x1.75fc781b57ebcp-57, 0x1.697e257ac0db2p-111},
+  {0x1.948b82b5f98e5p+0, -0x1.dc3d6797d2d99p-55, -0x1.4a682ed507e0bp-109},
+  {0x1.95a44cbc8520fp+0, -0x1.64b7c96a5f039p-56, -0x1.07053c9a98bbbp-113},
+  {0x1.96bdd9a7670b3p+0, -0x1.ba5967f19c896p-58, 0x1.c4833e2a01129p-112},
+  {0x1.97d829fde4e50p+0, -0x1.d185b7c1b85d1p-54, 0x1.7edb9d7144b6fp-108},
+  {0x1.98f33e47a22a2p+0, 0x1.cabdaa24c78edp-56, -0x1.f2ec2c877c312p-110},
+  {0x1.9a0f170ca07bap+0, -0x1.173bd91cee632p-54, -0x1.053987854965fp-110},
+  {0x1.9b2bb4d53fe0dp+0, -0x1.dd84e4df6d518p-54, 0x1.f67e4fe184b31p-110},
+  {0x1.9c49182a3f090p+0, 0x1.c7c46b071f2bep-56, 0x1.6376b7943085cp-110},
+  {0x1.9d674194bb8d5p+0, -0x1.516bea3dd8233p-54, -0x1.519baeb91c698p-110},
+  {0x1.9e86319e32323p+0, 0x1.824ca78e64c6ep-56, 0x1.0f92c082bbae0p-116},
+  {0x1.9fa5e8d07f29ep+0, -0x1.4a9ceaaf1facep-55, 0x1.4f0e6fc88785dp-109},
+  {0x1.a0c667b5de565p+0, -0x1.359495d1cd533p-54, 0x1.354084551b4fbp-109},
+  {0x1.a1e7aed8eb8bbp+0, 0x1.c6618ee8be70ep-54, 0x1.b7f2fb72d78c0p-108},
+  {0x1.a309bec4a2d33p+0, 0x1.6305c7ddc36abp-54, 0x1.547fa22c26d17p-108},
+  {0x1.a42c980460ad8p+0, -0x1.aa780589fb120p-54, -0x1.d6e9e41d89183p-108},
+  {0x1.a5503b23e255dp+0, -0x1.d2f6edb8d41e1p-54, -0x1.bfd7adfd63f48p-111},
+  {0x1.a674a8af46052p+0, 0x1.50f5630670366p-57, 0x1.b8696ee520475p-112},
+  {0x1.a799e1330b358p+0, 0x1.bcb7ecac563c7p-54, -0x1.678693176f751p-108},
+  {0x1.a8bfe53c12e59p+0, -0x1.4f867b2ba15a9p-54, 0x1.01f0d566ba176p-108},
+  {0x1.a9e6b5579fdbfp+0, 0x1.0fac90ef7fd31p-54, 0x1.8b16ae39e8cb9p-109},
+  {0x1.ab0e521356ebap+0, 0x1.89c31dae94545p-55, -0x1.af43b90f0d971p-110},
+  {0x1.ac36bbfd3f37ap+0, -0x1.f9234cae76cd0p-55, -0x1.c60dbfc7696f8p-111},
+  {0x1.ad5ff3a3c2774p+0, 0x1.7ef3bb6b1b8e5p-54, -0x1.31a55d12f2b84p-108},
+  {0x1.ae89f995ad3adp+0, 0x1.7a1cd345dcc81p-54, 0x1.a7fbc3ae675eap-108},
+  {0x1.afb4ce622f2ffp+0, -0x1.4b2fc0f315ecdp-54, 0x1.252d2a6932f30p-108},
+  {0x1.b0e07298db666p+0, -0x1.bdef54c80e425p-54, 0x1.41cbb95c55600p-109},
+  {0x1.b20ce6c9a8952p+0, 0x1.4dd024a0756ccp-54, -0x1.883daf6928c9ep-108},
+  {0x1.b33a2b84f15fbp+0, -0x1.2805e3084d708p-57, 0x1.2babc0edda4d9p-111},
+  {0x1.b468415b749b1p+0, -0x1.f763de9df7c90p-56, -0x1.3e5401cf3f56fp-111},
+  {0x1.b59728de5593ap+0, -0x1.c71dfbbba6de3p-54, -0x1.c7470081df7dfp-111},
+  {0x1.b6c6e29f1c52ap+0, 0x1.2a8f352883f6ep-54, 0x1.7a1ee98a99862p-109},
+  {0x1.b7f76f2fb5e47p+0, -0x1.5584f7e54ac3bp-56, 0x1.aa64481e1ab72p-111},
+  {0x1.b928cf22749e4p+0, -0x1.b721654cb65c6p-54, 0x1.5111ed9312467p-109},
+  {0x1.ba5b030a1064ap+0, -0x1.efcd30e54292ep-54, -0x1.ad1bf91503c67p-113},
+  {0x1.bb8e0b79a6f1fp+0, -0x1.f52d1c9696205p-60, -0x1.1b499b8052088p-115},
+  {0x1.bcc1e904bc1d2p+0, 0x1.23dd07a2d9e84p-55, 0x1.9a164050e1258p-109},
+  {0x1.bdf69c3f3a207p+0, -0x1.c262360ea5b52p-60, -0x1.b2ab8c26584ffp-114},
+  {0x1.bf2c25bd71e09p+0, -0x1.efdca3f6b9c73p-54, 0x1.27e81cecd59dap-110},
+  {0x1.c06286141b33dp+0, -0x1.d8a5aa1fbca34p-55, -0x1.6fd5d0fdf4695p-110},
+  {0x1.c199bdd85529cp+0, 0x1.11065895048ddp-55, 0x1.99e51125928dap-110},
+  {0x1.c2d1cd9fa652cp+0, -0x1.6e51617c8a5d7p-54, -0x1.5af0e37eae5dep-110},
+  {0x1.c40ab5fffd07ap+0, 0x1.b4537e083c60ap-54, 0x1.4a6cdfa70f4f8p-109},
+  {0x1.c544778fafb22p+0, 0x1.12f072493b5afp-54, 0x1.7634e44f583acp-109},
+  {0x1.c67f12e57d14bp+0, 0x1.2884dff483cadp-54, -0x1.fc44c329d5cb2p-109},
+  {0x1.c7ba88988c933p+0, -0x1.e76bbbe255559p-55, -0x1.239845875b500p-110},
+  {0x1.c8f6d9406e7b5p+0, 0x1.1acbc48805c44p-56, 0x1.6edaac100b8fap-111},
+  {0x1.ca3405751c4dbp+0, -0x1.7f2bed10d08f5p-55, 0x1.45233cc94585ap-114},
+  {0x1.cb720dcef9069p+0, 0x1.503cbd1e949dbp-56, 0x1.d8765566b032ep-110},
+  {0x1.ccb0f2e6d1675p+0, -0x1.d220f86009093p-56, 0x1.e0424e773b3b3p-110},
+  {0x1.cdf0b555dc3fap+0, -0x1.dd83b53829d72p-55, -0x1.aea073a742049p-112},
+  {0x1.cf3155b5bab74p+0, -0x1.a08e9b86dff57p-54, -0x1.743fe56ba6df7p-110},
+  {0x1.d072d4a07897cp+0, -0x1.cbc3743797a9cp-54, -0x1.e7044039da0f6p-108},
+  {0x1.d1b532b08c968p+0, 0x1.55636219a36eep-54, -0x1.96ce6c611cd73p-108},
+  {0x1.d2f87080d89f2p+0, -0x1.d487b719d8578p-54, 0x1.2da62b2a9fae7p-111},
+  {0x1.d43c8eacaa1d6p+0, 0x1.3db53bf5a1614p-54, 0x1.420bd107a56f7p-108},
+  {0x1.d5818dcfba487p+0, 0x1.2ed02d75b3707p-55, -0x1.ab053b05531fcp-111},
+  {0x1.d6c76e862e6d3p+0, 0x1.fe87a4a8165a0p-58, 0x1.b1701f59c75ffp-114},
+  {0x1.d80e316c98398p+0, -0x1.11ec18beddfe8p-54, -0x1.ed04e7ac8765ap-110},
+  {0x1.d955d71ff6075p+0, 0x1.a052dbb9af6bep-54, 0x1.30dc526492014p-108},
+  {0x1.da9e603db3285p+0, 0x1.c2300696db532p-54, 0x1.7f6246f0ec615p-108},
+  {0x1.dbe7cd63a8315p+0, -0x1.b76f1926b8be4p-54, -0x1.0838f11e6612dp-108},
+  {0x1.dd321f301b460p+0, 0x1.2da5778f018c3p-54, -0x1.c6cdead661cf3p-108},
+  {0x1.de7d5641c0658p+0, -0x1.ca5528e79ba8fp-54, 0x1.4f9fd822b5ee1p-109},
+  {0x1.dfc97337b9b5fp+0, -0x1.1a5cd4f184b5cp-54, 0x1.b7225a944efd6p-108},
+  {0x1.e11676b197d17p+0, -0x1.2b529bd5c7f44p-56, 0x1.386309ca5072ap-110},
+  {0x1.e264614f5a129p+0, -0x1.7b627817a1496p-54, -0x1.b9818808c409ap-108},
+  {0x1.e3b333b16ee12p+0, -0x1.9f4a431fdc68bp-54, 0x1.8b86d919ec784p-108},
+  {0x1.e502ee78b3ff6p+0, 0x1.39e8980a9cc8fp-55, 0x1.1e92cb3c2d278p-109},
+  {0x1.e653924676d76p+0, -0x1.63ff87522b735p-55, 0x1.1bdfc8db5a718p-110},
+  {0x1.e7a51fbc74c83p+0, 0x1.2d522ca0c8de2p-54, -0x1.8a757b0b6a9cbp-108},
+  {0x1.e8f7977cdb740p+0, -0x1.1089480b054b1p-54, 0x1.306ae5803b7cbp-109},
+  {0x1.ea4afa2a490dap+0, -0x1.e9c23179c2893p-54, -0x1.fc0f242bbf3dep-109},
+  {0x1.eb9f4867cca6ep+0, 0x1.4832f2293e4f2p-54, -0x1.90fc40251cbe8p-108},
+  {0x1.ecf482d8e67f1p+0, -0x1.c93f3b411ad8cp-54, -0x1.0b9dfef44b43bp-108},
+  {0x1.ee4aaa2188510p+0, 0x1.1c68da487568dp-54, 0x1.31c8db5077e24p-110},
+  {0x1.efa1bee615a27p+0, 0x1.dc7f486a4b6b0p-54, 0x1.f6dd5d229ff69p-108},
+  {0x1.f0f9c1cb6412ap+0, -0x1.3220065181d45p-54, -0x1.3f8114293b05bp-108},
+  {0x1.f252b376bba97p+0, 0x1.3a1a5bf0d8e43p-54, 0x1.4c6ad5476b516p-108},
+  {0x1.f3ac948dd7274p+0, -0x1.95a5a3ed837dep-56, 0x1.40a183fe4cc10p-112},
+  {0x1.f50765b6e4540p+0, 0x1.9d3e12dd8a18bp-54, -0x1.4019bffc80ef3p-110},
+  {0x1.f6632798844f8p+0, 0x1.fa37b3539343ep-54, 0x1.726a45a4c9e13p-109},
+  {0x1.f7bfdad9cbe14p+0, -0x1.dbb12d006350ap-54, 0x1.5c5ce7280fa4dp-108},
+  {0x1.f91d802243c89p+0, -0x1.12ea8a779f689p-57, -0x1.89324bfc3ef57p-111},
+  {0x1.fa7c1819e90d8p+0, 0x1.74853f3a5931ep-55, 0x1.dc060c36f7651p-112},
+  {0x1.fbdba3692d514p+0, -0x1.9677315098eb6p-56, 0x1.b0cd4d28a9a32p-110},
+  {0x1.fd3c22b8f71f1p+0, 0x1.2eb74966579e7p-57, 0x1.2f096934ec56cp-111},
+  {0x1.fe9d96b2a23d9p+0, 0x1.4a6037442fde3p-56, 0x1.baf85e8130af3p-112}
+};
+
+/* 1/n! as triple-doubles for n <= 8, then doubles */
+static const double expq_coeff_td[9][3] = {
+  {0x1.0000000000000p+0, 0.0, 0.0},
+  {0x1.0000000000000p+0, 0.0, 0.0},
+  {0x1.0000000000000p-1, 0.0, 0.0},
+  {0x1.5555555555555p-3, 0x1.5555555555555p-57, 0x1.5555555555555p-111},
+  {0x1.5555555555555p-5, 0x1.5555555555555p-59, 0x1.5555555555555p-113},
+  {0x1.1111111111111p-7, 0x1.1111111111111p-63, 0x1.1111111111111p-119},
+  {0x1.6c16c16c16c17p-10, -0x1.f49f49f49f49fp-65, -0x1.27d27d27d27d2p-119},
+  {0x1.a01a01a01a01ap-13, 0x1.a01a01a01a01ap-73, 0x1.a01a01a01a01ap-133},
+  {0x1.a01a01a01a01ap-16, 0x1.a01a01a01a01ap-76, 0x1.a01a01a01a01ap-136}
+};
+
+#define EXPQ_C9 0x1.71de3a556c734p-19
+#define EXPQ_C10 0x1.27e4fb7789f5cp-22
+#define EXPQ_C11 0x1.ae64567f544e4p-26
+#define EXPQ_C12 0x1.1eed8eff8d898p-29
+
+/* For i = 181 to 362: c_i, 256/i on 12 bits, and -log(c_i) as a
+   triple-double */
+static const double logq_table[182][4] = {
+  {0x1.6a20000000000p+0, -0x1.6322b01ee61c0p-2, 0x1.f298279802634p-57, -0x1.cf20709f442dbp-111},
+  {0x1.6820000000000p+0, -0x1.5d76dd9a778d0p-2, -0x1.279b3b76168b3p-57, -0x1.09b813a47164dp-112},
+  {0x1.6620000000000p+0, -0x1.57c2f53b05209p-2, -0x1.4c017c2a52127p-57, -0x1.6225be43e3f61p-113},
+  {0x1.6420000000000p+0, -0x1.5206dfd186716p-2, -0x1.9fa51e79aff41p-57, 0x1.91330406e79fcp-111},
+  {0x1.6240000000000p+0, -0x1.4c9f09e152c3cp-2, -0x1.10c78fe91038bp-56, 0x1.69de1e1ecc94dp-110},
+  {0x1.6060000000000p+0, -0x1.472fdbe4fd3f2p-2, -0x1.b2629fc10f5b7p-56, -0x1.4bb105a5e193bp-111},
+  {0x1.5e80000000000p+0, -0x1.41b941cce0beep-2, -0x1.6fec1bc0376f6p-56, 0x1.b2e6039994f89p-111},
+  {0x1.5ca0000000000p+0, -0x1.3c3b2736b3f61p-2, 0x1.747a74f77e325p-57, 0x1.7f5da60e8aaddp-111},
+  {0x1.5ac0000000000p+0, -0x1.36b5776bc1117p-2, 0x1.a1e958f770386p-56, -0x1.249148845c38cp-110},
+  {0x1.58e0000000000p+0, -0x1.31281d5f10fa4p-2, -0x1.ef195748543f8p-56, -0x1.d4b979857bdbdp-112},
+  {0x1.5720000000000p+0, -0x1.2bf287cc41362p-2, 0x1.6156c4e26290bp-58, -0x1.29655e65eaccdp-113},
+  {0x1.5560000000000p+0, -0x1.26b620935063cp-2, -0x1.1767e2e6f25cep-57, 0x1.6823e8ce727c0p-111},
+  {0x1.53a0000000000p+0, -0x1.2172d5c2abbbbp-2, 0x1.594223fc705c0p-56, 0x1.c4d9650e24f37p-110},
+  {0x1.51e0000000000p+0, -0x1.1c2895218f2c0p-2, 0x1.ed37f8d4b1345p-58, -0x1.3c5e5b00960c8p-112},
+  {0x1.5020000000000p+0, -0x1.16d74c2e8ac66p-2, 0x1.e134b941dc654p-59, -0x1.027d7744f7a41p-114},
+  {0x1.4e60000000000p+0, -0x1.117ee81dfe4c4p-2, 0x1.10eba2e6869b7p-57, -0x1.4533f3afe3d2dp-112},
+  {0x1.4ca0000000000p+0, -0x1.0c1f55d88a8a1p-2, 0x1.9ef6c0426ae00p-56, 0x1.83e4979278cb2p-110},
+  {0x1.4b00000000000p+0, -0x1.071b85fcd590dp-2, -0x1.d1707f97bde80p-58, -0x1.00ca1b7fa08dap-113},
+  {0x1.4960000000000p+0, -0x1.021164a9290ddp-2, -0x1.43f9daeecc232p-58, -0x1.b8f8a9300fad8p-114},
+  {0x1.47a0000000000p+0, -0x1.f939c4e72d59dp-3, -0x1.e500ec33c030bp-63, -0x1.e9e4e85413128p-118},
+  {0x1.4600000000000p+0, -0x1.ef0adcbdc5936p-3, -0x1.48637950dc20dp-57, 0x1.eb052d7b3cbe3p-111},
+  {0x1.4460000000000p+0, -0x1.e4ceeda61dda6p-3, -0x1.a0e33f47845a2p-57, 0x1.a7b873de21446p-111},
+  {0x1.42e0000000000p+0, -0x1.db50da24bd322p-3, 0x1.6fa403574f7afp-57, 0x1.5a577cfcfa794p-112},
+  {0x1.4140000000000p+0, -0x1.d0fb7f2255e51p-3, 0x1.4ac818ceca4c4p-57, 0x1.2fdad5e675d74p-111},
+  {0x1.3fc0000000000p+0, -0x1.c765b9e4d68d6p-3, 0x1.2992d12127811p-57, -0x1.a1422344171eep-111},
+  {0x1.3e20000000000p+0, -0x1.bcf6736f7d6c7p-3, -0x1.76b0a6e1c43a2p-60, -0x1.6b80b04d142fdp-114},
+  {0x1.3ca0000000000p+0, -0x1.b34885022e81ep-3, 0x1.5e99b6f2309fap-58, -0x1.4e358cdc4fb59p-113},
+  {0x1.3b20000000000p+0, -0x1.a98ed238b8089p-3, -0x1.bfed1ee6b0199p-58, 0x1.03656d57025b7p-112},
+  {0x1.39a0000000000p+0, -0x1.9fc93e5409c31p-3, 0x1.7329d09885e3bp-59, 0x1.ce8c5cf0261a2p-113},
+  {0x1.3820000000000p+0, -0x1.95f7ac2b3b4f5p-3, -0x1.442f000de8626p-59, 0x1.bc20fb0b5f66dp-113},
+  {0x1.36a0000000000p+0, -0x1.8c19fe2982058p-3, 0x1.fe1f2836ed575p-57, -0x1.84347814e8c9fp-111},
+  {0x1.3520000000000p+0, -0x1.8230164c1a332p-3, 0x1.14bad17a5bddbp-57, 0x1.3db53ca01b730p-111},
+  {0x1.33a0000000000p+0, -0x1.7839d62023552p-3, 0x1.8b08013e47f9cp-57, -0x1.4366858a3972bp-113},
+  {0x1.3240000000000p+0, -0x1.6f0d28ae56b4cp-3, 0x1.906d99184b992p-57, 0x1.bf31af3e109afp-111},
+  {0x1.30e0000000000p+0, -0x1.65d5e99cc3c47p-3, -0x1.e5b8d5321bfa8p-57, -0x1.a3d41d3c892c5p-112},
+  {0x1.2f60000000000p+0, -0x1.5bbc05f140486p-3, -0x1.258abb468d482p-58, -0x1.f5c817d7f3beep-112},
+  {0x1.2e00000000000p+0, -0x1.526e5e3a1b438p-3, 0x1.746ff8a470d3ap-57, -0x1.a6dbcc63b5444p-111},
+  {0x1.2ca0000000000p+0, -0x1.4915d832fb562p-3, 0x1.dc00d79ec3456p-57, 0x1.c20d0c999d302p-111},
+  {0x1.2b40000000000p+0, -0x1.3fb25a59528cbp-3, 0x1.065329c022936p-58, -0x1.0f26300e690e2p-113},
+  {0x1.29e0000000000p+0, -0x1.3643cad0588f1p-3, 0x1.c37b3480acbdbp-58, 0x1.13c57c1e0b674p-112},
+  {0x1.2880000000000p+0, -0x1.2cca0f5f5f251p-3, 0x1.e3235fe23f016p-57, 0x1.bb90f61b60780p-113},
+  {0x1.2740000000000p+0, -0x1.2423113ba50e3p-3, 0x1.e3ba766fc9a72p-66, 0x1.f418c38a70bbep-120},
+  {0x1.25e0000000000p+0, -0x1.1a93b7d42f611p-3, 0x1.77e9d8abe639fp-57, 0x1.d47034c80c611p-112},
+  {0x1.24a0000000000p+0, -0x1.11d8e5e290472p-3, 0x1.05ad155aa5374p-57, 0x1.6e66131eb80f6p-111},
+  {0x1.2340000000000p+0, -0x1.08338affa282ap-3, 0x1.86a6fb83b1dbap-57, -0x1.69f8810bb7610p-113},
+  {0x1.2200000000000p+0, -0x1.fec9131dbeabbp-4, 0x1.5746b9981b36cp-58, 0x1.c4016e1d457eep-112},
+  {0x1.20c0000000000p+0, -0x1.ed1794e83780cp-4, 0x1.43749d0483dcap-58, -0x1.c0f9ff79a163dp-113},
+  {0x1.1f80000000000p+0, -0x1.db5270187d927p-4, -0x1.e15ab8607d2acp-58, -0x1.78272bb99f905p-112},
+  {0x1.1e20000000000p+0, -0x1.c7af7a8472d76p-4, -0x1.472281ea1f818p-58, 0x1.822ed68f44f1cp-112},
+  {0x1.1d00000000000p+0, -0x1.b78c82bb0eda1p-4, -0x1.0878cf0327e21p-61, 0x1.b0b1387f2d48fp-115},
+  {0x1.1bc0000000000p+0, -0x1.a58b60c2b2324p-4, 0x1.cd71727ca7984p-58, -0x1.562dd7131600ap-112},
+  {0x1.1a80000000000p+0, -0x1.9375e55595edep-4, 0x1.e463f9e4dd920p-59, -0x1.e4b086a4e6d9fp-113},
+  {0x1.1940000000000p+0, -0x1.814be23f8c036p-4, -0x1.1c0ed417efe41p-58, -0x1.d8df9d1a70ebbp-113},
+  {0x1.1820000000000p+0, -0x1.70e12b325c82ap-4, 0x1.e4d51d665d0f7p-58, -0x1.0e85ab645115fp-113},
+  {0x1.16e0000000000p+0, -0x1.5e8fa4d8591c7p-4, 0x1.8fb947780f93dp-63, -0x1.5b9796d719d53p-117},
+  {0x1.15c0000000000p+0, -0x1.4e01108a35ae6p-4, 0x1.81069d28db75bp-59, 0x1.4cd1946287690p-116},
+  {0x1.1480000000000p+0, -0x1.3b87598b1b6eep-4, 0x1.594aca31297a3p-61, -0x1.39ff314be96ccp-116},
+  {0x1.1360000000000p+0, -0x1.2ad449eff2316p-4, 0x1.d72f82dc39ca0p-59, 0x1.28b2b943ccb4fp-114},
+  {0x1.1240000000000p+0, -0x1.1a0fba1bf8a52p-4, 0x1.9e731491f21c9p-64, 0x1.667d54205aa7cp-118},
+  {0x1.1120000000000p+0, -0x1.0939853a1cc8cp-4, 0x1.3c34f846e1c9fp-58, -0x1.a98e39b028724p-112},
+  {0x1.0fe0000000000p+0, -0x1.ecdf0f87b6168p-5, -0x1.0c529ff02178cp-59, 0x1.e028d5133cfbfp-113},
+  {0x1.0ec0000000000p+0, -0x1.cae72fb95c20bp-5, 0x1.f9012d8df3f0ep-59, -0x1.ed439b9a8ce34p-114},
+  {0x1.0dc0000000000p+0, -0x1.ac97221711f8dp-5, -0x1.f780991163015p-60, -0x1.23500f4e0f68dp-114},
+  {0x1.0ca0000000000p+0, -0x1.8a5a9cc614ca4p-5, 0x1.4800c074d0c95p-59, 0x1.f619d2a14dd7fp-117},
+  {0x1.0b80000000000p+0, -0x1.67f94f094bd98p-5, -0x1.f3e7e4ed6b2d6p-60, -0x1.3c5893f2bd805p-121},
+  {0x1.0a60000000000p+0, -0x1.4572e981cad90p-5, 0x1.5064c828a904cp-60, -0x1.1e11b6705e162p-114},
+  {0x1.0960000000000p+0, -0x1.26a32a86d2f72p-5, 0x1.ea56fe240fa05p-62, -0x1.837bf87f4e0bfp-117},
+  {0x1.0840000000000p+0, -0x1.03d5d85e73eefp-5, -0x1.2c1da539d60edp-61, 0x1.b07eeee48433fp-115},
+  {0x1.0740000000000p+0, -0x1.c98d18d00c814p-6, 0x1.50589df0f25bfp-61, -0x1.101963b4c9c5cp-116},
+  {0x1.0620000000000p+0, -0x1.83624fba83bd7p-6, -0x1.c96b4004622b7p-61, -0x1.710c9bab5f20dp-118},
+  {0x1.0520000000000p+0, -0x1.44c28d451662cp-6, -0x1.4a08cf28350efp-61, -0x1.c1afd3f69a02fp-115},
+  {0x1.0420000000000p+0, -0x1.05e547826bc91p-6, 0x1.e21f5e1f7e49ep-60, 0x1.0e131f39e3061p-115},
+  {0x1.0300000000000p+0, -0x1.7dc475f810a77p-7, 0x1.16d7687d3df21p-62, -0x1.a850a4a1800eap-117},
+  {0x1.0200000000000p+0, -0x1.fe02a6b106789p-8, 0x1.e44b7e3711ebfp-67, -0x1.a567b6587df34p-121},
+  {0x1.0100000000000p+0, -0x1.ff00aa2b10bc0p-9, -0x1.2821ad5a6d353p-63, 0x1.12dcccb588a4ap-118},
+  {0x1.0000000000000p+0, 0.0, 0.0, 0.0},
+  {0x1.fe00000000000p-1, 0x1.0080559588b35p-8, 0x1.f96638cf63677p-62, -0x1.90badb5e868b4p-117},
+  {0x1.fc00000000000p-1, 0x1.010157588de71p-7, 0x1.46662d417ced0p-62, 0x1.e91702f8418afp-120},
+  {0x1.fa20000000000p-1, 0x1.7a2c82e212c65p-7, -0x1.d1c95731568a4p-61, -0x1.569acaefdfcaep-116},
+  {0x1.f820000000000p-1, 0x1.fbea8b13c03d9p-7, 0x1.27b17e4e134e1p-62, -0x1.9383d797af314p-117},
+  {0x1.f640000000000p-1, 0x1.3b024b78c5669p-6, 0x1.e23a02f82a1d4p-60, 0x1.cdf2b3bec7218p-114},
+  {0x1.f440000000000p-1, 0x1.7c61b1cf5dee0p-6, 0x1.b83db2ddc8012p-60, -0x1.b1ab922e69a22p-114},
+  {0x1.f260000000000p-1, 0x1.b9e8027e1918ep-6, -0x1.bb4f4fcfb9727p-60, 0x1.ff4f528760892p-118},
+  {0x1.f080000000000p-1, 0x1.f7a9b16782856p-6, -0x1.36c720c147756p-60, -0x1.f7893db19a74ap-117},
+  {0x1.eea0000000000p-1, 0x1.1ad398c6cd588p-5, -0x1.b49716ef271a6p-59, 0x1.41f546eff1a4bp-113},
+  {0x1.ecc0000000000p-1, 0x1.39f07ba0ebd62p-5, 0x1.4eb2172bbbf58p-59, -0x1.81fa8462ecb3ep-113},
+  {0x1.eae0000000000p-1, 0x1.592bbc15215c9p-5, -0x1.e5634e6c1fbfcp-62, -0x1.4800b9e33714ap-116},
+  {0x1.e920000000000p-1, 0x1.766d923c20ff8p-5, 0x1.505e384982ab6p-59, -0x1.57e8929d22fd2p-114},
+  {0x1.e740000000000p-1, 0x1.95e430f8ce45ep-5, -0x1.67bb43a6e5d7fp-60, -0x1.f446380a1204cp-115},
+  {0x1.e580000000000p-1, 0x1.b35dd9b58baadp-5, -0x1.6526154e379dfp-61, -0x1.1bd01fb2f2df1p-115},
+  {0x1.e3a0000000000p-1, 0x1.d310ba20455a1p-5, 0x1.4dbdae98f9f4cp-59, -0x1.681d5d351acb1p-114},
+  {0x1.e1e0000000000p-1, 0x1.f0c30c1116351p-5, 0x1.94ee90500a333p-62, 0x1.05e6f9f2f21aep-116},
+  {0x1.e020000000000p-1, 0x1.074883629640bp-4, -0x1.51ee824c30c1fp-59, -0x1.a09104f2cd32ep-113},
+  {0x1.de60000000000p-1, 0x1.163d6ef957a03p-4, 0x1.3f1c9c64537c0p-60, -0x1.03b10506e11d5p-115},
+  {0x1.dca0000000000p-1, 0x1.254062f0a9417p-4, -0x1.af40c3a9bab6dp-64, -0x1.1e4309334997ap-118},
+  {0x1.dae0000000000p-1, 0x1.345179b63dd42p-4, 0x1.e9b0a868391a8p-63, 0x1.23e1bf255e6a4p-120},
+  {0x1.d920000000000p-1, 0x1.4370ce02b7de8p-4, -0x1.308315b2d0329p-59, 0x1.7cb93c45d337ep-113},
+  {0x1.d780000000000p-1, 0x1.518874226130ap-4, 0x1.d96258b3d8a8fp-60, 0x1.f3c88ae7c4087p-114},
+  {0x1.d5c0000000000p-1, 0x1.60c38ba79945dp-4, -0x1.3bc513ed6a1c8p-58, 0x1.9e5f57caca153p-112},
+  {0x1.d420000000000p-1, 0x1.6ef528c056a2cp-4, -0x1.8b5d9f2b77346p-58, -0x1.f9ad6b4bfc9f7p-113},
+  {0x1.d280000000000p-1, 0x1.7d33687c293c9p-4, -0x1.cf063e63e7075p-58, -0x1.ff8b750bae172p-112},
+  {0x1.d0c0000000000p-1, 0x1.8c985e9b9ec84p-4, -0x1.bbf21801ae8cbp-59, 0x1.18e22fb9983cep-115},
+  {0x1.cf20000000000p-1, 0x1.9af124d64c626p-4, -0x1.4f5f8c466d77ap-59, -0x1.605ff91bdce62p-113},
+  {0x1.cd80000000000p-1, 0x1.a956d3ecade63p-4, 0x1.e5300b12bd55ep-58, -0x1.2de0c305b64b0p-112},
+  {0x1.cbe0000000000p-1, 0x1.b7c9832f5801ap-4, 0x1.358893be169bfp-63, -0x1.db79455d108adp-117},
+  {0x1.ca40000000000p-1, 0x1.c6494a2e418a6p-4, -0x1.754df3b1a5d90p-60, 0x1.598b6807b68bfp-114},
+  {0x1.c8c0000000000p-1, 0x1.d3b73f37e1f9bp-4, -0x1.fd984b5ff12efp-58, -0x1.1fe1a4f227c3bp-117},
+  {0x1.c720000000000p-1, 0x1.e2507702af03bp-4, 0x1.0cff5bbb6e609p-58, 0x1.65f2c0664e1f9p-112},
+  {0x1.c580000000000p-1, 0x1.f0f70cdd992e3p-4, 0x1.f6c272c1dca71p-60, 0x1.6bcf79392483cp-116},
+  {0x1.c400000000000p-1, 0x1.fe89139dbd566p-4, -0x1.ac9f4215f9393p-58, -0x1.adc27bec88f8fp-112},
+  {0x1.c260000000000p-1, 0x1.06a4d1d26c5e6p-3, -0x1.b22efa3b4dedfp-57, 0x1.908fb5eed508bp-113},
+  {0x1.c0e0000000000p-1, 0x1.0d79e7cd48e5ap-3, 0x1.1423c24f1d3c1p-59, -0x1.6ea5434f113dfp-116},
+  {0x1.bf60000000000p-1, 0x1.1454d8953741cp-3, 0x1.6f103ed5fdceap-57, 0x1.1cbfd3ec32041p-111},
+  {0x1.bde0000000000p-1, 0x1.1b35ae3b81dbfp-3, -0x1.173b00b54eb3bp-57, 0x1.e52db8fd2f107p-112},
+  {0x1.bc40000000000p-1, 0x1.22aff2ddbd971p-3, -0x1.535834b0ffc28p-60, -0x1.d6b2e368201e2p-115},
+  {0x1.bac0000000000p-1, 0x1.299d30c606ea7p-3, -0x1.ff0c47ee4eafbp-57, -0x1.7dc5cc8b7a2cap-111},
+  {0x1.b960000000000p-1, 0x1.2ffbf29a6645cp-3, -0x1.b4621a2bc5451p-57, 0x1.5224761087e44p-111},
+  {0x1.b7e0000000000p-1, 0x1.36f4c27577593p-3, 0x1.d97c5ab133ffep-60, -0x1.f3c8a60f506f0p-114},
+  {0x1.b660000000000p-1, 0x1.3df3ab13505f7p-3, -0x1.8a4f7c9ebdc82p-57, 0x1.c991aa7551488p-111},
+  {0x1.b4e0000000000p-1, 0x1.44f8b726f8efbp-3, 0x1.4886573767e0fp-57, 0x1.bbac834c67c2bp-112},
+  {0x1.b380000000000p-1, 0x1.4b6d6fefe22a4p-3, 0x1.767ab73ca8d5ep-57, -0x1.f20afe53573b5p-114},
+  {0x1.b200000000000p-1, 0x1.527e5e4a1b58dp-3, -0x1.71a9682395bfdp-61, -0x1.6a40c7d689a68p-115},
+  {0x1.b0a0000000000p-1, 0x1.58fe0e4c62eaep-3, -0x1.0111e0128a1b8p-59, 0x1.02ce633bc0dd6p-114},
+  {0x1.af20000000000p-1, 0x1.601b076e7a8a9p-3, 0x1.afa9bf91ca867p-57, -0x1.bf12f7d291628p-112},
+  {0x1.adc0000000000p-1, 0x1.66a5d42a3ad34p-3, 0x1.267540052ff1dp-57, -0x1.7dea29f4e209ep-111},
+  {0x1.ac60000000000p-1, 0x1.6d35fee52b83bp-3, 0x1.814b09b1e0a37p-57, -0x1.0ebec80a52a7cp-111},
+  {0x1.ab00000000000p-1, 0x1.73cb9074fd14dp-3, -0x1.521a000b4cf01p-57, 0x1.c9084825ac5cdp-112},
+  {0x1.a980000000000p-1, 0x1.7b0091651528cp-3, 0x1.4069f303518c8p-57, 0x1.ffd33a4972427p-115},
+  {0x1.a820000000000p-1, 0x1.81a18b4220535p-3, -0x1.75d551b2a6857p-58, -0x1.730ca76960695p-112},
+  {0x1.a6e0000000000p-1, 0x1.87ad07c493478p-3, 0x1.5878f399ec494p-57, 0x1.b930aa633c38ep-111},
+  {0x1.a580000000000p-1, 0x1.8e588ebac2dbfp-3, -0x1.46a9a5dd7ff12p-57, -0x1.983686d411648p-111},
+  {0x1.a420000000000p-1, 0x1.9509aa0044f8fp-3, 0x1.9d6d34d717c19p-58, -0x1.5de7dc893eb1ep-112},
+  {0x1.a2c0000000000p-1, 0x1.9bc062f26fc3ap-3, 0x1.b03013cda9bfcp-57, 0x1.5d1c58c1b22eap-114},
+  {0x1.a160000000000p-1, 0x1.a27cc30640ecbp-3, -0x1.6d39b16890a9ep-57, 0x1.d855595e7ad49p-111},
+  {0x1.a020000000000p-1, 0x1.a8a14ffee66bdp-3, 0x1.f2ba95e8bb64bp-57, -0x1.48259a3b70552p-111},
+  {0x1.9ec0000000000p-1, 0x1.af6895610dbaep-3, -0x1.445fbd49bb184p-60, -0x1.17b97a13d91cfp-115},
+  {0x1.9d80000000000p-1, 0x1.b5971a213acdbp-3, -0x1.e2f8aadc42f8fp-57, 0x1.905b1e8cbd49cp-113},
+  {0x1.9c20000000000p-1, 0x1.bc69684aee63ep-3, -0x1.2a2ebe0642956p-57, -0x1.b6af51ed39286p-113},
+  {0x1.9ae0000000000p-1, 0x1.c2a205610593fp-3, 0x1.839904bfa522dp-57, -0x1.6fbea4651a97bp-114},
+  {0x1.99a0000000000p-1, 0x1.c8df7cb9a8f77p-3, 0x1.0bd63879b9fb6p-58, -0x1.4a568cd2b20bfp-113},
+  {0x1.9860000000000p-1, 0x1.cf21d5ecbaa65p-3, -0x1.163340c0236e7p-58, 0x1.314b65dc80d97p-112},
+  {0x1.9700000000000p-1, 0x1.d60a17f903515p-3, -0x1.c0df841a71b7ap-57, 0x1.154dd25d1756fp-112},
+  {0x1.95c0000000000p-1, 0x1.dc56cae452f5ap-3, -0x1.0abb63cfd2336p-57, 0x1.87b838f740167p-112},
+  {0x1.9480000000000p-1, 0x1.e2a877a6b2c12p-3, -0x1.fa21e3df99430p-58, -0x1.6fc19ab6f40b9p-112},
+  {0x1.9340000000000p-1, 0x1.e8ff2622babc7p-3, 0x1.3d33981e51981p-60, 0x1.f31d4d23b2431p-114},
+  {0x1.9200000000000p-1, 0x1.ef5ade4dcffe6p-3, -0x1.08ab2ddc708a0p-58, -0x1.a593d824be3f8p-112},
+  {0x1.90e0000000000p-1, 0x1.f518262c38082p-3, 0x1.0b8a15d088ef6p-59, 0x1.75cb319e56f8bp-120},
+  {0x1.8fa0000000000p-1, 0x1.fb7d86eee3b90p-3, -0x1.8736e025ebdaep-59, -0x1.1d1d9ad6ad0fep-114},
+  {0x1.8e60000000000p-1, 0x1.00f40470c7324p-2, 0x1.a5f3a45f05206p-57, 0x1.82d8e44b19c1ep-113},
+  {0x1.8d40000000000p-1, 0x1.03d95a1d67686p-2, -0x1.dfc3727bdcd30p-58, -0x1.0dd09909307d8p-112},
+  {0x1.8c00000000000p-1, 0x1.07138604d5862p-2, 0x1.cdb16ed4e9138p-56, 0x1.f43e8535d8899p-110},
+  {0x1.8ac0000000000p-1, 0x1.0a504e97bb40cp-2, 0x1.29ccd218877e5p-57, -0x1.80ac75cb7c1ecp-113},
+  {0x1.89a0000000000p-1, 0x1.0d3c7586cd5e4p-2, 0x1.642610bcbfdcep-57, 0x1.2c72dec9bfbfcp-112},
+  {0x1.8860000000000p-1, 0x1.107e404ab0f81p-2, 0x1.b79f71540978ap-58, 0x1.cdd6f921abce9p-113},
+  {0x1.8740000000000p-1, 0x1.136ef02e8290cp-2, -0x1.60c396093faf8p-58, -0x1.765fb154520a2p-112},
+  {0x1.8620000000000p-1, 0x1.1661caecb9ba4p-2, -0x1.fff9fc4aba901p-56, 0x1.c50e348f960b9p-111},
+  {0x1.8500000000000p-1, 0x1.1956d3b9bc2fap-2, 0x1.7b9d68d50a15dp-56, -0x1.61d2cfa5038e6p-110},
+  {0x1.83c0000000000p-1, 0x1.1ca28c64bae54p-2, -0x1.3e10bd559adb8p-56, -0x1.573fcd0e87f6ap-110},
+  {0x1.82a0000000000p-1, 0x1.1f9c39f74c557p-2, 0x1.515541d5d6c35p-56, 0x1.fe9b24cd05151p-110},
+  {0x1.8180000000000p-1, 0x1.22981fbef797bp-2, -0x1.0b04ac06cebe0p-59, 0x1.4f437051995c0p-116},
+  {0x1.8060000000000p-1, 0x1.2596410df963ap-2, -0x1.f442de36410f7p-59, -0x1.6bcb94bd25487p-113},
+  {0x1.7f40000000000p-1, 0x1.2896a13e086a4p-2, -0x1.2fd81e96ad9cfp-56, -0x1.69f6048fafc2bp-110},
+  {0x1.7e20000000000p-1, 0x1.2b9943b06bd76p-2, -0x1.4c4833124d84ep-63, -0x1.e63db6c41ded5p-118},
+  {0x1.7d00000000000p-1, 0x1.2e9e2bce12286p-2, 0x1.8251a3b83d97ap-62, -0x1.adc4a5588968fp-117},
+  {0x1.7be0000000000p-1, 0x1.31a55d07a8591p-2, -0x1.5dfb4b1118495p-56, -0x1.2a263ee42000cp-111},
+  {0x1.7ae0000000000p-1, 0x1.34585a594b8adp-2, -0x1.9bf230f410fddp-56, -0x1.31e65ad1e1edfp-110},
+  {0x1.79c0000000000p-1, 0x1.3763e64645463p-2, -0x1.c1adc46953834p-57, -0x1.139379532d8d2p-111},
+  {0x1.78a0000000000p-1, 0x1.3a71c56bb48c6p-2, 0x1.1bed6a2120b29p-57, -0x1.7b377858ea9e6p-111},
+  {0x1.77a0000000000p-1, 0x1.3d2abb3b3b4dfp-2, -0x1.0479718ca1525p-58, 0x1.dfad96fb36188p-112},
+  {0x1.7680000000000p-1, 0x1.403d086cea79cp-2, -0x1.0a8bb78cf7cdap-56, -0x1.6e103b9004f6fp-110},
+  {0x1.7560000000000p-1, 0x1.4351b33743eb9p-2, -0x1.340f4b656e1c0p-56, -0x1.da5f158bdbc64p-111},
+  {0x1.7460000000000p-1, 0x1.4610bc29c5e18p-2, -0x1.64f9886472e95p-57, -0x1.cf89c30da4b04p-111},
+  {0x1.7340000000000p-1, 0x1.4929e8db4e6e4p-2, 0x1.5955b1c3785b0p-58, -0x1.02f2eebc44da9p-112},
+  {0x1.7240000000000p-1, 0x1.4becf95d97913p-2, 0x1.89bffb8b1f5d2p-57, 0x1.e6a1ebc85acdep-112},
+  {0x1.7140000000000p-1, 0x1.4eb1f36b07184p-2, 0x1.1d1b95e5ecebep-60, -0x1.31b2001801c45p-114},
+  {0x1.7020000000000p-1, 0x1.51d1d9310456cp-2, 0x1.f5441b391c5d0p-57, -0x1.ba7975b6f373cp-111},
+  {0x1.6f20000000000p-1, 0x1.549aec5def881p-2, 0x1.7166af2b67691p-56, -0x1.732a55fb936fap-110},
+  {0x1.6e20000000000p-1, 0x1.5765f1749da6bp-2, 0x1.a4d83e4faa5b5p-57, 0x1.6dde0cb3e94c7p-115},
+  {0x1.6d20000000000p-1, 0x1.5a32eb2e4eacbp-2, 0x1.5d5a4b18b2a7fp-56, -0x1.bb44a17ab499bp-110},
+  {0x1.6c20000000000p-1, 0x1.5d01dc49ff2e8p-2, 0x1.5719f4bda516fp-58, -0x1.32d140241ae8bp-112},
+  {0x1.6b20000000000p-1, 0x1.5fd2c78c78828p-2, 0x1.242ad6f292541p-57, 0x1.e9a987fdd201bp-111},
+  {0x1.6a20000000000p-1, 0x1.62a5afc06121fp-2, -0x1.5aea088066ca7p-56, -0x1.4f2340968a69dp-113}
+};
+
+/* (-1)^(n+1)/n as triple-doubles for n <= 11, then doubles */
+static const double logq_coeff_td[11][3] = {
+  {0x1.0000000000000p+0, 0.0, 0.0},
+  {-0x1.0000000000000p-1, 0.0, 0.0},
+  {0x1.5555555555555p-2, 0x1.5555555555555p-56, 0x1.5555555555555p-110},
+  {-0x1.0000000000000p-2, 0.0, 0.0},
+  {0x1.999999999999ap-3, -0x1.999999999999ap-57, 0x1.999999999999ap-111},
+  {-0x1.5555555555555p-3, -0x1.5555555555555p-57, -0x1.5555555555555p-111},
+  {0x1.2492492492492p-3, 0x1.2492492492492p-57, 0x1.2492492492492p-111},
+  {-0x1.0000000000000p-3, 0.0, 0.0},
+  {0x1.c71c71c71c71cp-4, 0x1.c71c71c71c71cp-58, 0x1.c71c71c71c71cp-112},
+  {-0x1.999999999999ap-4, 0x1.999999999999ap-58, -0x1.999999999999ap-112},
+  {0x1.745d1745d1746p-4, -0x1.745d1745d1746p-59, 0x1.745d1745d1746p-114}
+};
+
+#define LOGQ_C12 -0x1.5555555555555p-4
+#define LOGQ_C13 0x1.3b13b13b13b14p-4
+#define LOGQ_C14 -0x1.2492492492492p-4
+#define LOGQ_C15 0x1.1111111111111p-4
+#define LOGQ_C16 -0x1.0000000000000p-4
+#define LOGQ_C17 0x1.e1e1e1e1e1e1ep-5
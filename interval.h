@@ -1,3 +1,6 @@
+#ifndef INTERVAL_H
+#define INTERVAL_H
+
 #include "crlibm.h"
 #include "crlibm_private.h"
 #include "triple-double.h"
@@ -236,3 +239,69 @@ interval j_log();
   return res;                                                               \
 }
 
+
+#define RETURN_ENTIRE_INTERVAL                                              \
+{                                                                           \
+  interval res;                                                             \
+  ASSIGN_LOW(res,-1.0/0.0);                                                 \
+  ASSIGN_UP(res,1.0/0.0);                                                   \
+  return res;                                                               \
+}
+
+
+/* Rounding tests for both bounds at once, without returning.
+   __cond__ gets bit 0 set if __res_rd__ holds the lower bound and bit 1
+   set if __res_ru__ holds the upper bound, so that 3 means both are
+   done and the accurate phase is only needed for the missing bits.  */
+#define TEST_AND_COPY_RDRU(__cond__, __res_rd__, __yh_rd__, __yl_rd__, __res_ru__, __yh_ru__, __yl_ru__, __eps_rd__, __eps_ru__)  \
+{                                                                      \
+  int rd_ok, ru_ok;                                                    \
+  TEST_AND_COPY_RD(rd_ok, __res_rd__, __yh_rd__, __yl_rd__, __eps_rd__); \
+  TEST_AND_COPY_RU(ru_ok, __res_ru__, __yh_ru__, __yl_ru__, __eps_ru__); \
+  __cond__ = rd_ok | (ru_ok << 1);                                     \
+}
+
+
+/* Monotonic segments of the sine-like functions (sin, cos, sinpi, cospi).
+
+   __q__ is the index, modulo 8, of the quarter period containing the
+   lower bound, __d__ the number of quarter-period boundaries crossed
+   up to the upper bound (0 <= __d__ < 8), and __s__ is 0 for a sine
+   and 1 for a cosine.
+
+   Sets __max__ (resp. __min__) if the interval contains a point where
+   the function reaches 1 (resp. -1).  If it contains neither, the
+   function is monotonic on the interval and __inc__ tells whether it
+   is increasing.  */
+#define SINE_EXTREMA(__max__, __min__, __inc__, __q__, __d__, __s__)   \
+{                                                                      \
+  int __j__;                                                           \
+  __max__ = 0;                                                         \
+  __min__ = 0;                                                         \
+  for(__j__ = 1; __j__ <= (__d__); __j__++) {                          \
+    if((((__q__) + (__s__) + __j__) & 3) == 1) __max__ = 1;            \
+    if((((__q__) + (__s__) + __j__) & 3) == 3) __min__ = 1;            \
+  }                                                                    \
+  __inc__ = ((((__q__) + (__s__) + 1) & 2) == 0);                      \
+}
+
+
+/* The interval batches jf_batch(res_inf, res_sup, inf, sup, n) of
+   crlibm.h, as a loop on the scalar interval function: for the
+   functions without vector kernels, or when these are not built (see
+   VECTOR_INTERVAL_BATCH in vector_abi.h). */
+#define INTERVAL_BATCH(__jf__)                                         \
+void __jf__##_batch(double *res_inf, double *res_sup,                  \
+                    const double *inf, const double *sup, int n) {     \
+  interval __x__, __y__;                                               \
+  int __i__;                                                           \
+  for(__i__ = 0; __i__ < n; __i__++) {                                 \
+    ASSIGN_LOW(__x__, inf[__i__]);                                     \
+    ASSIGN_UP(__x__, sup[__i__]);                                      \
+    __y__ = __jf__(__x__);                                             \
+    res_inf[__i__] = LOW(__y__);                                       \
+    res_sup[__i__] = UP(__y__);                                        \
+  }                                                                    \
+}
+
+#endif /* INTERVAL_H */
@@ -0,0 +1,383 @@
+/*
+ * Latency histograms and slow-path capture, in the library configured
+ * with --enable-latency-histograms or --enable-slow-path-capture, see
+ * latency.h
+ *
+ * Latency histograms: each thread counts down the calls it makes to
+ * the functions of LATENCY_FUNCTIONS, and times one call out of
+ * latency_period with TBX_GET_TICK, the others costing a decrement and
+ * a test. A timed call goes into the histogram of its function and of
+ * its exit path: special (an argument is a NaN or an infinity), quick,
+ * or accurate when crlibm_second_step_taken moved during the call
+ * (which, as in the benchmarks, is not counted by all the functions in
+ * all the modes).
+ *
+ * The histograms are in the HDR style: the number of ticks t is
+ * counted exactly below 16, then in 8 buckets per power of two, each
+ * bucket spanning less than 1/8 of its values. They belong to the
+ * thread which fills them, so that nothing is shared on the timed
+ * path: they are allocated at the first timed call of the thread to a
+ * function, and chained for crlibm_latency_dump(), which adds up those
+ * of all the threads, even those which have exited. The counts of a
+ * running thread may be read while it updates them, which only makes
+ * the dump a little out of date.
+ *
+ * The ticks include the reading of the time stamp counter. A timed
+ * call costs two readings of the counter and an increment, spread over
+ * latency_period calls: raise the period if that is still too much.
+ *
+ * Slow-path capture: every call is checked for the slow paths it took,
+ * the accurate phase (crlibm_second_step_taken moved) or those marked
+ * with SLOW_PATH in crlibm_slow_paths, and such a call is written into
+ * the ring buffer of the thread, whose SLOW_PATH_RING last entries are
+ * kept. Only the thread writes its ring, publishing an entry by
+ * incrementing head after it; a reader copies the entries below head,
+ * then discards those the thread may have overwritten in the meantime,
+ * so neither waits for the other.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* This file defines the public names, which the other files rename */
+#undef CRLIBM_LATENCY_RAW_NAMES
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "latency.h"
+#include "scs_lib/tests/tbx_timing.h"
+
+#define LATENCY_DEFAULT_PERIOD 64
+#define LATENCY_SUB_BITS 3                     /* 8 buckets per power of two */
+#define LATENCY_LINEAR (2 << LATENCY_SUB_BITS) /* ticks counted exactly */
+#define LATENCY_BUCKETS (LATENCY_LINEAR + (32 - LATENCY_SUB_BITS - 1)*(1 << LATENCY_SUB_BITS))
+
+#define LATENCY_SPECIAL  0
+#define LATENCY_QUICK    1
+#define LATENCY_ACCURATE 2
+#define LATENCY_PATHS    3
+
+#define SLOW_PATH_RING 1024 /* a power of two */
+
+#define LATENCY_INDEX(f) latency_##f,
+enum { LATENCY_FUNCTIONS(LATENCY_INDEX, LATENCY_INDEX) LATENCY_NB_FUNCTIONS };
+
+#define LATENCY_NAME(f) #f,
+static const char *latency_names[LATENCY_NB_FUNCTIONS] = {
+  LATENCY_FUNCTIONS(LATENCY_NAME, LATENCY_NAME)
+};
+
+#define LATENCY_RAW_1(f) extern double crlibm_raw_##f(double);
+#define LATENCY_RAW_2(f) extern double crlibm_raw_##f(double, double);
+LATENCY_FUNCTIONS(LATENCY_RAW_1, LATENCY_RAW_2)
+
+/* What a thread records: for each function, NULL until its first timed
+   call, then LATENCY_PATHS*LATENCY_BUCKETS counts; its last slow calls */
+typedef struct latency_thread {
+#ifdef BUILD_LATENCY_HISTOGRAMS
+  unsigned int *histograms[LATENCY_NB_FUNCTIONS];
+#endif
+#ifdef BUILD_SLOW_PATH_CAPTURE
+  crlibm_slow_call ring[SLOW_PATH_RING];
+  volatile unsigned long head;
+#endif
+  struct latency_thread *next;
+} latency_thread;
+
+static latency_thread *latency_threads;
+static __thread latency_thread *latency_self;
+
+/* The record of the calling thread, allocated and chained at its first
+   use; NULL if out of memory */
+static latency_thread *latency_thread_self(void) {
+  latency_thread *self = latency_self;
+
+  if(self == NULL) {
+    self = calloc(1, sizeof(latency_thread));
+    if(self == NULL)
+      return NULL;
+    do
+      self->next = latency_threads;
+    while(!__sync_bool_compare_and_swap(&latency_threads, self->next, self));
+    latency_self = self;
+  }
+  return self;
+}
+
+
+#ifdef BUILD_LATENCY_HISTOGRAMS
+
+static const char *latency_path_names[LATENCY_PATHS] = {"special", "quick", "accurate"};
+
+static __thread unsigned int latency_countdown;
+static unsigned int latency_period = LATENCY_DEFAULT_PERIOD;
+
+void crlibm_latency_sampling(unsigned int period) {
+  latency_period = (period > 0) ? period : 1;
+}
+
+static int latency_bucket(unsigned long long t) {
+  int e;
+
+  if(t < LATENCY_LINEAR)
+    return (int) t;
+  if(t >> 32)
+    return LATENCY_BUCKETS - 1;
+  e = 31 - __builtin_clz((unsigned int) t);
+  return LATENCY_LINEAR + ((e - LATENCY_SUB_BITS - 1) << LATENCY_SUB_BITS)
+    + (int) ((t >> (e - LATENCY_SUB_BITS)) & ((1 << LATENCY_SUB_BITS) - 1));
+}
+
+/* The smallest number of ticks of bucket b */
+static unsigned long long latency_bucket_low(int b) {
+  int e;
+
+  if(b < LATENCY_LINEAR)
+    return b;
+  e = (b - LATENCY_LINEAR) >> LATENCY_SUB_BITS;
+  return (unsigned long long) (((1 << LATENCY_SUB_BITS) | ((b - LATENCY_LINEAR) & ((1 << LATENCY_SUB_BITS) - 1))))
+    << (e + 1);
+}
+
+static void latency_record(int f, int path, unsigned long long t) {
+  latency_thread *self = latency_thread_self();
+
+  if(self == NULL)
+    return;
+  if(self->histograms[f] == NULL) {
+    self->histograms[f] = calloc(LATENCY_PATHS*LATENCY_BUCKETS, sizeof(unsigned int));
+    if(self->histograms[f] == NULL)
+      return;
+  }
+  self->histograms[f][path*LATENCY_BUCKETS + latency_bucket(t)]++;
+}
+
+static int latency_special(double x) {
+  db_number xdb;
+
+  xdb.d = x;
+  return (xdb.i[HI] & 0x7ff00000) == 0x7ff00000;
+}
+
+static __attribute__ ((noinline)) double latency_time_1(double (*f)(double), int i, double x) {
+  tbx_tick_t t1, t2;
+  int second_steps;
+  double r;
+
+  second_steps = crlibm_second_step_taken;
+  TBX_GET_TICK(t1);
+  r = f(x);
+  TBX_GET_TICK(t2);
+  latency_record(i, latency_special(x) ? LATENCY_SPECIAL
+                 : (crlibm_second_step_taken != second_steps) ? LATENCY_ACCURATE : LATENCY_QUICK,
+                 TBX_TICK_RAW_DIFF(t1, t2));
+  latency_countdown = latency_period - 1;
+  return r;
+}
+
+static __attribute__ ((noinline)) double latency_time_2(double (*f)(double, double), int i,
+                                                        double x, double y) {
+  tbx_tick_t t1, t2;
+  int second_steps;
+  double r;
+
+  second_steps = crlibm_second_step_taken;
+  TBX_GET_TICK(t1);
+  r = f(x, y);
+  TBX_GET_TICK(t2);
+  latency_record(i, (latency_special(x) || latency_special(y)) ? LATENCY_SPECIAL
+                 : (crlibm_second_step_taken != second_steps) ? LATENCY_ACCURATE : LATENCY_QUICK,
+                 TBX_TICK_RAW_DIFF(t1, t2));
+  latency_countdown = latency_period - 1;
+  return r;
+}
+
+#define LATENCY_TIMED (__builtin_expect(latency_countdown-- == 0, 0))
+
+/* Writes the histograms of all the threads added up, as CSV: one line
+   per function, exit path and non-empty bucket, with the bounds of the
+   bucket in ticks. Returns 0, or -1 if the file cannot be written. */
+int crlibm_latency_dump(const char *filename) {
+  unsigned long long counts[LATENCY_PATHS*LATENCY_BUCKETS];
+  latency_thread *t;
+  FILE *f;
+  int i, p, b, ok;
+
+  f = (filename != NULL) ? fopen(filename, "w") : stdout;
+  if(f == NULL)
+    return -1;
+  fprintf(f, "# one call out of %u timed, in ticks\n", latency_period);
+  fprintf(f, "function,path,from,to,count\n");
+  for(i = 0; i < LATENCY_NB_FUNCTIONS; i++) {
+    for(b = 0; b < LATENCY_PATHS*LATENCY_BUCKETS; b++)
+      counts[b] = 0;
+    for(t = latency_threads; t != NULL; t = t->next)
+      if(t->histograms[i] != NULL)
+        for(b = 0; b < LATENCY_PATHS*LATENCY_BUCKETS; b++)
+          counts[b] += t->histograms[i][b];
+    for(p = 0; p < LATENCY_PATHS; p++)
+      for(b = 0; b < LATENCY_BUCKETS; b++)
+        if(counts[p*LATENCY_BUCKETS + b] != 0)
+          fprintf(f, "%s,%s,%llu,%llu,%llu\n", latency_names[i], latency_path_names[p],
+                  latency_bucket_low(b),
+                  (b == LATENCY_BUCKETS - 1) ? ~0ULL : latency_bucket_low(b + 1) - 1,
+                  counts[p*LATENCY_BUCKETS + b]);
+  }
+  ok = !ferror(f);
+  if(filename != NULL)
+    ok = (fclose(f) == 0) && ok;
+  else
+    fflush(f);
+  return ok ? 0 : -1;
+}
+
+#else
+#define LATENCY_TIMED 0
+#define latency_time_1(f, i, x) 0
+#define latency_time_2(f, i, x, y) 0
+#endif /* BUILD_LATENCY_HISTOGRAMS */
+
+
+#ifdef BUILD_SLOW_PATH_CAPTURE
+
+static const char *slow_path_names[] = {"accurate", "scs_rr", "scs_atan", "pow_exact"};
+
+static __attribute__ ((noinline)) void slow_path_record(int f, double x, double y, int paths) {
+  latency_thread *self = latency_thread_self();
+  crlibm_slow_call *c;
+
+  if(self == NULL)
+    return;
+  c = &self->ring[self->head & (SLOW_PATH_RING - 1)];
+  c->function = latency_names[f];
+  c->x = x;
+  c->y = y;
+  c->paths = paths;
+  __sync_synchronize();
+  self->head++;
+}
+
+/* The slow paths taken by the call, which started with second_steps */
+#define SLOW_PATH_BEGIN                                                 \
+  int second_steps = crlibm_second_step_taken;                          \
+  crlibm_slow_paths = 0;
+
+#define SLOW_PATH_END(f, x, y)                                          \
+  if(__builtin_expect(crlibm_slow_paths != 0                            \
+                      || crlibm_second_step_taken != second_steps, 0))  \
+    slow_path_record(latency_##f, x, y, crlibm_slow_paths               \
+                     | ((crlibm_second_step_taken != second_steps) ? CRLIBM_SLOW_ACCURATE : 0));
+
+int crlibm_slow_path_read(crlibm_slow_call *calls, int n) {
+  latency_thread *t;
+  unsigned long head, from, valid, j;
+  int k = 0, k0;
+
+  for(t = latency_threads; t != NULL && k < n; t = t->next) {
+    head = t->head;
+    __sync_synchronize();
+    from = (head > SLOW_PATH_RING) ? head - SLOW_PATH_RING : 0;
+    k0 = k;
+    for(j = from; j < head && k < n; j++)
+      calls[k++] = t->ring[j & (SLOW_PATH_RING - 1)];
+    __sync_synchronize();
+    /* The thread may have overwritten the entries below head + 1 - SLOW_PATH_RING */
+    valid = t->head + 1;
+    valid = (valid > SLOW_PATH_RING) ? valid - SLOW_PATH_RING : 0;
+    if(valid > from) {
+      j = (valid - from < (unsigned long) (k - k0)) ? valid - from : (unsigned long) (k - k0);
+      memmove(calls + k0, calls + k0 + j, (k - k0 - j)*sizeof(crlibm_slow_call));
+      k -= j;
+    }
+  }
+  return k;
+}
+
+/* One line per call, as the traces of tests/mix_bench.c, followed by
+   the slow paths as a comment */
+int crlibm_slow_path_dump(const char *filename) {
+  crlibm_slow_call *calls;
+  latency_thread *t;
+  FILE *f;
+  int i, n, p, ok;
+
+  n = 0;
+  for(t = latency_threads; t != NULL; t = t->next)
+    n += SLOW_PATH_RING;
+  calls = malloc((n > 0 ? n : 1)*sizeof(crlibm_slow_call));
+  if(calls == NULL)
+    return -1;
+  n = crlibm_slow_path_read(calls, n);
+  f = (filename != NULL) ? fopen(filename, "w") : stdout;
+  if(f == NULL) {
+    free(calls);
+    return -1;
+  }
+  fprintf(f, "# crlibm slow-path calls: entry point, arguments, # slow paths\n");
+  for(i = 0; i < n; i++) {
+    if(strcmp(calls[i].function, "pow_rn") == 0)
+      fprintf(f, "%s %a %a #", calls[i].function, calls[i].x, calls[i].y);
+    else
+      fprintf(f, "%s %a #", calls[i].function, calls[i].x);
+    for(p = 0; p < 4; p++)
+      if(calls[i].paths & (1 << p))
+        fprintf(f, " %s", slow_path_names[p]);
+    fprintf(f, "\n");
+  }
+  free(calls);
+  ok = !ferror(f);
+  if(filename != NULL)
+    ok = (fclose(f) == 0) && ok;
+  else
+    fflush(f);
+  return ok ? 0 : -1;
+}
+
+#else
+#define SLOW_PATH_BEGIN
+#define SLOW_PATH_END(f, x, y)
+#endif /* BUILD_SLOW_PATH_CAPTURE */
+
+
+#define LATENCY_WRAPPER_1(f)                                            \
+double f(double x) {                                                    \
+  double r;                                                             \
+  SLOW_PATH_BEGIN                                                       \
+  if(LATENCY_TIMED)                                                     \
+    r = latency_time_1(crlibm_raw_##f, latency_##f, x);                 \
+  else                                                                  \
+    r = crlibm_raw_##f(x);                                              \
+  SLOW_PATH_END(f, x, 0)                                                \
+  return r;                                                             \
+}
+
+#define LATENCY_WRAPPER_2(f)                                            \
+double f(double x, double y) {                                          \
+  double r;                                                             \
+  SLOW_PATH_BEGIN                                                       \
+  if(LATENCY_TIMED)                                                     \
+    r = latency_time_2(crlibm_raw_##f, latency_##f, x, y);              \
+  else                                                                  \
+    r = crlibm_raw_##f(x, y);                                           \
+  SLOW_PATH_END(f, x, y)                                                \
+  return r;                                                             \
+}
+
+LATENCY_FUNCTIONS(LATENCY_WRAPPER_1, LATENCY_WRAPPER_2)
@@ -0,0 +1,142 @@
+/*
+ * Latency histograms and slow-path capture of the library configured
+ * with --enable-latency-histograms or --enable-slow-path-capture
+ *
+ * In these builds, the scalar functions of crlibm.h listed below are
+ * compiled under the names crlibm_raw_exp_rn etc: crlibm.h includes
+ * this file first when the library is compiled (CRLIBM_LATENCY_RAW_NAMES,
+ * set in Makefile.am), and the defines rename both the prototypes and
+ * the definitions. latency.c then defines exp_rn etc, which call them,
+ * time one call out of crlibm_latency_sampling() ones with TBX_GET_TICK
+ * and record those which took a slow path. The calls of the library to
+ * its own functions (batch, vector and interval versions...) use the
+ * raw ones and are not observed.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or 
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  
+ */
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+/* The timed functions: F1 for one argument, F2 for two. The aliases
+   exp_rz, acos_rz and acospi_rz of crlibm.h are timed as exp_rd etc */
+#define LATENCY_FUNCTIONS(F1, F2) \
+  F1(exp_rn) F1(exp_rd) F1(exp_ru) \
+  F1(log_rn) F1(log_rd) F1(log_ru) F1(log_rz) \
+  F1(cos_rn) F1(cos_rd) F1(cos_ru) F1(cos_rz) \
+  F1(sin_rn) F1(sin_rd) F1(sin_ru) F1(sin_rz) \
+  F1(tan_rn) F1(tan_rd) F1(tan_ru) F1(tan_rz) \
+  F1(cospi_rn) F1(cospi_rd) F1(cospi_ru) F1(cospi_rz) \
+  F1(sinpi_rn) F1(sinpi_rd) F1(sinpi_ru) F1(sinpi_rz) \
+  F1(tanpi_rn) F1(tanpi_rd) F1(tanpi_ru) F1(tanpi_rz) \
+  F1(atan_rn) F1(atan_rd) F1(atan_ru) F1(atan_rz) \
+  F1(atanpi_rn) F1(atanpi_rd) F1(atanpi_ru) F1(atanpi_rz) \
+  F1(cosh_rn) F1(cosh_rd) F1(cosh_ru) F1(cosh_rz) \
+  F1(sinh_rn) F1(sinh_rd) F1(sinh_ru) F1(sinh_rz) \
+  F1(log2_rn) F1(log2_rd) F1(log2_ru) F1(log2_rz) \
+  F1(log10_rn) F1(log10_rd) F1(log10_ru) F1(log10_rz) \
+  F1(asin_rn) F1(asin_rd) F1(asin_ru) F1(asin_rz) \
+  F1(acos_rn) F1(acos_rd) F1(acos_ru) \
+  F1(asinpi_rn) F1(asinpi_rd) F1(asinpi_ru) F1(asinpi_rz) \
+  F1(acospi_rn) F1(acospi_rd) F1(acospi_ru) \
+  F1(expm1_rn) F1(expm1_rd) F1(expm1_ru) F1(expm1_rz) \
+  F1(log1p_rn) F1(log1p_rd) F1(log1p_ru) F1(log1p_rz) \
+  F2(pow_rn)
+
+#ifdef CRLIBM_LATENCY_RAW_NAMES
+#define exp_rn     crlibm_raw_exp_rn
+#define exp_rd     crlibm_raw_exp_rd
+#define exp_ru     crlibm_raw_exp_ru
+#define log_rn     crlibm_raw_log_rn
+#define log_rd     crlibm_raw_log_rd
+#define log_ru     crlibm_raw_log_ru
+#define log_rz     crlibm_raw_log_rz
+#define cos_rn     crlibm_raw_cos_rn
+#define cos_rd     crlibm_raw_cos_rd
+#define cos_ru     crlibm_raw_cos_ru
+#define cos_rz     crlibm_raw_cos_rz
+#define sin_rn     crlibm_raw_sin_rn
+#define sin_rd     crlibm_raw_sin_rd
+#define sin_ru     crlibm_raw_sin_ru
+#define sin_rz     crlibm_raw_sin_rz
+#define tan_rn     crlibm_raw_tan_rn
+#define tan_rd     crlibm_raw_tan_rd
+#define tan_ru     crlibm_raw_tan_ru
+#define tan_rz     crlibm_raw_tan_rz
+#define cospi_rn   crlibm_raw_cospi_rn
+#define cospi_rd   crlibm_raw_cospi_rd
+#define cospi_ru   crlibm_raw_cospi_ru
+#define cospi_rz   crlibm_raw_cospi_rz
+#define sinpi_rn   crlibm_raw_sinpi_rn
+#define sinpi_rd   crlibm_raw_sinpi_rd
+#define sinpi_ru   crlibm_raw_sinpi_ru
+#define sinpi_rz   crlibm_raw_sinpi_rz
+#define tanpi_rn   crlibm_raw_tanpi_rn
+#define tanpi_rd   crlibm_raw_tanpi_rd
+#define tanpi_ru   crlibm_raw_tanpi_ru
+#define tanpi_rz   crlibm_raw_tanpi_rz
+#define atan_rn    crlibm_raw_atan_rn
+#define atan_rd    crlibm_raw_atan_rd
+#define atan_ru    crlibm_raw_atan_ru
+#define atan_rz    crlibm_raw_atan_rz
+#define atanpi_rn  crlibm_raw_atanpi_rn
+#define atanpi_rd  crlibm_raw_atanpi_rd
+#define atanpi_ru  crlibm_raw_atanpi_ru
+#define atanpi_rz  crlibm_raw_atanpi_rz
+#define cosh_rn    crlibm_raw_cosh_rn
+#define cosh_rd    crlibm_raw_cosh_rd
+#define cosh_ru    crlibm_raw_cosh_ru
+#define cosh_rz    crlibm_raw_cosh_rz
+#define sinh_rn    crlibm_raw_sinh_rn
+#define sinh_rd    crlibm_raw_sinh_rd
+#define sinh_ru    crlibm_raw_sinh_ru
+#define sinh_rz    crlibm_raw_sinh_rz
+#define log2_rn    crlibm_raw_log2_rn
+#define log2_rd    crlibm_raw_log2_rd
+#define log2_ru    crlibm_raw_log2_ru
+#define log2_rz    crlibm_raw_log2_rz
+#define log10_rn   crlibm_raw_log10_rn
+#define log10_rd   crlibm_raw_log10_rd
+#define log10_ru   crlibm_raw_log10_ru
+#define log10_rz   crlibm_raw_log10_rz
+#define asin_rn    crlibm_raw_asin_rn
+#define asin_rd    crlibm_raw_asin_rd
+#define asin_ru    crlibm_raw_asin_ru
+#define asin_rz    crlibm_raw_asin_rz
+#define acos_rn    crlibm_raw_acos_rn
+#define acos_rd    crlibm_raw_acos_rd
+#define acos_ru    crlibm_raw_acos_ru
+#define asinpi_rn  crlibm_raw_asinpi_rn
+#define asinpi_rd  crlibm_raw_asinpi_rd
+#define asinpi_ru  crlibm_raw_asinpi_ru
+#define asinpi_rz  crlibm_raw_asinpi_rz
+#define acospi_rn  crlibm_raw_acospi_rn
+#define acospi_rd  crlibm_raw_acospi_rd
+#define acospi_ru  crlibm_raw_acospi_ru
+#define expm1_rn   crlibm_raw_expm1_rn
+#define expm1_rd   crlibm_raw_expm1_rd
+#define expm1_ru   crlibm_raw_expm1_ru
+#define expm1_rz   crlibm_raw_expm1_rz
+#define log1p_rn   crlibm_raw_log1p_rn
+#define log1p_rd   crlibm_raw_log1p_rd
+#define log1p_ru   crlibm_raw_log1p_ru
+#define log1p_rz   crlibm_raw_log1p_rz
+#define pow_rn     crlibm_raw_pow_rn
+#endif
+
+#endif /* LATENCY_H */
@@ -0,0 +1,478 @@
+/* 
+ * Batch and vector versions of the correctly rounded logarithm
+ *
+ * The quick phase is the one of log-td.c, with its tables and
+ * rounding constants. The lanes which fail the rounding test, as well
+ * as the special ones, are handed to the scalar log_rn etc, whichever
+ * implementation of the logarithm was selected by configure
+ * (log-de.c, log.c or log-td.c).
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or 
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "log-td.h"
+#include "vector_abi.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
+
+
+/* The inputs are processed by blocks of LOG_BATCH_BLOCK lanes. A first
+   pass partitions the lanes of a block without any data-dependent
+   branch: zeroes, negative, subnormal and infinite arguments and
+   NaNs are appended to a list of special lanes, all the others to a
+   compacted list of regular lanes. The quick phase then runs on the
+   regular lanes by a homogeneous loop, the rounding test is performed
+   lane-wise, and only the lanes which fail it go through the scalar
+   function, which will launch the accurate phase.
+*/
+
+#define LOG_BATCH_BLOCK 256
+
+static void log_batch(double *res, const double *x, int n, int mode) {
+  int regular[LOG_BATCH_BLOCK], special[LOG_BATCH_BLOCK], failed[LOG_BATCH_BLOCK];
+  double loghb[LOG_BATCH_BLOCK], logmb[LOG_BATCH_BLOCK], roundcstb[LOG_BATCH_BLOCK];
+  db_number xdb;
+  double y, ed, ri, logih, logim, yrih, yril, th, zh, zl;
+  double polyHorner, zhSquareh, zhSquarel, polyUpper, zhSquareHalfh, zhSquareHalfl;
+  double t1h, t1l, t2h, t2l, ph, pl, log2edh, log2edl, logTabPolyh, logTabPolyl;
+  double (*scalar)(double);
+  const double *xb;
+  double *resb;
+  int E, index, above, xIntHi, isregular, roundable;
+  int nb, nregular, nspecial, nfailed, i, j, base;
+
+  if(mode==CRLIBM_RN)      scalar = log_rn;
+  else if(mode==CRLIBM_RU) scalar = log_ru;
+  else if(mode==CRLIBM_RD) scalar = log_rd;
+  else                     scalar = log_rz;
+
+  for(base=0; base<n; base+=LOG_BATCH_BLOCK) {
+    nb = (n-base < LOG_BATCH_BLOCK) ? n-base : LOG_BATCH_BLOCK;
+    xb = x + base;
+    resb = res + base;
+
+    /* Partition of the lanes: x < 2^(-1022) (including the negative
+       numbers) or x is Inf or NaN is special */
+    nregular = 0;
+    nspecial = 0;
+    for(i=0; i<nb; i++) {
+      xdb.d = xb[i];
+      xIntHi = xdb.i[HI];
+      isregular = (xIntHi >= 0x00100000) & (xIntHi < 0x7ff00000);
+      regular[nregular] = i;
+      special[nspecial] = i;
+      nregular += isregular;
+      nspecial += !isregular;
+    }
+
+    for(j=0; j<nspecial; j++) {
+      i = special[j];
+      resb[i] = scalar(xb[i]);
+    }
+
+    /* Quick phase on the regular lanes, see log_rn in log-td.c */
+    for(j=0; j<nregular; j++) {
+      xdb.d = xb[regular[j]];
+      E = (xdb.i[HI]>>20)-1023;
+      index = (xdb.i[HI] & 0x000fffff);
+      xdb.i[HI] =  index | 0x3ff00000;
+      index = (index + (1<<(20-L-1))) >> (20-L);
+      /* reduce  such that sqrt(2)/2 < xdb.d < sqrt(2), without a branch */
+      above = (index >= MAXINDEX);
+      xdb.i[HI] -= above << 20; 
+      E += above;
+      y = xdb.d;
+      index = index & INDEXMASK;
+      ed = (double) E;
+
+      ri = argredtable[index].ri;
+      logih = argredtable[index].logih;
+      logim = argredtable[index].logim;
+
+      Mul12(&yrih, &yril, y, ri);
+      th = yrih - 1.0; 
+      Add12Cond(zh, zl, th, yril); 
+
+      polyHorner = c3 + zh * (c4 + zh * (c5 + zh * (c6 + zh * c7)));
+
+      Mul12(&zhSquareh, &zhSquarel, zh, zh);
+      polyUpper = polyHorner * (zh * zhSquareh);
+      zhSquareHalfh = zhSquareh * -0.5;
+      zhSquareHalfl = zhSquarel * -0.5;
+      Add12(t1h, t1l, polyUpper, -1 * (zh * zl));
+      Add22(&t2h, &t2l, zh, zl, zhSquareHalfh, zhSquareHalfl);
+      Add22(&ph, &pl, t2h, t2l, t1h, t1l);
+
+      Add12(log2edh, log2edl, log2h * ed, log2m * ed);
+      Add22Cond(&logTabPolyh, &logTabPolyl, logih, logim, ph, pl);
+      Add22Cond(&loghb[j], &logmb[j], log2edh, log2edl, logTabPolyh, logTabPolyl);
+
+      if(mode==CRLIBM_RN)
+	roundcstb[j] = (E==0) ? ROUNDCST1 : ROUNDCST2;
+      else 
+	roundcstb[j] = (E==0) ? RDROUNDCST1 : RDROUNDCST2;
+    }
+
+    /* Lane-wise rounding test */
+    nfailed = 0;
+    for(j=0; j<nregular; j++) {
+      if(mode==CRLIBM_RN) {
+	resb[regular[j]] = loghb[j];
+	roundable = (loghb[j] == (loghb[j] + (logmb[j] * roundcstb[j])));
+      }
+      else if(mode==CRLIBM_RU) {
+	TEST_AND_COPY_RU(roundable, resb[regular[j]], loghb[j], logmb[j], roundcstb[j]);
+      }
+      else if(mode==CRLIBM_RD) {
+	TEST_AND_COPY_RD(roundable, resb[regular[j]], loghb[j], logmb[j], roundcstb[j]);
+      }
+      else {
+	TEST_AND_COPY_RZ(roundable, resb[regular[j]], loghb[j], logmb[j], roundcstb[j]);
+      }
+      failed[nfailed] = regular[j];
+      nfailed += !roundable;
+    }
+
+    /* Accurate phase for the lanes which failed the rounding test
+       (this includes x=1, where the result is an exact zero) */
+    for(j=0; j<nfailed; j++) {
+      i = failed[j];
+      resb[i] = scalar(xb[i]);
+    }
+  }
+}
+
+
+void log_rn_batch(double *res, const double *x, int n){ log_batch(res, x, n, CRLIBM_RN); }
+void log_ru_batch(double *res, const double *x, int n){ log_batch(res, x, n, CRLIBM_RU); }
+void log_rd_batch(double *res, const double *x, int n){ log_batch(res, x, n, CRLIBM_RD); }
+void log_rz_batch(double *res, const double *x, int n){ log_batch(res, x, n, CRLIBM_RZ); }
+
+
+
+/* Round to odd, see RETURN_RO_FROM_RZ in crlibm_private.h: the
+   logarithm is exact only for x=1, and for the special arguments
+   which return an infinity or a NaN */
+double log_ro(double x){
+  if (x == 1.0)
+    return 0.0;
+  RETURN_RO_FROM_RZ(log_rz(x));
+}
+
+
+#ifdef BUILD_VECTOR_ABI
+
+/* The lane kernels of the vector variants, see vector_abi.h: the same
+   quick phase on the whole vector, where the exponent and the table
+   index are extracted by integer operations on the bits of x. */
+
+#define LOG_LANES(name, vd, vl, n)                                      \
+VECTOR_KERNEL void name(double *res, const double *x, int mode) {       \
+  vd xv, y, ed, ri, logih, logim, yrih, yril, th, zh, zl;               \
+  vd polyHorner, zhSquareh, zhSquarel, polyUpper, zhSquareHalfh, zhSquareHalfl; \
+  vd t1h, t1l, t2h, t2l, ph, pl, log2edh, log2edl, logTabPolyh, logTabPolyl; \
+  vd logh, logm, roundcst;                                              \
+  vl xb, E, index, above, regular, roundable, fail;                     \
+  int l;                                                                \
+                                                                        \
+  memcpy(&xv, x, sizeof(xv));                                           \
+  xb = (vl) xv;                                                         \
+  /* x < 2^(-1022) (including the negative numbers) or x is Inf or NaN  \
+     is special */                                                      \
+  regular = (xb >= (long long int) ULL(0010000000000000))               \
+          & (xb < (long long int) ULL(7ff0000000000000));               \
+                                                                        \
+  E = ((xb >> 52) & 0x7ff) - 1023;                                      \
+  index = (xb >> 32) & 0x000fffff;                                      \
+  xb = (xb & ULL(000fffffffffffff)) | ULL(3ff0000000000000);            \
+  index = (index + (1<<(20-L-1))) >> (20-L);                            \
+  /* reduce  such that sqrt(2)/2 < y < sqrt(2) */                       \
+  above = (index >= MAXINDEX);                                          \
+  xb -= above & ULL(0010000000000000);                                  \
+  E -= above;                                                           \
+  y = (vd) xb;                                                          \
+  index = index & INDEXMASK;                                            \
+  ed = VToDouble(vd, E);                                                \
+                                                                        \
+  VECTOR_UNROLL                                                         \
+  for(l=0; l<n; l++) {                                                  \
+    ri[l] = argredtable[index[l]].ri;                                   \
+    logih[l] = argredtable[index[l]].logih;                             \
+    logim[l] = argredtable[index[l]].logim;                             \
+  }                                                                     \
+                                                                        \
+  VMul12(yrih, yril, y, ri);                                            \
+  th = yrih - 1.0;                                                      \
+  VAdd12Cond(zh, zl, th, yril);                                         \
+                                                                        \
+  polyHorner = c3 + zh * (c4 + zh * (c5 + zh * (c6 + zh * c7)));        \
+                                                                        \
+  VMul12(zhSquareh, zhSquarel, zh, zh);                                 \
+  polyUpper = polyHorner * (zh * zhSquareh);                            \
+  zhSquareHalfh = zhSquareh * -0.5;                                     \
+  zhSquareHalfl = zhSquarel * -0.5;                                     \
+  VAdd12(t1h, t1l, polyUpper, -1 * (zh * zl));                          \
+  VAdd22(t2h, t2l, zh, zl, zhSquareHalfh, zhSquareHalfl);               \
+  VAdd22(ph, pl, t2h, t2l, t1h, t1l);                                   \
+                                                                        \
+  VAdd12(log2edh, log2edl, log2h * ed, log2m * ed);                     \
+  VAdd22Cond(logTabPolyh, logTabPolyl, logih, logim, ph, pl);           \
+  VAdd22Cond(logh, logm, log2edh, log2edl, logTabPolyh, logTabPolyl);   \
+                                                                        \
+  if(mode==CRLIBM_RN)                                                   \
+    roundcst = VSelect(E==0, VSplat(vd, ROUNDCST1), VSplat(vd, ROUNDCST2)); \
+  else                                                                  \
+    roundcst = VSelect(E==0, VSplat(vd, RDROUNDCST1), VSplat(vd, RDROUNDCST2)); \
+  VTestAndCopy(roundable, logh, logm, roundcst, mode, vd, vl);          \
+  memcpy(res, &logh, sizeof(logh));                                     \
+  if(mode==VECTOR_THIN) {                                               \
+    logh = VNextUp(logh, vl);                                           \
+    memcpy(res+n, &logh, sizeof(logh));                                 \
+  }                                                                     \
+                                                                        \
+  /* The accurate phase for the lanes which failed the rounding test    \
+     (this includes x=1 in the directed modes), and the special lanes */ \
+  fail = ~roundable | ~regular;                                         \
+  for(l=0; l<n; l++) {                                                  \
+    if(fail[l]) {                                                       \
+      if(mode==CRLIBM_RN)      res[l] = log_rn(x[l]);                   \
+      else if(mode==CRLIBM_RU                                           \
+              || (mode==VECTOR_RDRU && (l&1))) res[l] = log_ru(x[l]);   \
+      else if(mode==CRLIBM_RD || mode==VECTOR_RDRU                      \
+              || mode==VECTOR_THIN) res[l] = log_rd(x[l]);              \
+      else                     res[l] = log_rz(x[l]);                   \
+      if(mode==VECTOR_THIN)    res[n+l] = log_ru(x[l]);                 \
+    }                                                                   \
+  }                                                                     \
+}
+
+VECTOR_LANE_KERNELS(LOG_LANES, log_lanes)
+
+VECTOR_ABI_VARIANTS(log_rn, log_lanes, CRLIBM_RN)
+VECTOR_ABI_VARIANTS(log_ru, log_lanes, CRLIBM_RU)
+VECTOR_ABI_VARIANTS(log_rd, log_lanes, CRLIBM_RD)
+VECTOR_ABI_VARIANTS(log_rz, log_lanes, CRLIBM_RZ)
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Both bounds in the two lanes of one SSE2 register, see j_exp. The
+   intervals which are empty or meet the negative numbers are filtered
+   first, as in the scalar version. */
+interval j_log(interval x)
+{
+  interval res;
+  db_number xdb_sup;
+  v2df v, r;
+
+  xdb_sup.d = UP(x);
+  if (__builtin_expect(!(LOW(x) <= UP(x)) || (xdb_sup.i[HI] < 0), FALSE))
+    RETURN_EMPTY_INTERVAL;
+  if (__builtin_expect((LOW(x) < 0.0) && (UP(x) > 0.0), FALSE)) {
+    ASSIGN_LOW(res,-1.0/0.0);
+    ASSIGN_UP(res,log_ru(UP(x)));
+    return res;
+  }
+  v = VPair(LOW(x), UP(x));
+  log_lanes_2((double *) &r, (const double *) &v, VECTOR_RDRU);
+  ASSIGN_LOW(res,r[0]);
+  ASSIGN_UP(res,r[1]);
+  return res;
+}
+
+/* The intervals which are empty or not inside ]0, +inf] go to j_log */
+#define J_LOG_SPECIAL(inf, sup) (!((inf) <= (sup)) | ((inf) < 0.0) | ((sup) <= 0.0))
+
+VECTOR_INTERVAL_BATCH(j_log, log_lanes, J_LOG_SPECIAL)
+#endif /* BUILD_INTERVAL_FUNCTIONS */
+
+#endif /* BUILD_VECTOR_ABI */
+
+#if defined(BUILD_INTERVAL_FUNCTIONS) && !defined(BUILD_VECTOR_ABI)
+INTERVAL_BATCH(j_log)
+#endif
+
+
+
+/*************************************************************
+ *************************************************************
+ *               BINARY32 VERSIONS                           *
+ *************************************************************
+ *************************************************************/
+
+/* logf and log1pf, for a float x, in one step: the argument reduction
+   above, and the polynomial of the quick phase evaluated in double
+   precision, where y is never built: with t = 2^-E ri, the product
+   of two floats x t is exact, and z = y ri - 1 = x t - 1 is exact for
+   logf. For log1pf, 1+x = 2^E y is reduced the same way, and z = x t
+   + (t - 1) where t - 1 is exact as long as E < 30: z has one
+   rounding error, and it is exact for tiny x, where E=0 and ri=1. The
+   result has a relative error below 2^-49 (see TEST_AND_COPY_FLOAT).
+
+   The kernels return 0 for the arguments they do not handle (zeroes,
+   negative numbers, x <= -1 for log1pf, Inf and NaN), as well as for
+   x=1 (resp. x=0), so that the rounding test fails and the double
+   function is called. */
+
+static inline double logf_reconstruct(double ed, double logih, double logim, double z) {
+  double z2, p;
+  /* the upper part of the polynomial is split to shorten the
+     dependency chain */
+  z2 = z * z;
+  p = z + z2 * (-0.5 + z * ((c3 + z * c4) + z2 * ((c5 + z * c6) + z2 * c7)));
+  return (ed * log2h + logih) + ((ed * log2m + logim) + p);
+}
+
+static inline double logf_quick(double x, int onePlus) {
+  db_number xdb, twoMEdb;
+  double ri, t, z;
+  int E, index, above;
+
+  if(onePlus) {
+    if(!((x > -1.0) && (x < 0x1p128)))
+      return 0.0;
+    xdb.d = 1.0 + x;
+  }
+  else {
+    if(!((x > 0.0) && (x < 0x1p128)))
+      return 0.0;
+    xdb.d = x;
+  }
+
+  E = (xdb.i[HI]>>20)-1023;
+  index = (xdb.i[HI] & 0x000fffff);
+  index = (index + (1<<(20-L-1))) >> (20-L);
+  above = (index >= MAXINDEX);
+  E += above;
+  index = index & INDEXMASK;
+  ri = argredtable[index].ri;
+  twoMEdb.l = ((long long int) (1023 - E)) << 52;
+  t = ri * twoMEdb.d;
+
+  if(onePlus)
+    z = x * t + (t - 1.0);
+  else
+    z = x * t - 1.0;
+
+  return logf_reconstruct((double) E, argredtable[index].logih, argredtable[index].logim, z);
+}
+
+
+#ifdef BUILD_VECTOR_ABI
+/* The same on four lanes, for the batch versions */
+VECTOR_KERNEL void logf_lanes(v4df *res, const v4df *xp, int onePlus) {
+  v4df x, u, ed, ri, logih, logim, t, z, z2, p, r;
+  v4di xb, E, index, above, regular;
+  int l;
+
+  x = *xp;
+
+  if(onePlus) {
+    regular = (x > -1.0) & (x < 0x1p128);
+    u = 1.0 + x;
+  }
+  else {
+    u = x;
+    regular = (x > 0.0) & (x < 0x1p128);
+  }
+
+  xb = (v4di) u;
+  E = ((xb >> 52) & 0x7ff) - 1023;
+  index = (xb >> 32) & 0x000fffff;
+  index = (index + (1<<(20-L-1))) >> (20-L);
+  above = (index >= MAXINDEX);
+  E -= above;
+  index = index & INDEXMASK;
+  ed = VToDouble(v4df, E);
+
+  VECTOR_UNROLL
+  for(l=0; l<4; l++) {
+    ri[l] = argredtable[index[l]].ri;
+    logih[l] = argredtable[index[l]].logih;
+    logim[l] = argredtable[index[l]].logim;
+  }
+
+  t = ri * (v4df) ((1023 - E) << 52);
+  if(onePlus)
+    z = x * t + (t - 1.0);
+  else
+    z = x * t - 1.0;
+
+  z2 = z * z;
+  p = z + z2 * (-0.5 + z * ((c3 + z * c4) + z2 * ((c5 + z * c6) + z2 * c7)));
+  r = (ed * log2h + logih) + ((ed * log2m + logim) + p);
+  *res = VSelect(regular, r, VSplat(v4df, 0.0));
+}
+
+VECTOR_KERNEL void logf_lanes_4(v4df *res, const v4df *x)   { logf_lanes(res, x, 0); }
+VECTOR_KERNEL void log1pf_lanes_4(v4df *res, const v4df *x) { logf_lanes(res, x, 1); }
+#endif /* BUILD_VECTOR_ABI */
+
+
+static inline float logf_round(float x, int mode) {
+  float res;
+  int roundable;
+
+  TEST_AND_COPY_FLOAT(roundable, res, logf_quick(x, 0), mode);
+  if(roundable)
+    return res;
+  return float_from_ro(log_ro(x), mode);
+}
+
+static inline float log1pf_round(float x, int mode) {
+  float res;
+  int roundable;
+
+  TEST_AND_COPY_FLOAT(roundable, res, logf_quick(x, 1), mode);
+  if(roundable)
+    return res;
+  return float_from_ro(log1p_ro(x), mode);
+}
+
+float logf_rn(float x){ return logf_round(x, CRLIBM_RN); }
+float logf_rd(float x){ return logf_round(x, CRLIBM_RD); }
+float logf_ru(float x){ return logf_round(x, CRLIBM_RU); }
+float logf_rz(float x){ return logf_round(x, CRLIBM_RZ); }
+
+float log1pf_rn(float x){ return log1pf_round(x, CRLIBM_RN); }
+float log1pf_rd(float x){ return log1pf_round(x, CRLIBM_RD); }
+float log1pf_ru(float x){ return log1pf_round(x, CRLIBM_RU); }
+float log1pf_rz(float x){ return log1pf_round(x, CRLIBM_RZ); }
+
+#ifdef BUILD_VECTOR_ABI
+VECTOR_FLOAT_BATCH(logf_rn, logf_lanes_4, CRLIBM_RN)
+VECTOR_FLOAT_BATCH(logf_rd, logf_lanes_4, CRLIBM_RD)
+VECTOR_FLOAT_BATCH(logf_ru, logf_lanes_4, CRLIBM_RU)
+VECTOR_FLOAT_BATCH(logf_rz, logf_lanes_4, CRLIBM_RZ)
+VECTOR_FLOAT_BATCH(log1pf_rn, log1pf_lanes_4, CRLIBM_RN)
+VECTOR_FLOAT_BATCH(log1pf_rd, log1pf_lanes_4, CRLIBM_RD)
+VECTOR_FLOAT_BATCH(log1pf_ru, log1pf_lanes_4, CRLIBM_RU)
+VECTOR_FLOAT_BATCH(log1pf_rz, log1pf_lanes_4, CRLIBM_RZ)
+#else
+FLOAT_BATCH(logf_rn)
+FLOAT_BATCH(logf_rd)
+FLOAT_BATCH(logf_ru)
+FLOAT_BATCH(logf_rz)
+FLOAT_BATCH(log1pf_rn)
+FLOAT_BATCH(log1pf_rd)
+FLOAT_BATCH(log1pf_ru)
+FLOAT_BATCH(log1pf_rz)
+#endif
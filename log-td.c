@@ -311,7 +311,7 @@ void log_td_accurate(double *logh, double *logm, double *logl, int E, double ed,
       roundcst = ROUNDCST2;
 
 
-   if(logh == (logh + (logm * roundcst)))
+   if(QUICK_PHASE && logh == (logh + (logm * roundcst)))
      return logh;
    else 
      {
@@ -846,7 +846,9 @@ void log_td_accurate(double *logh, double *logm, double *logl, int E, double ed,
     ReturnRoundTowardsZero3(logh, logm, logl);
  } 
 
-#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Interleaved scalar version; with the vector variants, j_log is 
+   defined in log-batch.c on the lane kernel */
+#if defined(BUILD_INTERVAL_FUNCTIONS) && !defined(BUILD_VECTOR_ABI)
  interval j_log(interval x)
  {
    interval res;
@@ -31,6 +31,9 @@
 #include "crlibm_private.h"
 #include "triple-double.h"
 #include "log10-td.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
 
 #define AVOID_FMA 0
 
@@ -349,7 +352,7 @@ void log10_td_accurate(double *logb10h, double *logb10m, double *logb10l, int E,
       roundcst = ROUNDCST2;
 
 
-   if(logb10h == (logb10h + (logb10m * roundcst)))
+   if(QUICK_PHASE && logb10h == (logb10h + (logb10m * roundcst)))
      return logb10h;
    else 
      {
@@ -904,3 +907,100 @@ void log10_td_accurate(double *logb10h, double *logb10m, double *logb10l, int E,
 
 
 
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Quick phase of log10 for one bound of an interval, without the
+   final rounding. For x <= 0, Inf and NaN we set logb10h = logb10m = 0,
+   so that the rounding test fails and the bound is left to log10_rd
+   or log10_ru. */
+static void log10_quick_bound(double *logb10h, double *logb10m, double *roundcst, double x) {
+   db_number xdb;
+   double y, ed, ri, logih, logim, yrih, yril, th, zh, zl;
+   double polyHorner, zhSquareh, zhSquarel, polyUpper, zhSquareHalfh, zhSquareHalfl;
+   double t1h, t1l, t2h, t2l, ph, pl, log2edh, log2edl, logTabPolyh, logTabPolyl, logh, logm;
+   int E, index;
+
+   E=0;
+   xdb.d=x;
+   *roundcst = RDROUNDCST2;
+
+   if ((xdb.i[HI] <= 0) || (xdb.i[HI] >= 0x7ff00000)) { /* x <= 0, Inf or NaN */
+     *logb10h = 0.0;
+     *logb10m = 0.0;
+     return;
+   }
+   if (xdb.i[HI] < 0x00100000){        /* Subnormal number */
+     E = -52;
+     xdb.d *= two52;
+   }
+
+   E += (xdb.i[HI]>>20)-1023;
+   index = (xdb.i[HI] & 0x000fffff);
+   xdb.i[HI] =  index | 0x3ff00000;
+   index = (index + (1<<(20-L-1))) >> (20-L);
+   if (index >= MAXINDEX){
+     xdb.i[HI] -= 0x00100000; 
+     E++;
+   }
+   y = xdb.d;
+   index = index & INDEXMASK;
+   ed = (double) E;
+
+   ri = argredtable[index].ri;
+   logih = argredtable[index].logih;
+   logim = argredtable[index].logim;
+
+   Mul12(&yrih, &yril, y, ri);
+   th = yrih - 1.0; 
+   Add12Cond(zh, zl, th, yril); 
+
+#if defined(PROCESSOR_HAS_FMA) && !defined(AVOID_FMA)
+   polyHorner = FMA(FMA(FMA(FMA(c7,zh,c6),zh,c5),zh,c4),zh,c3);
+#else
+   polyHorner = c3 + zh * (c4 + zh * (c5 + zh * (c6 + zh * c7)));
+#endif
+
+   Mul12(&zhSquareh, &zhSquarel, zh, zh);
+   polyUpper = polyHorner * (zh * zhSquareh);
+   zhSquareHalfh = zhSquareh * -0.5;
+   zhSquareHalfl = zhSquarel * -0.5;
+   Add12(t1h, t1l, polyUpper, -1 * (zh * zl));
+   Add22(&t2h, &t2l, zh, zl, zhSquareHalfh, zhSquareHalfl);
+   Add22(&ph, &pl, t2h, t2l, t1h, t1l);
+
+   Add12(log2edh, log2edl, log2h * ed, log2m * ed);
+   Add22Cond(&logTabPolyh, &logTabPolyl, logih, logim, ph, pl);
+   Add22Cond(&logh, &logm, log2edh, log2edl, logTabPolyh, logTabPolyl);
+
+   Mul22(logb10h, logb10m, log10invh, log10invm, logh, logm);
+
+   if(E==0)
+      *roundcst = RDROUNDCST1;
+}
+
+
+interval j_log10(interval x)
+{
+  interval res;
+  double x_inf, x_sup, logh_inf, logm_inf, logh_sup, logm_sup;
+  double eps_inf, eps_sup, res_inf, res_sup;
+  int roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+
+  /* Intersect with the domain [0, +Inf] */
+  if (!(x_inf<=x_sup) || (x_sup < 0.0)) RETURN_EMPTY_INTERVAL;
+
+  log10_quick_bound(&logh_inf, &logm_inf, &eps_inf, x_inf);
+  log10_quick_bound(&logh_sup, &logm_sup, &eps_sup, x_sup);
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, logh_inf, logm_inf, res_sup, logh_sup, logm_sup, eps_inf, eps_sup);
+  if ((roundable & 1) == 0) res_inf = (x_inf <= 0.0) ? -1.0/0.0 : log10_rd(x_inf);
+  if ((roundable & 2) == 0) res_sup = log10_ru(x_sup);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
@@ -28,6 +28,9 @@
 #include "crlibm_private.h"
 #include "triple-double.h"
 #include "log-td.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
 
 #define AVOID_FMA 0
 
@@ -422,7 +425,7 @@ void log1p_td_accurate(double *logh, double *logm, double *logl, double ed, int
       roundcst = ROUNDCST2;
 
 
-   if(logh == (logh + (logm * roundcst)))
+   if(QUICK_PHASE && logh == (logh + (logm * roundcst)))
      return logh;
    else 
      {
@@ -1293,3 +1296,134 @@ double log1p_rz(double x) {
        
        ReturnRoundTowardsZero3(logh, logm, logl);
 }
+
+
+/* Round to odd, see RETURN_RO_FROM_RZ in crlibm_private.h: log1p is
+   exact only for x=0, and for the special arguments which return an
+   infinity or a NaN */
+double log1p_ro(double x) {
+  if (x == 0.0)
+    return x;
+  RETURN_RO_FROM_RZ(log1p_rz(x));
+}
+
+
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Quick phase of log1p for one bound of an interval, without the
+   final rounding. Below 2^(-54) in magnitude, for x <= -1, +Inf and NaN
+   we set logh = logm = 0, so that the rounding test fails and the
+   bound is left to log1p_rd or log1p_ru. */
+static void log1p_quick_bound(double *logh, double *logm, double *roundcst, double x) {
+   db_number xdb, shdb, scaledb;
+   double yh, yl, ed, ri, logih, logim, yhrih, yhril, ylri, t1, t2, t3, t4, t5, t6, zh, zm;
+   double polyHorner, zhSquareh, zhSquarel, polyUpper, zhSquareHalfh, zhSquareHalfl;
+   double t1h, t1l, t2h, t2l, ph, pl, log2edh, log2edl, logTabPolyh, logTabPolyl;
+   double sh, sl;
+   int E, index;
+
+   xdb.d=x;
+   *roundcst = RDROUNDCST2;
+
+   if (((xdb.i[HI] & 0x7fffffff) < 0x3c900000) 
+       || (((xdb.i[HI] & 0x80000000) != 0) && ((xdb.i[HI] & 0x7fffffff) >= 0x3ff00000))
+       || ((xdb.i[HI] & 0x7ff00000) == 0x7ff00000)) {
+     *logh = 0.0;
+     *logm = 0.0;
+     return;
+   }
+
+   E = 0;
+   if ((xdb.i[HI] & 0x7fffffff) < 0x3f700000) {
+     /* |x| < 2^(-8): no range reduction */
+     logih = 0.0;
+     logim = 0.0;
+     ed = 0.0;
+     zh = x;
+     zm = 0.0;
+   } else {
+     Add12Cond(sh,sl,1.0,x);
+     shdb.d = sh;
+     E += (shdb.i[HI]>>20)-1023;
+     index = (shdb.i[HI] & 0x000fffff);
+     shdb.i[HI] =  index | 0x3ff00000;
+     index = (index + (1<<(20-L-1))) >> (20-L);
+     if (index >= MAXINDEX){
+       shdb.i[HI] -= 0x00100000; 
+       E++;
+     }
+     yh = shdb.d;
+     index = index & INDEXMASK;
+     ed = (double) E;
+
+     ri = argredtable[index].ri;
+     logih = argredtable[index].logih;
+     logim = argredtable[index].logim;
+
+     if ((sl == 0.0) || (E > 125)) {
+       Mul12(&yhrih, &yhril, yh, ri);
+       t1 = yhrih - 1.0; 
+       Add12Cond(zh, zm, t1, yhril); 
+     } else {
+       scaledb.i[HI] = (-E + 1023) << 20;
+       scaledb.i[LO] = 0;
+       yl = sl * scaledb.d;
+       Mul12(&yhrih,&yhril,yh,ri);
+       ylri = yl * ri;
+       t1 = yhrih - 1.0;
+       Add12Cond(t2,t3,yhril,ylri);
+       Add12Cond(t4,t5,t1,t2);
+       t6 = t3 + t5;   /* zl is only needed by the accurate phase */
+       Add12Cond(zh,zm,t4,t6);
+     }
+   }
+
+#if defined(PROCESSOR_HAS_FMA) && !defined(AVOID_FMA)
+   polyHorner = FMA(FMA(FMA(FMA(c7,zh,c6),zh,c5),zh,c4),zh,c3);
+#else
+   polyHorner = c3 + zh * (c4 + zh * (c5 + zh * (c6 + zh * c7)));
+#endif
+
+   Mul12(&zhSquareh, &zhSquarel, zh, zh);
+   polyUpper = polyHorner * (zh * zhSquareh);
+   zhSquareHalfh = zhSquareh * -0.5;
+   zhSquareHalfl = zhSquarel * -0.5;
+   Add12(t1h, t1l, polyUpper, -1 * (zh * zm));
+   Add22(&t2h, &t2l, zh, zm, zhSquareHalfh, zhSquareHalfl);
+   Add22(&ph, &pl, t2h, t2l, t1h, t1l);
+
+   Add12(log2edh, log2edl, log2h * ed, log2m * ed);
+   Add22Cond(&logTabPolyh, &logTabPolyl, logih, logim, ph, pl);
+   Add22Cond(logh, logm, log2edh, log2edl, logTabPolyh, logTabPolyl);
+
+   if(E==0)
+      *roundcst = RDROUNDCST1;
+}
+
+
+interval j_log1p(interval x)
+{
+  interval res;
+  double x_inf, x_sup, logh_inf, logm_inf, logh_sup, logm_sup;
+  double eps_inf, eps_sup, res_inf, res_sup;
+  int roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+
+  /* Intersect with the domain [-1, +Inf] */
+  if (!(x_inf<=x_sup) || (x_sup < -1.0)) RETURN_EMPTY_INTERVAL;
+
+  log1p_quick_bound(&logh_inf, &logm_inf, &eps_inf, x_inf);
+  log1p_quick_bound(&logh_sup, &logm_sup, &eps_sup, x_sup);
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, logh_inf, logm_inf, res_sup, logh_sup, logm_sup, eps_inf, eps_sup);
+  if ((roundable & 1) == 0) res_inf = (x_inf <= -1.0) ? -1.0/0.0 : log1p_rd(x_inf);
+  if ((roundable & 2) == 0) res_sup = log1p_ru(x_sup);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
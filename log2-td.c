@@ -31,7 +31,8 @@
 #define AVOID_FMA 0
 
 
-void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, double ed, int index, double zh, double zl, double logih, double logim) {
+/* The accurate phase, returning log2(x) if base2 is set, else log(x) */
+static void logb_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, double ed, int index, double zh, double zl, double logih, double logim, int base2) {
   double highPoly, t1h, t1l, t2h, t2l, t3h, t3l, t4h, t4l, t5h, t5l, t6h, t6l, t7h, t7l, t8h, t8l, t9h, t9l, t10h, t10l, t11h, t11l;
   double t12h, t12l, t13h, t13l, t14h, t14l, zSquareh, zSquarem, zSquarel, zCubeh, zCubem, zCubel, higherPolyMultZh, higherPolyMultZm;
   double higherPolyMultZl, zSquareHalfh, zSquareHalfm, zSquareHalfl, polyWithSquareh, polyWithSquarem, polyWithSquarel;
@@ -149,7 +150,14 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
 
   /* Change logarithm base from natural base to base 2 by multiplying */
 
-  Mul233(&logb2hover, &logb2mover, &logb2lover, log2invh, log2invl, loghover, logmover, loglover);
+  if(base2) {
+    Mul233(&logb2hover, &logb2mover, &logb2lover, log2invh, log2invl, loghover, logmover, loglover);
+  }
+  else {
+    logb2hover = loghover;
+    logb2mover = logmover;
+    logb2lover = loglover;
+  }
 
 
   /* Since we can not guarantee in each addition and multiplication procedure that 
@@ -161,6 +169,10 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
 
 }
 
+void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, double ed, int index, double zh, double zl, double logih, double logim) {
+  logb_td_accurate(logb2h, logb2m, logb2l, E, ed, index, zh, zl, logih, logim, 1);
+}
+
 
 
 /*************************************************************
@@ -331,7 +343,7 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
       roundcst = ROUNDCST2;
 
 
-   if(logb2h == (logb2h + (logb2m * roundcst)))
+   if(QUICK_PHASE && logb2h == (logb2h + (logb2m * roundcst)))
      return logb2h;
    else 
      {
@@ -935,10 +947,230 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
     ReturnRoundTowardsZero3(logb2h, logb2m, logb2l);
  } 
 
+
+/* Round to odd, see RETURN_RO_FROM_RZ in crlibm_private.h: log2 is
+   exact for the powers of two (normal or subnormal), and for the
+   special arguments which return an infinity or a NaN */
+ double log2_ro(double x) {
+   db_number xdb;
+
+   xdb.d = x;
+   if (((xdb.l & ULL(000fffffffffffff)) == 0) 
+       || (((xdb.l & ULL(fff0000000000000)) == 0) && ((xdb.l & (xdb.l - 1)) == 0)))
+     return log2_rz(x);
+   RETURN_RO_FROM_RZ(log2_rz(x));
+ }
+
+
+/* Functions log_td, log2_td, log_dd and log2_dd, see crlibm.h: the
+   argument reduction of log2_rn, then the accurate phase of log. The
+   change of base multiplies by 1/ln(2) as a triple-double: with the
+   double-double of log2_rn, the error of log2_td would be 2^-110. The
+   relative error is below 2^-117 for both functions. */
+static void logb_td(double *resh, double *resm, double *resl, double x, int base2) {
+   db_number xdb;
+   double y, ed, ri, logih, logim, yrih, yril, th, zh, zl;
+   double logh, logm, logl, logb2h, logb2m, logb2l;
+   int E, index;
+
+   E=0;
+   xdb.d=x;
+   *resm = 0;
+   *resl = 0;
+
+   if (xdb.i[HI] < 0x00100000){        /* x < 2^(-1022)    */
+     if (((xdb.i[HI] & 0x7fffffff)|xdb.i[LO])==0){
+       *resh = -1.0/0.0;             /* log(+/-0) = -Inf */
+       return;
+     }
+     if (xdb.i[HI] < 0){
+       *resh = (x-x)/0;              /* log(-x) = Nan    */
+       return;
+     }
+     /* Subnormal number */
+     E = -52;
+     xdb.d *= two52; 	  /* make x a normal number    */
+   }
+   if (xdb.i[HI] >= 0x7ff00000){
+     *resh = x+x;                    /* Inf or Nan       */
+     return;
+   }
+   if (x == 1.0) {
+     *resh = 0;
+     return;
+   }
+
+   E += (xdb.i[HI]>>20)-1023;             /* extract the exponent */
+   index = (xdb.i[HI] & 0x000fffff);
+   xdb.i[HI] =  index | 0x3ff00000;	/* do exponent = 0 */
+   index = (index + (1<<(20-L-1))) >> (20-L);
+   if (index >= MAXINDEX){ /* corresponds to xdb>sqrt(2)*/
+     xdb.i[HI] -= 0x00100000;
+     E++;
+   }
+   y = xdb.d;
+   index = index & INDEXMASK;
+   ed = (double) E;
+
+   ri = argredtable[index].ri;
+   logih = argredtable[index].logih;
+   logim = argredtable[index].logim;
+
+   Mul12(&yrih, &yril, y, ri);
+   th = yrih - 1.0;
+   Add12Cond(zh, zl, th, yril);
+
+   if (!base2) {
+     logb_td_accurate(resh, resm, resl, E, ed, index, zh, zl, logih, logim, 0);
+     return;
+   }
+   logb_td_accurate(&logh, &logm, &logl, E, ed, index, zh, zl, logih, logim, 0);
+   Mul33(&logb2h, &logb2m, &logb2l, log2invh, log2invl, log2invll, logh, logm, logl);
+   Renormalize3(resh, resm, resl, logb2h, logb2m, logb2l);
+}
+
+void log_td(double *resh, double *resm, double *resl, double x) {
+  logb_td(resh, resm, resl, x, 0);
+}
+
+void log2_td(double *resh, double *resm, double *resl, double x) {
+  logb_td(resh, resm, resl, x, 1);
+}
+
+void log_dd(double *resh, double *resl, double x) {
+  double resm, resll;
+
+  logb_td(resh, &resm, &resll, x, 0);
+  *resl = resm + resll;
+}
+
+void log2_dd(double *resh, double *resl, double x) {
+  double resm, resll;
+
+  logb_td(resh, &resm, &resll, x, 1);
+  *resl = resm + resll;
+}
+
+
+
+/*************************************************************
+ *************************************************************
+ *      NATURAL LOG OF A DOUBLE-DOUBLE, ROUNDED TO NEAREST    *
+ *************************************************************
+ *************************************************************/
+
+/* log(xh + xl) for a double-double with |xl| <= ulp(xh)/2, see
+   crlibm.h. The argument reduction is that of log2_rn, where y + yl,
+   with yl = xl 2^-E, replaces y: the reduced argument
+
+      z = (y + yl) * ri - 1 = zh + zl + zll
+
+   is exact as a triple-double, but for the rounding of t2 + b which
+   lies 2^-100 below it. The quick phase and the accurate phase work on
+   zh + zl as in log2_rn, without the change of base; the accurate
+   phase then adds log(1+z) - log(1+zh+zl) = zll - zll zh, up to
+   2^-200. The rounding constant of log2_rn also bounds the error of
+   the quick phase here, which only lacks the final multiplication by
+   1/log(2). */
+double log_dd_rn(double xh, double xl){
+   db_number xdb;
+   double y, yl, ed, ri, logih, logim, yrih, yril, th, zh, zl, zll;
+   double a, b, s1, s2, u1, u2, t1, t2, v1, v2, v3, corr;
+   double polyHorner, zhSquareh, zhSquarel, polyUpper, zhSquareHalfh, zhSquareHalfl;
+   double t1h, t1l, t2h, t2l, ph, pl, log2edh, log2edl, logTabPolyh, logTabPolyl, logh, logm, roundcst;
+   double logb2h, logb2m, logb2l, resh, resm, resl;
+   int E, index;
+
+   E=0;
+   xdb.d=xh;
+
+   /* Filter cases on xh: if xh is 0 or subnormal, xl is 0 */
+   if (xdb.i[HI] < 0x00100000){        /* xh < 2^(-1022)    */
+     if (((xdb.i[HI] & 0x7fffffff)|xdb.i[LO])==0){
+       return -1.0/0.0;
+     }                    		   /* log(+/-0) = -Inf */
+     if (xdb.i[HI] < 0){
+       return (xh-xh)/0;                    /* log(-x) = Nan    */
+     }
+     /* Subnormal number */
+     E = -52;
+     xdb.d *= two52; 	  /* make x a normal number    */
+   }
+
+   if (xdb.i[HI] >= 0x7ff00000){
+     return  xh+xh;				 /* Inf or Nan       */
+   }
+
+   E += (xdb.i[HI]>>20)-1023;             /* extract the exponent */
+   index = (xdb.i[HI] & 0x000fffff);
+   xdb.i[HI] =  index | 0x3ff00000;	/* do exponent = 0 */
+   index = (index + (1<<(20-L-1))) >> (20-L);
+   if (index >= MAXINDEX){ /* corresponds to xdb>sqrt(2)*/
+     xdb.i[HI] -= 0x00100000;
+     E++;
+   }
+   y = xdb.d;
+   index = index & INDEXMASK;
+   ed = (double) E;
+
+   /* y/xh is a power of 2, so yl is exact but for underflow */
+   yl = (xl != 0) ? xl * (y/xh) : 0;
+
+   ri = argredtable[index].ri;
+   logih = argredtable[index].logih;
+   logim = argredtable[index].logim;
+
+   /* zh + zl + zll = y * ri - 1 + yl * ri */
+   Mul12(&yrih, &yril, y, ri);
+   th = yrih - 1.0;
+   Mul12(&a, &b, yl, ri);
+   Add12Cond(s1, s2, yril, a);
+   Add12Cond(u1, u2, th, s1);
+   Add12Cond(t1, t2, u2, s2);
+   Add12Cond(v1, v2, t1, t2 + b);
+   Add12Cond(zh, v3, u1, v1);
+   Add12Cond(zl, zll, v3, v2);
+
+   /* Quick phase, as in log2_rn */
+#if defined(PROCESSOR_HAS_FMA) && !defined(AVOID_FMA)
+   polyHorner = FMA(FMA(FMA(FMA(c7,zh,c6),zh,c5),zh,c4),zh,c3);
+#else
+   polyHorner = c3 + zh * (c4 + zh * (c5 + zh * (c6 + zh * c7)));
+#endif
+
+   Mul12(&zhSquareh, &zhSquarel, zh, zh);
+   polyUpper = polyHorner * (zh * zhSquareh);
+   zhSquareHalfh = zhSquareh * -0.5;
+   zhSquareHalfl = zhSquarel * -0.5;
+   Add12(t1h, t1l, polyUpper, -1 * (zh * zl));
+   Add22(&t2h, &t2l, zh, zl, zhSquareHalfh, zhSquareHalfl);
+   Add22(&ph, &pl, t2h, t2l, t1h, t1l);
+
+   Add12(log2edh, log2edl, log2h * ed, log2m * ed);
+   Add22Cond(&logTabPolyh, &logTabPolyl, logih, logim, ph, pl);
+   Add22Cond(&logh, &logm, log2edh, log2edl, logTabPolyh, logTabPolyl);
+
+   if(E==0)
+      roundcst = ROUNDCST1;
+   else
+      roundcst = ROUNDCST2;
+
+   if(QUICK_PHASE && logh == (logh + (logm * roundcst)))
+     return logh;
+
+   /* Accurate phase */
+   logb_td_accurate(&logb2h, &logb2m, &logb2l, E, ed, index, zh, zl, logih, logim, 0);
+   corr = zll - zll * zh;
+   Add133Cond(&resh, &resm, &resl, corr, logb2h, logb2m, logb2l);
+   Renormalize3(&logb2h, &logb2m, &logb2l, resh, resm, resl);
+
+   ReturnRoundToNearest3(logb2h, logb2m, logb2l);
+}
+
 #ifdef BUILD_INTERVAL_FUNCTIONS
  interval j_log2(interval x) { 
    interval res;
-   double res_inf, res_sup, restemp_inf, restemp_sup;
+   double restemp_inf, restemp_sup;
    int infDone, supDone;
    int roundable;
    db_number xdb_inf;
@@ -958,7 +1190,13 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
    double x_inf, x_sup;
    x_inf=LOW(x);
    x_sup=UP(x);
+
+   /* Intersect with the domain [0, +Inf], as j_log */
+   if (!(x_inf<=x_sup) || (x_sup < 0.0)) RETURN_EMPTY_INTERVAL;
+   if (x_inf < 0.0) x_inf = 0.0;
+
    infDone=0; supDone=0;
+   restemp_inf=0; restemp_sup=0;
 
    E_inf=0;
    E_sup=0;
@@ -1029,7 +1267,7 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
 	just the exponant of the number 
      */
 
-     supDone=1;
+     infDone=1;
      restemp_inf = (double) E_inf;
 
    }
@@ -1130,7 +1368,7 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
 
 
 #if defined(PROCESSOR_HAS_FMA) && !defined(AVOID_FMA)
-     polyHorner_inf = FMA(FMA(FMA(FMA(c7_inf,zh_inf,c6),zh_inf,c5),zh_inf,c4),zh_inf,c3);
+     polyHorner_inf = FMA(FMA(FMA(FMA(c7,zh_inf,c6),zh_inf,c5),zh_inf,c4),zh_inf,c3);
      polyHorner_sup = FMA(FMA(FMA(FMA(c7,zh_sup,c6),zh_sup,c5),zh_sup,c4),zh_sup,c3);
 #else
      polyHorner_inf = c3 + zh_inf * (c4 + zh_inf * (c5 + zh_inf * (c6 + zh_inf * c7)));
@@ -1293,7 +1531,7 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
 
 
 #if defined(PROCESSOR_HAS_FMA) && !defined(AVOID_FMA)
-     polyHorner_inf = FMA(FMA(FMA(FMA(c7_inf,zh_inf,c6),zh_inf,c5),zh_inf,c4),zh_inf,c3);
+     polyHorner_inf = FMA(FMA(FMA(FMA(c7,zh_inf,c6),zh_inf,c5),zh_inf,c4),zh_inf,c3);
 #else
      polyHorner_inf = c3 + zh_inf * (c4 + zh_inf * (c5 + zh_inf * (c6 + zh_inf * c7)));
 #endif
@@ -1372,7 +1610,7 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
      ASSIGN_UP(res,restemp_sup);
      return res;
    }
-   if((supDone==0))
+   /* Here infDone==1 and supDone==0 */
    {
      xdb_sup.i[HI] =  index_sup | 0x3ff00000;	/* do exponent = 0 */
      index_sup = (index_sup + (1<<(20-L-1))) >> (20-L);
@@ -1515,7 +1753,8 @@ void log2_td_accurate(double *logb2h, double *logb2m, double *logb2l, int E, dou
      ASSIGN_UP(res,restemp_sup);
      return res;
    }
-
  } 
+
+INTERVAL_BATCH(j_log2)
 #endif
 
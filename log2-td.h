@@ -14,6 +14,7 @@
 #define log2l -1.31246984177852556920995753667322295879593697972250e-27
 #define log2invh 1.44269504088896338700465094007086008787155151367188e+00
 #define log2invl 2.03552737409310331110210900522069120325603861485809e-17
+#define log2invll -1.06146599561172578726170815656024911350987845054774e-33
 #define ROUNDCST1 1.00787401574803160796292764473221714405939530505554e+00
 #define ROUNDCST2 1.00787401574803160796292764473221714405939530505554e+00
 #define RDROUNDCST1 4.33680868994201773602981120347976684570312500000000e-19
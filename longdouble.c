@@ -0,0 +1,465 @@
+/*
+ * Correctly rounded exp, log, sin and cos on the x87 double-extended
+ * format (long double, 64-bit significand)
+ *
+ * Each function has two phases, like the double ones:
+ *
+ * - the quick phase reduces the long double argument in long double
+ *   arithmetic to doubles, and evaluates the function in
+ *   triple-double with the triple-double results of crlibm (exp_td,
+ *   log_td) corrected for the low part of the argument. Its relative
+ *   error is below 2^-105, some 40 bits beyond the format;
+ *
+ * - the accurate phase works in SCS, from the long double argument
+ *   exactly: a Taylor series for exp, scs_log for log, and the SCS
+ *   argument reduction of the double sine, which the table of 2/Pi of
+ *   rem_pio2_accurate.h extends to the whole long double range, for
+ *   sin and cos. The sine and cosine have no quicker phase than this
+ *   one, sin_td and cos_td being SCS themselves.
+ *
+ * The triple-double result h + m + l is rounded to long double by
+ * ld_round below, which works in long double arithmetic. The worst
+ * cases of the rounding to the double-extended format are not known
+ * for these functions, so that correct rounding is not proven: if
+ * the accurate phase (relative error below 2^-120) cannot decide, the
+ * rounding of its result is returned.
+ *
+ * The x87 unit is set to double precision by crlibm_init: each
+ * function switches it to extended precision for its long double
+ * operations, to double precision for the double ones (which are x87
+ * operations on x86), and restores the caller's control word.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+
+#if (defined(CRLIBM_TYPECPU_X86) || defined(CRLIBM_TYPECPU_AMD64)) && defined(CRLIBM_HAS_FPU_CONTROL)
+
+#include <float.h>
+#include "triple-double.h"
+#include "double-extended.h"
+
+/* ln(2) = LN2H + LN2M + LN2L, LN2H on 48 bits, so that k*LN2H is exact
+   in long double for |k| < 2^15 */
+#define LN2H  0x1.62e42fefa39e0p-1
+#define LN2M  0x1.e6af278ece601p-50
+#define LN2L -0x1.a12a17e1979b3p-109
+
+#define INV_LN2 0xb8aa3b295c17f0bcp-63L
+#define SHIFT   0x1.8p63L
+
+#define SQRT_2 1.4142135623730950489e0
+
+/* exp overflows above, and is below half the smallest subnormal below */
+#define EXPL_OVERFLOW   11357.3L
+#define EXPL_UNDERFLOW -11400.0L
+
+
+/* 2^e as a long double, for -16382 <= e <= 16383 */
+static long double ld_pow2(int e) {
+  db_ext_number u;
+
+  u.i[DE_EXP] = e + 16383;
+  u.i[DE_MANTISSA_HI] = 0x80000000;
+  u.i[DE_MANTISSA_LO] = 0;
+  return u.d;
+}
+
+/* The long double next to x toward zero, for x finite and non zero */
+static long double ld_next_toward_zero(long double x) {
+  db_ext_number u;
+  unsigned int hi, lo;
+  int e;
+
+  u.d = x;
+  e  = u.i[DE_EXP] & 0x7fff;
+  hi = u.i[DE_MANTISSA_HI];
+  lo = u.i[DE_MANTISSA_LO];
+  if (e > 1 && hi == 0x80000000 && lo == 0) {
+    u.i[DE_EXP]--;
+    hi = 0xffffffff;
+    lo = 0xffffffff;
+  }
+  else {
+    if (e == 1 && hi == 0x80000000 && lo == 0)
+      u.i[DE_EXP]--;
+    if (lo-- == 0)
+      hi--;
+  }
+  u.i[DE_MANTISSA_HI] = hi;
+  u.i[DE_MANTISSA_LO] = lo;
+  return u.d;
+}
+
+
+/* Rounds (h + m + l) * 2^k to long double in the given mode. h + m +
+   l is a non-overlapping triple-double with h a normal double, and
+   approximates the value with a relative error below eps. Returns 1
+   with the rounding in *res, or 0 if it cannot be decided. If eps is
+   negative, the rounding of h + m + l is returned anyway.
+
+   s = RN(h + m) on 64 bits and t = h + m - s + l, so that the value is
+   s + t within 2^-125 of it. lo is s rounded to the precision of the
+   result (of the subnormals if the result is one): the value is lo +
+   d, d being at most one ulp u of lo away, and the spacing below lo is
+   ub (u/2 at a power of two). Must be called in extended precision. */
+static int ld_round(long double *res, double h, double m, double l, int k,
+                    long double eps, int mode) {
+  long double s, t, u, ub, lo, d, ad, err, half, r;
+  db_ext_number sdb;
+  int neg, away, ex, ue, k1;
+
+  s = (long double) h + m;
+  t = (((long double) h - s) + m) + l;
+  neg = (s < 0);
+  if (neg) {
+    s = -s;
+    t = -t;
+  }
+  away = (mode == CRLIBM_RU && !neg) || (mode == CRLIBM_RD && neg);
+
+  sdb.d = s;
+  ex = (sdb.i[DE_EXP] & 0x7fff) - 16383;
+  if (ex + k > 16383) {
+    r = (mode == CRLIBM_RN || away) ? ld_pow2(16383)*2 : LDBL_MAX;
+    *res = neg ? -r : r;
+    return 1;
+  }
+
+  ub = 0;
+  if (ex + k < -16382) {
+    /* subnormal result: round s to a multiple of u, to nearest */
+    ue = -16445 - k;
+    u  = ld_pow2(ue);
+    lo = (s + ld_pow2(ue + 63)) - ld_pow2(ue + 63);
+    ub = u;
+  }
+  else {
+    ue = ex - 63;
+    u  = ld_pow2(ue);
+    lo = s;
+    ub = (s == ld_pow2(ex) && ex + k > -16382) ? u*0.5L : u;
+  }
+  d  = (s - lo) + t;
+  ad = (d < 0) ? -d : d;
+  err = (eps < 0) ? -1 : (eps + 0x1p-120L) * s;
+
+  if (mode == CRLIBM_RN) {
+    half = (d < 0) ? ub*0.5L : u*0.5L;
+    if (ad - half <= err && half - ad <= err)
+      return 0;
+    if (ad <= half)
+      r = lo;
+    else
+      r = (d < 0) ? lo - ub : lo + u;
+  }
+  else {
+    if (ad <= err || (d > 0 && u - d <= err) || (d < 0 && ub + d <= err))
+      return 0;
+    if (away)
+      r = (d > 0) ? lo + u : lo;
+    else
+      r = (d < 0) ? lo - ub : lo;
+  }
+
+  /* two exact scalings, the first staying in the normal range */
+  k1 = k/2;
+  r = (r * ld_pow2(k1)) * ld_pow2(k - k1);
+  *res = neg ? -r : r;
+  return 1;
+}
+
+
+
+/*************************************************************
+ *                         exp                               *
+ *************************************************************/
+
+/* exp(x) = 2^k exp(r) with r = x - k ln(2), |r| < ln(2)/2.
+
+   The quick phase computes x - k LN2H exactly in long double, splits
+   it into two doubles, and subtracts k (LN2M + LN2L) in double-double:
+   the absolute error on r is below 2^-105. Then exp(rh + rl) = exp_td(rh)
+   * (1 + rl + rl^2/2), the neglected rl^3/6 being below 2^-160.
+
+   The accurate phase is scs_exp_reduced (crlibm_private.c), x being
+   the sum of two doubles. */
+
+static long double expl_mode(long double x, int mode) {
+  db_ext_number xdb;
+  long double kd, r1, res;
+  double xh, xl, r1h, r1l, kdd, ph, pl, rh, rl, eh, em, el, ch, cm, cl;
+  scs_t X, T, P;
+  unsigned short cw;
+  int e, k;
+
+  xdb.d = x;
+  e = xdb.i[DE_EXP] & 0x7fff;
+  if (e == 0x7fff) {
+    if ((xdb.i[DE_MANTISSA_HI] & 0x7fffffff) != 0 || xdb.i[DE_MANTISSA_LO] != 0)
+      return x + x;                          /* NaN */
+    return (xdb.i[DE_EXP] & 0x8000) ? 0 : x; /* exp(-inf) = 0, exp(inf) = inf */
+  }
+  if (e < 16383 - 100) {
+    /* |x| < 2^-100: exp(x) is 1 + x within 2^-200 */
+    if (x == 0)
+      return 1;
+    if (mode == CRLIBM_RU && x > 0)
+      return 0x1.0000000000000002p0L;
+    if ((mode == CRLIBM_RD || mode == CRLIBM_RZ) && x < 0)
+      return 0x1.fffffffffffffffep-1L;
+    return 1;
+  }
+  if (x > EXPL_OVERFLOW)
+    return (mode == CRLIBM_RU || mode == CRLIBM_RN) ? LDBL_MAX*2 : LDBL_MAX;
+  if (x < EXPL_UNDERFLOW)
+    return (mode == CRLIBM_RU) ? 0x1p-16445L : 0;
+
+  _FPU_GETCW(cw);
+  DOUBLE_EXTENDED_MODE;
+  kd = (x * INV_LN2 + SHIFT) - SHIFT;
+  k  = (int) kd;
+  r1 = x - kd * LN2H;
+  r1h = (double) r1;
+  r1l = (double) (r1 - r1h);
+  xh  = (double) x;
+  xl  = (double) (x - xh);
+
+  BACK_TO_DOUBLE_MODE;
+  kdd = (double) k;
+  Mul12(&ph, &pl, kdd, LN2M);
+  Add22Cond(&rh, &rl, r1h, r1l, -ph, -pl - kdd*LN2L);
+  exp_td(&eh, &em, &el, rh);
+  Mul33(&ch, &cm, &cl, eh, em, el, 1.0, rl, 0.5*rl*rl);
+  Renormalize3(&eh, &em, &el, ch, cm, cl);
+
+  DOUBLE_EXTENDED_MODE;
+  if (ld_round(&res, eh, em, el, k, 0x1p-105L, mode)) {
+    _FPU_SETCW(cw);
+    return res;
+  }
+
+  /* Accurate phase */
+  BACK_TO_DOUBLE_MODE;
+  scs_set_d(X, xh);
+  scs_set_d(T, xl);
+  scs_add(X, X, T);
+  scs_exp_reduced(P, X, k);
+  scs_get_td(&eh, &em, &el, P);
+
+  DOUBLE_EXTENDED_MODE;
+  if (!ld_round(&res, eh, em, el, k, 0x1p-120L, mode))
+    ld_round(&res, eh, em, el, k, -1, mode);
+  _FPU_SETCW(cw);
+  return res;
+}
+
+
+
+/*************************************************************
+ *                         log                               *
+ *************************************************************/
+
+/* log(x) = E ln(2) + log(m) with m in [sqrt(2)/2, sqrt(2)], and
+   m = mh + ml, mh the double nearest to m. Then log(m) = log(mh) +
+   log(1 + t) with t = ml/mh, |t| < 2^-53.
+
+   The quick phase adds E ln(2), log_td(mh) and t - t^2/2 in
+   triple-double. The neglected t^3/3 is below 2^-159, and the terms
+   cancel at most by one bit (for E = 0, mh near 1), hence a relative
+   error below 2^-105.
+
+   The accurate phase adds scs_log(mh, E) (which includes E ln(2)) and
+   t - t^2/2 + t^3/3 in SCS. */
+
+static long double logl_mode(long double x, int mode) {
+  db_ext_number xdb;
+  db_number mdb;
+  long double m, res;
+  double mh, ml, th, tl, p, q, ah, al, lh, lm, ll, eh, em, el, sh, sm, sl, rh, rm, rl;
+  scs_t R, A, B, T, T2, T3;
+  unsigned short cw;
+  int e, E;
+
+  xdb.d = x;
+  e = xdb.i[DE_EXP] & 0x7fff;
+  if (e == 0x7fff) {
+    if ((xdb.i[DE_MANTISSA_HI] & 0x7fffffff) != 0 || xdb.i[DE_MANTISSA_LO] != 0)
+      return x + x;                          /* NaN */
+    return (xdb.i[DE_EXP] & 0x8000) ? (x - x) : x; /* log(-inf) = NaN, log(inf) = inf */
+  }
+  if (x == 0)
+    return -1.0L/0.0L;
+  if (x < 0)
+    return (x - x)/0;
+  if (x == 1)
+    return 0;
+
+  _FPU_GETCW(cw);
+  DOUBLE_EXTENDED_MODE;
+  E = 0;
+  if (e == 0) {
+    /* subnormal */
+    xdb.d = x * 0x1p64L;
+    e = xdb.i[DE_EXP] & 0x7fff;
+    E = -64;
+  }
+  E += e - 16383;
+  xdb.i[DE_EXP] = 16383;
+  m = xdb.d;
+  if (m > SQRT_2) {
+    m *= 0.5L;
+    E++;
+  }
+  mh = (double) m;
+  ml = (double) (m - mh);
+
+  BACK_TO_DOUBLE_MODE;
+  log_td(&lh, &lm, &ll, mh);
+  th = ml/mh;
+  Mul12(&p, &q, th, mh);
+  tl = ((ml - p) - q)/mh;
+  Add12Cond(ah, al, th, tl - 0.5*th*th);
+  if (E == 0) {
+    Add233Cond(&sh, &sm, &sl, ah, al, lh, lm, ll);
+  }
+  else {
+    Mul133(&eh, &em, &el, (double) E, LN2H, LN2M, LN2L);
+    Add33Cond(&rh, &rm, &rl, eh, em, el, lh, lm, ll);
+    Add233Cond(&sh, &sm, &sl, ah, al, rh, rm, rl);
+  }
+  Renormalize3(&rh, &rm, &rl, sh, sm, sl);
+
+  DOUBLE_EXTENDED_MODE;
+  if (ld_round(&res, rh, rm, rl, 0, 0x1p-105L, mode)) {
+    _FPU_SETCW(cw);
+    return res;
+  }
+
+  /* Accurate phase */
+  BACK_TO_DOUBLE_MODE;
+  mdb.d = mh;
+  scs_log(R, mdb, E);
+  if (ml != 0) {
+    scs_set_d(A, ml);
+    scs_set_d(B, mh);
+    scs_div(T, A, B);
+    scs_square(T2, T);
+    scs_mul(T3, T2, T);
+    scs_set_si(A, 3);
+    scs_div(T3, T3, A);
+    scs_div_2(T2);
+    scs_sub(T, T, T2);
+    scs_add(T, T, T3);
+    scs_add(R, R, T);
+  }
+  scs_get_td(&rh, &rm, &rl, R);
+
+  DOUBLE_EXTENDED_MODE;
+  if (!ld_round(&res, rh, rm, rl, 0, 0x1p-120L, mode))
+    ld_round(&res, rh, rm, rl, 0, -1, mode);
+  _FPU_SETCW(cw);
+  return res;
+}
+
+
+
+/*************************************************************
+ *                       sin and cos                         *
+ *************************************************************/
+
+/* x is split into two doubles, scaled by 2^(-30j) first if it is
+   beyond the double range, and these are set in SCS with their index
+   raised by j: the SCS reduction gets x exactly. */
+
+static long double sincosl_mode(long double x, int cosine, int mode) {
+  db_ext_number xdb;
+  long double y, res;
+  double yh, yl, rh, rm, rl;
+  scs_t XH, XL, R;
+  unsigned short cw;
+  int e, j;
+
+  xdb.d = x;
+  e = xdb.i[DE_EXP] & 0x7fff;
+  if (e == 0x7fff)
+    return x - x;               /* sin(Inf) = cos(Inf) = NaN */
+  if (x == 0)
+    return cosine ? 1 : x;
+  if (e < 16383 - 32) {
+    /* |x| < 2^-32: cos(x) = 1 - x^2/2 with x^2/2 below the half-ulp
+       2^-65 of 1-, sin(x) = x - x^3/6 with x^3/6 below half an ulp of x */
+    if (cosine)
+      return (mode == CRLIBM_RD || mode == CRLIBM_RZ) ? 0x1.fffffffffffffffep-1L : 1;
+    if (mode == CRLIBM_RZ || (mode == CRLIBM_RD && x > 0) || (mode == CRLIBM_RU && x < 0))
+      return ld_next_toward_zero(x);
+    return x;
+  }
+
+  _FPU_GETCW(cw);
+  DOUBLE_EXTENDED_MODE;
+  j = 0;
+  y = x;
+  if (e > 16383 + 900) {
+    j = (e - 16383 - 900)/30 + 1;
+    y = x * ld_pow2(-30*j);
+  }
+  yh = (double) y;
+  yl = (double) (y - yh);
+
+  BACK_TO_DOUBLE_MODE;
+  scs_set_d(XH, yh);
+  scs_set_d(XL, yl);
+  XH->index += j;
+  if (yl != 0)
+    XL->index += j;
+  scs_sincos_scs(R, XH, XL, cosine);
+  scs_get_td(&rh, &rm, &rl, R);
+
+  DOUBLE_EXTENDED_MODE;
+  if (!ld_round(&res, rh, rm, rl, 0, 0x1p-115L, mode))
+    ld_round(&res, rh, rm, rl, 0, -1, mode);
+  _FPU_SETCW(cw);
+  return res;
+}
+
+
+
+long double expl_rn(long double x) { return expl_mode(x, CRLIBM_RN); }
+long double expl_ru(long double x) { return expl_mode(x, CRLIBM_RU); }
+long double expl_rd(long double x) { return expl_mode(x, CRLIBM_RD); }
+long double expl_rz(long double x) { return expl_mode(x, CRLIBM_RZ); }
+
+long double logl_rn(long double x) { return logl_mode(x, CRLIBM_RN); }
+long double logl_ru(long double x) { return logl_mode(x, CRLIBM_RU); }
+long double logl_rd(long double x) { return logl_mode(x, CRLIBM_RD); }
+long double logl_rz(long double x) { return logl_mode(x, CRLIBM_RZ); }
+
+long double sinl_rn(long double x) { return sincosl_mode(x, 0, CRLIBM_RN); }
+long double sinl_ru(long double x) { return sincosl_mode(x, 0, CRLIBM_RU); }
+long double sinl_rd(long double x) { return sincosl_mode(x, 0, CRLIBM_RD); }
+long double sinl_rz(long double x) { return sincosl_mode(x, 0, CRLIBM_RZ); }
+
+long double cosl_rn(long double x) { return sincosl_mode(x, 1, CRLIBM_RN); }
+long double cosl_ru(long double x) { return sincosl_mode(x, 1, CRLIBM_RU); }
+long double cosl_rd(long double x) { return sincosl_mode(x, 1, CRLIBM_RD); }
+long double cosl_rz(long double x) { return sincosl_mode(x, 1, CRLIBM_RZ); }
+
+#endif /* x86 with fpu_control.h */
@@ -4,6 +4,9 @@
 #include "crlibm_private.h"
 #include "triple-double.h"
 #include "pow.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
 
 
 /* Some macros for specific operations in power */
@@ -750,11 +753,16 @@ double pow_exact_rn(double x, double y, double sign,
   double kh, kl;
   double log2xh;
 
+#if EVAL_PERF==1
+  crlibm_second_step_taken++;
+#endif
+
   pow_120(&H, &powh, &powm, &powl, &log2xh, y, index, ed, zh, zm);
 
   if (pow_round_and_check_rn(&pow,H,powh,powm,powl,&G,&kh,&kl)) 
     return sign * pow;
 
+  SLOW_PATH(CRLIBM_SLOW_POW_EXACT);
   if (pow_exact_case(&pow,x,y,G,kh,kl,log2xh)) 
     return sign * pow;
 
@@ -1217,7 +1225,7 @@ double pow_rn(double x, double y) {
        We must still be aware of the fact that the final
        result may overflow 
     */
-    if(powh == (powh + (powm * RNROUNDCST))) {
+    if(QUICK_PHASE && powh == (powh + (powm * RNROUNDCST))) {
       powdb.d = powh;
       if (H < 1023) {
 	powdb.i[HI] += H << 20;
@@ -1257,7 +1265,7 @@ double pow_rn(double x, double y) {
     */
     if (H > -1023) {
       /* We have nevertheless normal rounding */
-      if(powh == (powh + (powm * RNROUNDCST))) {
+      if(QUICK_PHASE && powh == (powh + (powm * RNROUNDCST))) {
 	powdb.d = powh;
 	powdb.i[HI] += H << 20;
 	return sign * powdb.d;
@@ -1394,3 +1402,76 @@ double pow_rn(double x, double y) {
 
 }
 
+
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* There are no directed roundings of pow yet: the bounds are obtained
+   from the correct rounding to nearest, moved one ulp outwards unless
+   the result is known to be exact. pow_rn returns -5.0 when it cannot
+   decide the rounding; this is mapped to the widest bound. */
+static int pow_is_exact(double x, double y) {
+  return (x == 1.0) || (y == 0.0) || (y == 1.0) || (x == 0.0) || (x == 1.0/0.0);
+}
+
+static double pow_down(double x, double y) {
+  db_number r;
+
+  r.d = pow_rn(x, y);
+  if (r.d < 0.0) return 0.0;
+  if ((r.d > 0.0) && !pow_is_exact(x, y)) r.l--;
+  return r.d;
+}
+
+static double pow_up(double x, double y) {
+  db_number r;
+
+  r.d = pow_rn(x, y);
+  if (r.d < 0.0) return 1.0/0.0;
+  if ((r.d < 1.0/0.0) && !pow_is_exact(x, y)) r.l++;
+  return r.d;
+}
+
+
+/* x^y is monotonic in x for a given y and in y for a given x on 
+   [0, +Inf] x [-Inf, +Inf], so the extrema are reached on the corners 
+   of the box. The signs of y and of log(x) tell which corners. */
+interval j_pow(interval x, interval y)
+{
+  interval res;
+  double x_inf, x_sup, y_inf, y_sup, res_inf, res_sup, r1, r2;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+  y_inf=LOW(y);
+  y_sup=UP(y);
+
+  /* Intersect x with the domain [0, +Inf] */
+  if (!(x_inf<=x_sup) || !(y_inf<=y_sup) || (x_sup < 0.0)) RETURN_EMPTY_INTERVAL;
+  if (x_inf <= 0.0) x_inf = 0.0;  /* also gets rid of -0 */
+  if (x_sup <= 0.0) x_sup = 0.0;
+
+  if (x_inf >= 1.0) {
+    /* x^y increasing in y */
+    res_inf = pow_down((y_inf >= 0.0) ? x_inf : x_sup, y_inf);
+    res_sup = pow_up((y_sup >= 0.0) ? x_sup : x_inf, y_sup);
+  }
+  else if (x_sup <= 1.0) {
+    /* x^y decreasing in y */
+    res_inf = pow_down((y_sup >= 0.0) ? x_inf : x_sup, y_sup);
+    res_sup = pow_up((y_inf >= 0.0) ? x_sup : x_inf, y_inf);
+  }
+  else {
+    r1 = pow_down(x_inf, y_sup);
+    r2 = pow_down(x_sup, y_inf);
+    res_inf = (r1 < r2) ? r1 : r2;
+    r1 = pow_up(x_inf, y_inf);
+    r2 = pow_up(x_sup, y_sup);
+    res_sup = (r1 > r2) ? r1 : r2;
+  }
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
@@ -217,3 +217,32 @@ int rem_pio2_scs(scs_ptr result, const scs_ptr x){
 }
  
 
+
+
+/*
+ * The same for x + xl, where x and xl are two SCS numbers holding
+ * the two parts of a double-double (sin_dd_rn etc). rem_pio2_scs only
+ * reads the first three digits of x, so the sum x + xl cannot be
+ * given to it: the two parts are reduced separately, which leaves
+ * their sum in [-Pi/2, Pi/2], and this sum is brought back to
+ * [-Pi/4, Pi/4].
+ */
+int rem_pio2_scs_dd(scs_ptr result, const scs_ptr x, const scs_ptr xl){
+  scs_t rl;
+  double d;
+  int N;
+
+  N  = rem_pio2_scs(result, x);
+  N += rem_pio2_scs(rl, xl);
+  scs_add(result, result, rl);
+  scs_get_d(&d, result);
+  if (d > 0.78539816339744830962){
+    scs_sub(result, result, Pio2_ptr);
+    N++;
+  }
+  else if (d < -0.78539816339744830962){
+    scs_add(result, result, Pio2_ptr);
+    N--;
+  }
+  return N;
+}
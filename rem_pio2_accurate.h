@@ -1,7 +1,10 @@
 /*
- * 2oPi[] store in hexadecimal 48 digits, each keeping 30 bits of
+ * 2oPi[] store in hexadecimal 560 digits, each keeping 30 bits of
  * 2/pi. 
- * We then store 1440 bits of 2/pi. which is for sure a bit too much ...
+ * We then store 16800 bits of 2/pi: the double arguments use the
+ * first 48 digits (1440 bits, which is for sure a bit too much ...),
+ * the long double arguments of sinl and cosl (longdouble.c), up to
+ * 2^16384, need the others.
  */
  
 #include "crlibm.h"
@@ -20,7 +23,135 @@ static const int two_over_pi[]=
    0x1d49eeb1, 0x3ebe5f17, 0x2cf41ce7, 0x378a5292,
    0x3a9afed7, 0x3b11f8d5, 0x3421580c, 0x3046fc7b,
    0x1aeafc33, 0x3bc209af, 0x10d876a7, 0x2391615e,
-   0x3986c219, 0x199855f1, 0x1281a102, 0x0dffd880};
+   0x3986c219, 0x199855f1, 0x1281a102, 0x0dffd880,
+   0x135cc9cc, 0x10606155, 0x1b29cea3, 0x0960e27b,
+   0x30231ad1, 0x3c419c36, 0x1f3773a0, 0x092a8359,
+   0x311da2e5, 0x21ca6dda, 0x3d13455c, 0x19053ea5,
+   0x3fc1c14f, 0x37e33e83, 0x0b0b793e, 0x18327dbb,
+   0x30cf49bb, 0x36b1e5ef, 0x227ce87c, 0x35caf27f,
+   0x0761fc48, 0x1907c7c2, 0x11abe9bb, 0x15772d30,
+   0x10cec571, 0x214b59d1, 0x270f0b12, 0x2d414d2c,
+   0x17400311, 0x27d862d7, 0x078e6b1a, 0x1b006233,
+   0x1f34ad25, 0x3a7b4d55, 0x14dfd8fb, 0x171810a3,
+   0x3f1d934a, 0x29d64abd, 0x1dc3e1f1, 0x2357b07a,
+   0x39c545d5, 0x249c0d9d, 0x18ece212, 0x27cb2324,
+   0x1de2b588, 0x3545ab91, 0x3c006c2b, 0x31dfce19,
+   0x3fcc67da, 0x21e66615, 0x1e651fee, 0x2cd87f7e,
+   0x2dd948a2, 0x1e83260b, 0x3f9b3713, 0x2f09366c,
+   0x350fd775, 0x3de16de3, 0x2d624a6f, 0x1e2822d2,
+   0x3a218a13, 0x158e232c, 0x2b185b8c, 0x08cb7de0,
+   0x143005e9, 0x31df35be, 0x0060d04c, 0x2e621283,
+   0x005220d6, 0x38ef57fb, 0x02b7cba4, 0x1e434a48,
+   0x34d9c436, 0x0ddaa425, 0x3ebb3985, 0x2aa4280a,
+   0x2d2674fc, 0x2a6067f7, 0x1d720f0a, 0x23883c61,
+   0x1e1ce296, 0x28cafbdd, 0x1dbd8e98, 0x2dcbbff4,
+   0x3be06359, 0x3c12645c, 0x2954db67, 0x0ad2a828,
+   0x2358709d, 0x3c912142, 0x18126d18, 0x12c459c4,
+   0x11317224, 0x1b24df31, 0x1c02b50f, 0x14e54929,
+   0x04357f7f, 0x0be00cc9, 0x107bbb39, 0x30f53e13,
+   0x203c7b30, 0x3e7b328f, 0x231e5016, 0x133e71c1,
+   0x2cc24bbc, 0x3450b9c1, 0x0a21ec82, 0x2b9fb52e,
+   0x30a491cb, 0x3327b6d5, 0x1432429d, 0x321fe76b,
+   0x25b2cc52, 0x21679e27, 0x2506277f, 0x349794e8,
+   0x2139b8a5, 0x331996be, 0x3620d97d, 0x1f0efdbb,
+   0x2d26921b, 0x0a467427, 0x09c4c976, 0x0db8159f,
+   0x02796f09, 0x1318d397, 0x13dc7014, 0x30010c0d,
+   0x1a0212d6, 0x0ee2c90a, 0x291c0b9d, 0x3424d6bd,
+   0x299f7ddc, 0x2486eef1, 0x1a7e9a52, 0x0ef691b4,
+   0x1454f47c, 0x20acf339, 0x2081f92f, 0x356863b2,
+   0x17cfb740, 0x35d407f8, 0x2614a549, 0x15c06437,
+   0x04361b4c, 0x24832754, 0x316f51c5, 0x0e6e5445,
+   0x304242da, 0x1f52ad56, 0x1852741c, 0x2750045d,
+   0x36ceed31, 0x176ea17f, 0x261df5ad, 0x09ba271d,
+   0x0a5a65ab, 0x0ccc6541, 0x12b5ab8a, 0x1089d988,
+   0x141c8b2f, 0x2a404940, 0x1dddc0c3, 0x3327fc00,
+   0x2a1c7a92, 0x1c2663de, 0x01920f76, 0x17973fa3,
+   0x3f6510e3, 0x0860dde4, 0x04c674e6, 0x128c70dd,
+   0x39edc5ce, 0x3df082b3, 0x1c568201, 0x1c93805a,
+   0x24844436, 0x0e80faf8, 0x01b12fff, 0x1b0f9038,
+   0x1d861645, 0x1a562bbc, 0x2d86e627, 0x07bd4010,
+   0x013cb489, 0x37549f6b, 0x1baeec8b, 0x1baa140a,
+   0x0bc9a25d, 0x28364333, 0x2c246a50, 0x0eaa3a51,
+   0x30a8c76b, 0x2edaf122, 0x19713709, 0x2d9c7a2d,
+   0x25d5b020, 0x33f03f6f, 0x00263100, 0x2b99316d,
+   0x01ed0e45, 0x1200c5bc, 0x0f63124b, 0x354badc6,
+   0x297293b3, 0x137a736a, 0x279a524a, 0x2b6842dd,
+   0x3798c67b, 0x38c76528, 0x2da0df6f, 0x3caba1ae,
+   0x0c4577e8, 0x1ae00daf, 0x2c319935, 0x24b705ed,
+   0x0c194a6f, 0x356573af, 0x3d1ee7e5, 0x2af3be75,
+   0x37e4ca0c, 0x080abf68, 0x3198572c, 0x040622fa,
+   0x07793669, 0x0b33d8f1, 0x2d5c2734, 0x36e9424e,
+   0x292f84ed, 0x123331aa, 0x2bc2a195, 0x0fa5c1d2,
+   0x03cfc2f3, 0x1785b76f, 0x248c122d, 0x3b721789,
+   0x14e9b1b8, 0x26e6f00e, 0x2fbd612a, 0x1bb7dac4,
+   0x2e99aab3, 0x3cf761d0, 0x0b44b7c6, 0x31c1998c,
+   0x1deb70f6, 0x24886a05, 0x37dfd203, 0x062ff0ac,
+   0x26bb376f, 0x05c3f6dd, 0x3b407f1e, 0x10b6db2a,
+   0x0e8968e6, 0x2af00935, 0x0eb4115e, 0x36b42d29,
+   0x1fa012e9, 0x307da0ea, 0x29da8565, 0x3b2a1216,
+   0x0b6df73f, 0x1e5fafed, 0x2e27f6fa, 0x096c76e4,
+   0x3f2a419c, 0x0803e156, 0x3a17fe1f, 0x3d073e28,
+   0x0cd9d861, 0x2182aeab, 0x3536bf9e, 0x336e6d8f,
+   0x0e59e556, 0x3bf3148d, 0x1e105b7c, 0x30432dc7,
+   0x0d584973, 0x270c9b8c, 0x2cc3f5b2, 0x3fa200a4,
+   0x391b0168, 0x0dd5a476, 0x3c874849, 0x22845cb9,
+   0x12585c38, 0x0566b015, 0x0a64dd55, 0x10b7d51e,
+   0x313c4cd7, 0x36e13e43, 0x0176a4ba, 0x05c3b21d,
+   0x0d8ca869, 0x0b708d4b, 0x07a887dc, 0x16e4698f,
+   0x1dffc9e0, 0x0030c2d4, 0x02368335, 0x0f99a520,
+   0x34e8acc2, 0x25d2f42f, 0x26d32f68, 0x11d0be7d,
+   0x3076e6ef, 0x117ab81a, 0x0b2971a8, 0x0817552e,
+   0x154009fc, 0x0147f860, 0x1f85902c, 0x148d4196,
+   0x37afa1ca, 0x2fddab62, 0x15acd225, 0x3bfef305,
+   0x27afee53, 0x36a68a82, 0x29296b11, 0x0fbcf82d,
+   0x2616b5e5, 0x1c7f48d4, 0x343698e8, 0x205f57a4,
+   0x2c4fc525, 0x13880012, 0x03321b75, 0x31b6dec9,
+   0x3d582fc4, 0x1654d6b0, 0x1c06b2c2, 0x0cd0c0b2,
+   0x12155443, 0x2fb1ec37, 0x0a54ec1a, 0x233540c0,
+   0x1ef701b3, 0x045e0fa2, 0x253b232b, 0x1641f3e8,
+   0x37991f36, 0x0649b31b, 0x3b670e5e, 0x24d45877,
+   0x3178da44, 0x3daf03c3, 0x2ae91861, 0x065f7555,
+   0x3d6f74b1, 0x2926e5d2, 0x3ab3b510, 0x0e423e1c,
+   0x21f1187a, 0x1fd29f3d, 0x1b9f29f0, 0x2235916f,
+   0x31780223, 0x1d7ffe26, 0x29bb1bf6, 0x30c10893,
+   0x1d175f2c, 0x2ad6b9d6, 0x3b35edc8, 0x3e6a11c6,
+   0x2a73fdf7, 0x37329bac, 0x26d54402, 0x370db2e2,
+   0x092e9d18, 0x07de58ad, 0x21d0b054, 0x0d0c1881,
+   0x25199f85, 0x22901767, 0x2a7efbf7, 0x3def4556,
+   0x0d9fb644, 0x3d9ecb9b, 0x2a2ff25f, 0x0427a831,
+   0x30dbbc4d, 0x2c59456a, 0x2362d6a2, 0x340ecccf,
+   0x0b62448d, 0x0576f895, 0x18b38f3a, 0x19b920d6,
+   0x2a979ae7, 0x02a3ecc5, 0x3c45282f, 0x3dfbf4e1,
+   0x1b4ee38b, 0x086e284d, 0x13a6a6d3, 0x3cd1eeef,
+   0x324d4b98, 0x1392f442, 0x04e32364, 0x1b0afc81,
+   0x1a92bef6, 0x01c2f84b, 0x114e3265, 0x0ecc2254,
+   0x37154ab5, 0x2c6c0961, 0x242ee1c0, 0x1a649569,
+   0x181689bb, 0x2523f0f1, 0x05fc46d7, 0x34f5cbfc,
+   0x0b6f0d3b, 0x2bc34cc5, 0x37a1817b, 0x1d9b8e67,
+   0x3bcce4ae, 0x017c99b5, 0x2186f15f, 0x21c68351,
+   0x040fb612, 0x071dddd1, 0x30b68462, 0x2f462c21,
+   0x35fcd666, 0x07ad9c05, 0x127bea19, 0x0ffc0656,
+   0x2b9e794d, 0x2228922a, 0x34e3724d, 0x27aae855,
+   0x0e09a0a6, 0x3e7caa40, 0x3546c4ce, 0x190ed7a9,
+   0x12015a7c, 0x0b265a78, 0x21fe5d32, 0x0836d1f9,
+   0x2ce48852, 0x2827b21c, 0x3e63727d, 0x005547dc,
+   0x0e9d3850, 0x2eb67df9, 0x37f97f51, 0x1ea4677b,
+   0x1eab2ea8, 0x2f655238, 0x20ad56e9, 0x01086e59,
+   0x218a8860, 0x34739e6e, 0x0e27527b, 0x2540fb49,
+   0x3a55bff2, 0x20f1c8a5, 0x2714afea, 0x14c5c1d3,
+   0x33f143eb, 0x25adb86c, 0x151d890e, 0x053b8621,
+   0x251e4b21, 0x361107b4, 0x30a868b2, 0x0012bf43,
+   0x2409a222, 0x13c78e4c, 0x12a1ef6f, 0x25c23ac4,
+   0x3abd09a2, 0x267f7bf9, 0x0834ae8d, 0x25b1933d,
+   0x02df2f77, 0x051a463d, 0x349f7785, 0x2919949a,
+   0x254a6a0a, 0x0ce68b4e, 0x3424827d, 0x04ca984e,
+   0x18e09c08, 0x37c7e32b, 0x243e3bd6, 0x27e75614,
+   0x023c484a, 0x29db54d7, 0x39bd4466, 0x25abf9b5,
+   0x35b7e098, 0x1dd96023, 0x185a7ceb, 0x04a1a283,
+   0x1b7b5c9e, 0x28d39a9b, 0x220970c9, 0x2b5b2746,
+   0x3b4d001d, 0x300d255f, 0x13f13564, 0x018071e0,
+   0x384fe26c, 0x295f364a, 0x23c6ba9d, 0x0b38fc4c,
+   0x3aacaed1, 0x3270babc, 0x0e9cd2e9, 0x2052dd34};
 
 
 
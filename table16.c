@@ -0,0 +1,168 @@
+/*
+ * Tabulated functions on 16-bit formats
+ *
+ * The results of exp, log, tanh and sigmoid for all the fp16 and
+ * bfloat16 inputs are computed once by table16_gen.c, at build time,
+ * and installed as a file. This file is mapped in memory, so that
+ * opening it costs nothing, and each evaluation is a table lookup
+ * (eight lookups per AVX2 gather in the batch version).
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "table16.h"
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#ifdef BUILD_VECTOR_ABI
+#include <immintrin.h>
+#endif
+
+#ifndef CRLIBM16_TABLES_DIR
+#define CRLIBM16_TABLES_DIR "."
+#endif
+
+static const unsigned short *table16 = NULL;
+
+/* The whole file in memory, mapped if possible */
+static void *table16_load(int fd) {
+  void *p;
+#ifdef HAVE_SYS_MMAN_H
+  p = mmap(NULL, TABLE16_FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED)
+    return NULL;
+#else
+  size_t done = 0;
+  ssize_t r;
+
+  p = malloc(TABLE16_FILE_SIZE);
+  if(p == NULL)
+    return NULL;
+  while(done < TABLE16_FILE_SIZE) {
+    r = read(fd, (char *) p + done, TABLE16_FILE_SIZE - done);
+    if(r <= 0) {
+      free(p);
+      return NULL;
+    }
+    done += r;
+  }
+#endif
+  return p;
+}
+
+static void table16_unload(void *p) {
+#ifdef HAVE_SYS_MMAN_H
+  munmap(p, TABLE16_FILE_SIZE);
+#else
+  free(p);
+#endif
+}
+
+int crlibm16_init(const char *path) {
+  unsigned int header[3];
+  struct stat st;
+  void *p;
+  int fd;
+
+  if(table16 != NULL)
+    return 0;
+  if(path == NULL)
+    path = getenv("CRLIBM16_TABLES");
+  if(path == NULL)
+    path = CRLIBM16_TABLES_DIR "/crlibm16.tab";
+
+  fd = open(path, O_RDONLY);
+  if(fd < 0)
+    return -1;
+  if(fstat(fd, &st) != 0 || st.st_size != TABLE16_FILE_SIZE) {
+    close(fd);
+    return -1;
+  }
+  p = table16_load(fd);
+  close(fd);
+  if(p == NULL)
+    return -1;
+
+  memcpy(header, (char *) p + 8, sizeof(header));
+  if(memcmp(p, TABLE16_MAGIC, 8) != 0
+     || header[0] != TABLE16_VERSION
+     || header[1] != TABLE16_BYTE_ORDER
+     || header[2] != TABLE16_NB_FUNCTIONS*TABLE16_NB_FORMATS*TABLE16_NB_MODES) {
+    table16_unload(p);
+    return -1;
+  }
+  table16 = p;
+  return 0;
+}
+
+const unsigned short *crlibm16_table(int function, int format, int mode) {
+  if(table16 == NULL
+     || function < 0 || function >= TABLE16_NB_FUNCTIONS
+     || format < 0 || format >= TABLE16_NB_FORMATS
+     || mode < 0 || mode >= TABLE16_NB_MODES)
+    return NULL;
+  return table16 + TABLE16_OFFSET(function, format, mode);
+}
+
+
+#ifdef BUILD_VECTOR_ABI
+/* Each gather reads the 32 bits at table + 2*x, of which the low half
+   is the entry (x86 is little-endian). The last entry of the last
+   table is followed by the padding of the file. */
+__attribute__ ((target ("avx2")))
+static void crlibm16_batch_avx2(unsigned short *res, const unsigned short *x,
+                                int n, const unsigned short *table) {
+  __m256i index, r;
+  int i;
+
+  for(i=0; i+8 <= n; i+=8) {
+    index = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) (x+i)));
+    r = _mm256_i32gather_epi32((const int *) table, index, 2);
+    r = _mm256_and_si256(r, _mm256_set1_epi32(0xffff));
+    r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+    _mm_storeu_si128((__m128i *) (res+i), _mm256_castsi256_si128(r));
+  }
+  for(; i<n; i++)
+    res[i] = table[x[i]];
+}
+#endif
+
+void crlibm16_batch(unsigned short *res, const unsigned short *x, int n,
+                    const unsigned short *table) {
+  int i;
+#ifdef BUILD_VECTOR_ABI
+  if(__builtin_cpu_supports("avx2")) {
+    crlibm16_batch_avx2(res, x, n, table);
+    return;
+  }
+#endif
+  for(i=0; i<n; i++)
+    res[i] = table[x[i]];
+}
@@ -0,0 +1,56 @@
+/*
+ * Layout of the file holding the tabulated 16-bit functions
+ *
+ * The file is written by table16_gen.c and mapped by table16.c. It
+ * holds, after a header, one table of 65536 results per function,
+ * format and rounding mode, indexed by the bits of the input. The
+ * tables are stored in the byte order of the machine that built them.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef TABLE16_H
+#define TABLE16_H
+
+#define TABLE16_MAGIC        "crlibm16"
+#define TABLE16_VERSION      1
+#define TABLE16_BYTE_ORDER   0x01020304
+
+#define TABLE16_NB_FUNCTIONS 4
+#define TABLE16_NB_FORMATS   2
+#define TABLE16_NB_MODES     4
+#define TABLE16_SIZE         65536
+
+/* Header: the 8 magic characters, then the version, the byte order
+   mark and the number of tables as unsigned ints, zero padded */
+#define TABLE16_HEADER_SIZE  32
+
+/* Offset in unsigned shorts of a table from the start of the file */
+#define TABLE16_OFFSET(function, format, mode)                          \
+  (TABLE16_HEADER_SIZE/2                                                \
+   + (((function)*TABLE16_NB_FORMATS + (format))*TABLE16_NB_MODES + (mode)) \
+   * TABLE16_SIZE)
+
+/* The gathers read 32 bits at each entry, hence a few bytes of
+   padding after the last table */
+#define TABLE16_PADDING      16
+
+#define TABLE16_FILE_SIZE                                               \
+  (2*TABLE16_OFFSET(TABLE16_NB_FUNCTIONS, 0, 0) + TABLE16_PADDING)
+
+#endif /* TABLE16_H */
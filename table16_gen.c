@@ -0,0 +1,324 @@
+/*
+ * Generation of the tables of the 16-bit functions
+ *
+ * For each of the 65536 inputs of the IEEE binary16 (fp16) and
+ * bfloat16 (bf16) formats, this program computes exp, log, tanh and
+ * sigmoid = 1/(1+exp(-x)) correctly rounded to the same format in the
+ * four rounding modes, and writes them in the file given on the
+ * command line with the layout of table16.h.
+ *
+ * Each value is first enclosed in an interval [lo, hi] of doubles
+ * built from the directed roundings of crlibm (exp_rd/exp_ru etc).
+ * The value being transcendental (apart from a few exact cases
+ * handled separately), it lies strictly inside the interval, and the
+ * rounding is decided if no rounding boundary of the 16-bit format
+ * (representable number or midpoint) lies strictly inside it. With
+ * intervals some 2^-50 wide this always happens; if it did not, the
+ * program would fail rather than write a wrong table.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "table16.h"
+
+/* Precision, minimal and maximal exponent of a 16-bit format, in the
+   order of CRLIBM_FP16 and CRLIBM_BF16 */
+typedef struct {
+  const char *name;
+  int p, emin, emax;
+} format16;
+
+static const format16 formats[TABLE16_NB_FORMATS] = {
+  {"fp16", 11,   -14,  15},
+  {"bf16",  8,  -126, 127}
+};
+
+/* The value of the bits x in the format f */
+static double decode(unsigned int x, const format16 *f) {
+  int w = 16 - f->p, bias = (1 << (w-1)) - 1;
+  int e = (x >> (f->p-1)) & ((1 << w) - 1);
+  unsigned int m = x & ((1u << (f->p-1)) - 1);
+  double r;
+
+  if(e == (1 << w) - 1)
+    r = m ? NAN : INFINITY;
+  else if(e == 0)
+    r = ldexp(m, f->emin - f->p + 1);
+  else
+    r = ldexp(m + (1u << (f->p-1)), e - bias - f->p + 1);
+  return (x & 0x8000) ? -r : r;
+}
+
+/* The bits of v, which must be representable in the format f (or be
+   an infinity or a NaN) */
+static unsigned int encode(double v, const format16 *f) {
+  int w = 16 - f->p, bias = (1 << (w-1)) - 1;
+  unsigned int s = signbit(v) ? 0x8000 : 0;
+  int e;
+
+  if(v != v)                    /* the quiet NaN */
+    return (((1u << w) - 1) << (f->p-1)) | (1u << (f->p-2));
+  v = fabs(v);
+  if(v > DBL_MAX)
+    return s | (((1u << w) - 1) << (f->p-1));
+  if(v < ldexp(1, f->emin))
+    return s | (unsigned int) ldexp(v, f->p - 1 - f->emin);
+  e = ilogb(v);
+  return s | ((unsigned int)(e + bias) << (f->p-1))
+    | ((unsigned int) ldexp(v, f->p - 1 - e) - (1u << (f->p-1)));
+}
+
+/* v rounded in the given mode to p bits, with exponents from emin
+   (subnormals below) to emax (overflow above) */
+static double round_format(double v, int p, int emin, int emax, int mode) {
+  double a = fabs(v), r, max;
+  int e, away;
+
+  if(a == 0 || a != a || a > DBL_MAX)
+    return v;
+  e = ilogb(a);
+  if(e < emin)
+    e = emin;
+  r = ldexp(a, p - 1 - e);
+  away = (mode == CRLIBM_RU && v > 0) || (mode == CRLIBM_RD && v < 0);
+  if(mode == CRLIBM_RN)
+    r = rint(r);
+  else if(away)
+    r = ceil(r);
+  else
+    r = floor(r);
+  r = ldexp(r, e - p + 1);
+  max = ldexp(2 - ldexp(1, 1 - p), emax);
+  if(r > max)
+    r = (mode == CRLIBM_RN || away) ? INFINITY : max;
+  return copysign(r, v);
+}
+
+/* The representable numbers and the midpoints of a format are the
+   numbers of one more bit, without overflow */
+static double round_boundary(double v, const format16 *f, int mode) {
+  return round_format(v, f->p + 1, f->emin, 100000, mode);
+}
+
+/* Rounds to the format f, in the four modes, a value known to lie
+   strictly between lo and hi. Returns 0 if the rounding cannot be
+   decided. */
+static int decide(double lo, double hi, const format16 *f, double res[4]) {
+  double big = ldexp(1, f->emax + 1), b1, b2, m;
+  int mode;
+
+  if(lo >= big)                 /* overflows in all modes */
+    m = lo;
+  else if(hi <= -big)
+    m = hi;
+  else {
+    /* b1 <= lo and b2 >= hi are consecutive boundaries, m is strictly
+       between them, hence rounds like the value */
+    b2 = round_boundary(nextafter(lo, INFINITY), f, CRLIBM_RU);
+    if(b2 < hi)
+      return 0;
+    b1 = round_boundary(lo, f, CRLIBM_RD);
+    m = b1/2 + b2/2;
+  }
+  for(mode = 0; mode < 4; mode++)
+    res[mode] = round_format(m, f->p, f->emin, f->emax, mode);
+  return 1;
+}
+
+/* Moves x by k ulps toward -inf or +inf, to absorb the rounding errors
+   of a few double operations */
+static double down(double x, int k) {
+  while(k--)
+    x = nextafter(x, -INFINITY);
+  return x;
+}
+
+static double up(double x, int k) {
+  while(k--)
+    x = nextafter(x, INFINITY);
+  return x;
+}
+
+/* The enclosures: each function either returns 1 with the exact
+   result in *lo, or returns 0 with lo <= f(x) <= hi, f(x) being no
+   double */
+
+static int enclose_exp(double x, double *lo, double *hi) {
+  if(x != x || x == 0 || x > DBL_MAX || x < -DBL_MAX) {
+    *lo = exp_rn(x);
+    return 1;
+  }
+  *lo = exp_rd(x);
+  *hi = exp_ru(x);
+  return 0;
+}
+
+static int enclose_log(double x, double *lo, double *hi) {
+  if(x != x || x <= 0 || x == 1 || x > DBL_MAX) {
+    *lo = log_rn(x);
+    return 1;
+  }
+  *lo = log_rd(x);
+  *hi = log_ru(x);
+  return 0;
+}
+
+static int enclose_tanh(double x, double *lo, double *hi) {
+  double c, t;
+
+  if(x != x || x == 0) {
+    *lo = x;
+    return 1;
+  }
+  if(x > DBL_MAX || x < -DBL_MAX) {
+    *lo = (x > 0) ? 1 : -1;
+    return 1;
+  }
+  if(x < 0) {
+    enclose_tanh(-x, hi, lo);
+    *lo = -*lo;
+    *hi = -*hi;
+    return 0;
+  }
+  if(x < 0x1p-8) {
+    /* x - x^3/3 < tanh(x) < x - x^3/3 + 2x^5/15 < x */
+    c = x*x*x/3;
+    *lo = down(x - c, 2);
+    *hi = up(x - c + c*(0.4*x*x), 2);
+    if(*hi > x)
+      *hi = x;
+  }
+  else {
+    /* tanh(x) = -t/(2+t) with t = expm1(-2x), decreasing in t */
+    t = expm1_ru(-2*x);
+    *lo = down(-t/(2+t), 4);
+    t = expm1_rd(-2*x);
+    *hi = up(-t/(2+t), 4);
+    if(*hi > 1)
+      *hi = 1;
+  }
+  return 0;
+}
+
+static int enclose_sigmoid(double x, double *lo, double *hi) {
+  double e, slo, shi;
+
+  if(x != x) {
+    *lo = x;
+    return 1;
+  }
+  if(x == 0 || x > DBL_MAX || x < -DBL_MAX) {
+    *lo = (x == 0) ? 0.5 : (x > 0);
+    return 1;
+  }
+  if(x > 0) {
+    /* 1 - s with s = 1/(1+exp(x)) */
+    e = exp_ru(x);
+    slo = down(1/(1+e), 4);
+    e = exp_rd(x);
+    shi = up(1/(1+e), 4);
+    *lo = down(1 - shi, 2);
+    *hi = up(1 - slo, 2);
+    if(*hi > 1)
+      *hi = 1;
+    if(*lo < 0.5)
+      *lo = 0.5;
+  }
+  else {
+    /* e/(1+e) with e = exp(x), increasing in e */
+    e = exp_rd(x);
+    *lo = down(e/(1+e), 4);
+    e = exp_ru(x);
+    *hi = up(e/(1+e), 4);
+    if(*lo < 0)
+      *lo = 0;
+    if(*hi > 0.5)
+      *hi = 0.5;
+  }
+  return 0;
+}
+
+/* In the order of CRLIBM16_EXP, CRLIBM16_LOG, CRLIBM16_TANH,
+   CRLIBM16_SIGMOID */
+static const struct {
+  const char *name;
+  int (*enclose)(double x, double *lo, double *hi);
+} functions[TABLE16_NB_FUNCTIONS] = {
+  {"exp", enclose_exp},
+  {"log", enclose_log},
+  {"tanh", enclose_tanh},
+  {"sigmoid", enclose_sigmoid}
+};
+
+int main(int argc, char *argv[]) {
+  unsigned short *t;
+  unsigned int header[3], x;
+  double v, lo, hi, res[4];
+  int fn, fmt, mode;
+  FILE *out;
+
+  if(argc != 2) {
+    fprintf(stderr, "Usage: %s file\n", argv[0]);
+    return 1;
+  }
+  crlibm_init();
+
+  t = calloc(TABLE16_FILE_SIZE, 1);
+  if(t == NULL) {
+    fprintf(stderr, "%s: out of memory\n", argv[0]);
+    return 1;
+  }
+  memcpy(t, TABLE16_MAGIC, 8);
+  header[0] = TABLE16_VERSION;
+  header[1] = TABLE16_BYTE_ORDER;
+  header[2] = TABLE16_NB_FUNCTIONS*TABLE16_NB_FORMATS*TABLE16_NB_MODES;
+  memcpy((char *) t + 8, header, sizeof(header));
+
+  for(fn = 0; fn < TABLE16_NB_FUNCTIONS; fn++)
+    for(fmt = 0; fmt < TABLE16_NB_FORMATS; fmt++)
+      for(x = 0; x < TABLE16_SIZE; x++) {
+        v = decode(x, &formats[fmt]);
+        if(functions[fn].enclose(v, &lo, &hi)) {
+          for(mode = 0; mode < 4; mode++)
+            res[mode] = lo;
+        }
+        else if(!decide(lo, hi, &formats[fmt], res)) {
+          fprintf(stderr, "%s: cannot round %s(%a) to %s\n",
+                  argv[0], functions[fn].name, v, formats[fmt].name);
+          return 1;
+        }
+        for(mode = 0; mode < 4; mode++)
+          t[TABLE16_OFFSET(fn, fmt, mode) + x] = encode(res[mode], &formats[fmt]);
+      }
+
+  out = fopen(argv[1], "wb");
+  if(out == NULL || fwrite(t, 1, TABLE16_FILE_SIZE, out) != TABLE16_FILE_SIZE
+     || fclose(out) != 0) {
+    fprintf(stderr, "%s: cannot write %s\n", argv[0], argv[1]);
+    return 1;
+  }
+  free(t);
+  return 0;
+}
@@ -0,0 +1,255 @@
+/*
+ * Cost of the quick and accurate phases of the double functions
+ *
+ * For each function and rounding mode, on the arguments of test_perf
+ * (the rand_for_* generators of test_common.c), the following are
+ * measured, as medians over blocks of BLOCK independent calls, in
+ * ticks per call:
+ *
+ * - quick: the normal calls, almost all of which return after the
+ *   quick phase,
+ * - accurate: the calls forced to the accurate phase by the hook of
+ *   crlibm_private.h (see QUICK_PHASE), minus the quick time,
+ * - scs_rr: for sin, cos and tan, the calls forced to the SCS argument
+ *   reduction, minus the quick time,
+ *
+ * together with the measured probability of the second step, that is
+ * the percentage of normal calls counted by crlibm_second_step_taken.
+ * The mean cost of a call is then about quick + probability*accurate.
+ * The forced results are also compared to the normal ones, which are
+ * both correctly rounded: the exit status tells whether one differs.
+ *
+ * Some functions have no quick phase for most arguments (sinpi, cospi
+ * and tanpi in the directed modes): their accurate time is about 0.
+ *
+ * The hook only exists when crlibm is configured with
+ * --enable-accurate-hook; otherwise only the quick time is given. The
+ * probability needs EVAL_PERF, and is only given for the functions
+ * whose second step updates the counter.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+
+#include "scs_lib/tests/tbx_timing.h"
+
+#define DEFAULT_SAMPLES 4096
+#define BLOCK 64
+
+static const char *function_names[] = {
+  "exp", "log", "log2", "log10", "expm1", "log1p",
+  "sin", "cos", "tan", "atan", "atanpi",
+  "sinh", "cosh", "asin", "acos", "asinpi", "acospi",
+  "sinpi", "cospi", "tanpi", "pow"
+};
+#define NB_FUNCTIONS (sizeof(function_names)/sizeof(function_names[0]))
+
+static const char *mode_names[] = {"RN", "RU", "RD", "RZ"};
+
+/* The time of two consecutive time stamps */
+static unsigned long long tbx_time;
+
+static int nbarg;
+static double *x, *y, *ticks, *res0, *res1;
+static int failures;
+
+
+static void usage(const char *name) {
+  bench_usage(name, "", 1, "arguments", DEFAULT_SAMPLES);
+  exit(EXIT_FAILURE);
+}
+
+/* The median time per call of blocks of BLOCK independent calls,
+   after a warm-up pass which keeps the results in res */
+static double median_time(double (*f)(), int n, double *res) {
+  tbx_tick_t t1, t2;
+  unsigned long long dt;
+  volatile double sink;
+  int i, k, nblocks = n/BLOCK;
+
+  for(i = 0; i < n; i++)
+    res[i] = call_testfun(f, nbarg, x, y, i);
+
+  for(k = 0; k < nblocks; k++) {
+    TBX_GET_TICK(t1);
+    for(i = k*BLOCK; i < (k+1)*BLOCK; i++)
+      sink = call_testfun(f, nbarg, x, y, i);
+    TBX_GET_TICK(t2);
+    dt = TBX_TICK_RAW_DIFF(t1, t2);
+    ticks[k] = net_ticks(dt, tbx_time)/BLOCK;
+  }
+  (void) sink;
+  return median_sort(ticks, nblocks);
+}
+
+/* Percentage of the n calls which took the second step, or -1 if f
+   does not count them */
+static double second_steps(double (*f)(), int n) {
+#if EVAL_PERF==1
+  volatile double sink;
+  int i;
+
+  crlibm_second_step_taken = 0;
+  for(i = 0; i < n; i++)
+    sink = call_testfun(f, nbarg, x, y, i);
+  (void) sink;
+  if(crlibm_second_step_taken > 0)
+    return 100.0*crlibm_second_step_taken/n;
+#ifdef BUILD_ACCURATE_HOOK
+  /* none counted: tell an uninstrumented function from a lucky one */
+  crlibm_force_accurate = 1;
+  for(i = 0; i < n; i++)
+    sink = call_testfun(f, nbarg, x, y, i);
+  crlibm_force_accurate = 0;
+  if(crlibm_second_step_taken > 0)
+    return 0;
+#endif
+#endif
+  (void) f; (void) n;
+  return -1;
+}
+
+#ifdef BUILD_ACCURATE_HOOK
+/* Number of the n forced results which differ from the normal ones */
+static int differences(const char *name, int n) {
+  db_number a, b;
+  int i, d = 0;
+
+  for(i = 0; i < n; i++) {
+    a.d = res0[i];
+    b.d = res1[i];
+    if(a.l != b.l && !(res0[i] != res0[i] && res1[i] != res1[i])) {
+      if(d == 0)
+        printf("%s: forced %a differs from %a for x=%a\n", name, res1[i], res0[i], x[i]);
+      d++;
+    }
+  }
+  return d;
+}
+
+/* The median time per call with the given value of the hook, minus
+   the quick time, also counting the results which differ from the
+   normal ones */
+static double forced_time(double (*f)(), int n, int force, double quick, const char *name) {
+  double t;
+
+  crlibm_force_accurate = force;
+  t = median_time(f, n, res1);
+  crlibm_force_accurate = 0;
+  failures += differences(name, n);
+  return (t > quick) ? t - quick : 0;
+}
+#endif
+
+static void print_value(double v) {
+  if(v < 0)
+    printf(" %10s", "n/a");
+  else
+    printf(" %10.1f", v);
+}
+
+int main(int argc, char *argv[]) {
+  double (*randfun_perf)(), (*randfun_soaktest)();
+  double (*testfun_crlibm)(), (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  int (*testfun_mpfr)();
+  const char *only_function = NULL, *only_mode = NULL;
+  double worstcase, quick, accurate, scs_rr, p;
+  unsigned int fn;
+  int n = DEFAULT_SAMPLES, i, mode, found = 0;
+  char name[32];
+
+  for(i = 1; i < argc; i++) {
+    if(bench_option(argc, argv, &i, &only_function, &only_mode, &n) != 0)
+      usage(argv[0]);
+  }
+  if(n < BLOCK)
+    usage(argv[0]);
+
+  x = malloc(n*sizeof(double));
+  y = malloc(n*sizeof(double));
+  ticks = malloc(n*sizeof(double));
+  res0 = malloc(n*sizeof(double));
+  res1 = malloc(n*sizeof(double));
+  if(x == NULL || y == NULL || ticks == NULL || res0 == NULL || res1 == NULL)
+    return EXIT_FAILURE;
+
+  crlibm_init();
+
+  tbx_time = timestamp_overhead();
+
+#ifndef BUILD_ACCURATE_HOOK
+  printf("crlibm was configured without --enable-accurate-hook: the accurate phase cannot be forced\n");
+#endif
+  printf("%-12s %10s %10s %10s %10s\n", "function", "quick", "accurate", "scs_rr", "2nd step %");
+
+  for(fn = 0; fn < NB_FUNCTIONS; fn++) {
+    if(only_function != NULL && strcmp(only_function, function_names[fn]) != 0)
+      continue;
+    nbarg = (strcmp(function_names[fn], "pow") == 0) ? 2 : 1;
+    for(mode = 0; mode < 4; mode++) {
+      if(only_mode != NULL && strcmp(only_mode, mode_names[mode]) != 0)
+        continue;
+      testfun_crlibm = NULL;
+      test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+                &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+                (char *) function_names[fn], (char *) mode_names[mode]);
+      if(testfun_crlibm == NULL)
+        continue;
+      found++;
+      draw_arguments(randfun_perf, nbarg, x, y, n);
+      entry_name(name, function_names[fn], mode_names[mode]);
+
+      quick = median_time(testfun_crlibm, n, res0);
+      accurate = scs_rr = -1;
+#ifdef BUILD_ACCURATE_HOOK
+      accurate = forced_time(testfun_crlibm, n, 1, quick, name);
+      if(strcmp(function_names[fn], "sin") == 0 || strcmp(function_names[fn], "cos") == 0
+         || strcmp(function_names[fn], "tan") == 0)
+        scs_rr = forced_time(testfun_crlibm, n, 2, quick, name);
+#endif
+      p = second_steps(testfun_crlibm, n);
+
+      printf("%-12s", name);
+      print_value(quick);
+      print_value(accurate);
+      print_value(scs_rr);
+      if(p < 0)
+        printf(" %10s\n", "n/a");
+      else
+        printf(" %10.3f\n", p);
+    }
+  }
+  if(found == 0)
+    usage(argv[0]);
+  if(failures != 0)
+    printf("%d forced results differ from the normal ones\n", failures);
+
+  free(x);
+  free(y);
+  free(ticks);
+  free(res0);
+  free(res1);
+  return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,358 @@
+/*
+ * Benchmark of the double functions of crlibm
+ *
+ * For each function, rounding mode and input distribution (the
+ * rand_for_* generators of test_common.c used by test_perf, then those
+ * of soak_test), the following are measured, in ticks per call:
+ *
+ * - call: one call between two time stamps, the time of the time
+ *   stamps removed; the upper percentiles show the slow paths,
+ * - throughput: blocks of BLOCK independent calls,
+ * - latency: blocks of BLOCK calls where each argument depends on the
+ *   previous result, so that the calls cannot overlap,
+ * - cold: blocks of COLD_BLOCK calls after the caches have been
+ *   flushed, as the TEST_CACHE mode of test_perf did.
+ *
+ * Each is reported as percentiles (50, 90 and 99) over the calls or
+ * the blocks, as JSON, one entry point and distribution per line.
+ * Given a baseline written by an earlier run, the medians of throughput
+ * and latency, the steadiest measures, are compared against it, and
+ * the exit status tells whether one of them grew by more than the
+ * tolerance.
+ *
+ * Unlike test_perf, this file is built with optimizations.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+
+#include "scs_lib/tests/tbx_timing.h"
+
+#define DEFAULT_SAMPLES 4096
+#define DEFAULT_TOLERANCE 10.0  /* percent */
+#define BLOCK 64
+#define COLD_BLOCK 16
+#define COLD_BLOCKS 32
+#define FLUSH_SIZE (16*1024*1024) /* bytes, more than the last level cache */
+#define MAX_LINE 1024
+
+static const char *function_names[] = {
+  "exp", "log", "log2", "log10", "expm1", "log1p",
+  "sin", "cos", "tan", "atan", "atanpi",
+  "sinh", "cosh", "asin", "acos", "asinpi", "acospi",
+  "sinpi", "cospi", "tanpi", "pow"
+};
+#define NB_FUNCTIONS (sizeof(function_names)/sizeof(function_names[0]))
+
+static const char *mode_names[] = {"RN", "RU", "RD", "RZ"};
+static const char *distribution_names[] = {"perf", "soak"};
+
+enum {CALL, THROUGHPUT, LATENCY, COLD, NB_MEASURES};
+static const char *measure_names[] = {"call", "throughput", "latency", "cold"};
+
+typedef struct {
+  char name[32];                  /* entry point, exp_rn etc */
+  char distribution[8];
+  double p[NB_MEASURES][3];       /* percentiles 50, 90, 99 */
+  double second_steps;            /* percentage, or -1 if unknown */
+} result_t;
+
+/* The time of two consecutive time stamps */
+static unsigned long long tbx_time;
+
+/* Equal to 0, but unknown to the compiler: makes each argument of a
+   latency block depend on the previous result */
+static volatile unsigned long long dependency_mask = 0;
+
+static char flush_buffer[FLUSH_SIZE];
+
+static int nbarg;
+static double *x, *y, *ticks;
+
+
+static void usage(const char *name) {
+  bench_usage(name, " [-o file] [-c baseline] [-t tolerance]", 1,
+              "arguments per distribution", DEFAULT_SAMPLES);
+  fprintf(stderr, " -o file     : write the JSON results there (default: standard output)\n");
+  fprintf(stderr, " -c baseline : compare throughput and latency against this earlier output\n");
+  fprintf(stderr, " -t percent  : growth tolerated by -c (default %g)\n", DEFAULT_TOLERANCE);
+  exit(EXIT_FAILURE);
+}
+
+/* The percentiles 50, 90 and 99 of the n values of t, sorted in place */
+static void percentiles(double p[3], double *t, int n) {
+  qsort(t, n, sizeof(double), compare_doubles);
+  p[0] = t[(n - 1)/2];
+  p[1] = t[(int) ((n - 1)*0.9)];
+  p[2] = t[(int) ((n - 1)*0.99)];
+}
+
+/* The ticks between t1 and t2, without the time stamps themselves */
+static double elapsed(tbx_tick_t t1, tbx_tick_t t2) {
+  return net_ticks(TBX_TICK_RAW_DIFF(t1, t2), tbx_time);
+}
+
+static void flush_caches(void) {
+  int i;
+
+  for(i = 0; i < FLUSH_SIZE; i += 64)
+    flush_buffer[i]++;
+}
+
+static void measure(result_t *r, double (*f)(), int n) {
+  tbx_tick_t t1, t2;
+  volatile double sink;
+  db_number a, b;
+  double res;
+  int i, j, k, nblocks;
+
+  /* warm up the caches and the branch predictors */
+  for(i = 0; i < n; i++)
+    sink = call_testfun(f, nbarg, x, y, i);
+
+  /* one call at a time */
+  for(i = 0; i < n; i++) {
+    TBX_GET_TICK(t1);
+    sink = call_testfun(f, nbarg, x, y, i);
+    TBX_GET_TICK(t2);
+    ticks[i] = elapsed(t1, t2);
+  }
+  percentiles(r->p[CALL], ticks, n);
+
+  /* independent calls */
+  nblocks = n/BLOCK;
+  for(k = 0; k < nblocks; k++) {
+    TBX_GET_TICK(t1);
+    for(j = k*BLOCK; j < (k+1)*BLOCK; j++)
+      sink = call_testfun(f, nbarg, x, y, j);
+    TBX_GET_TICK(t2);
+    ticks[k] = elapsed(t1, t2)/BLOCK;
+  }
+  percentiles(r->p[THROUGHPUT], ticks, nblocks);
+
+  /* dependent calls */
+  for(k = 0; k < nblocks; k++) {
+    res = 0;
+    TBX_GET_TICK(t1);
+    for(j = k*BLOCK; j < (k+1)*BLOCK; j++) {
+      a.d = res;
+      b.d = x[j];
+      b.l ^= a.l & dependency_mask;
+      res = (nbarg == 1) ? f(b.d) : f(b.d, y[j]);
+    }
+    TBX_GET_TICK(t2);
+    sink = res;
+    ticks[k] = elapsed(t1, t2)/BLOCK;
+  }
+  percentiles(r->p[LATENCY], ticks, nblocks);
+
+  /* cold caches */
+  for(k = 0; k < COLD_BLOCKS; k++) {
+    j = (k*COLD_BLOCK) % (n - COLD_BLOCK + 1);
+    flush_caches();
+    TBX_GET_TICK(t1);
+    for(i = j; i < j + COLD_BLOCK; i++)
+      sink = call_testfun(f, nbarg, x, y, i);
+    TBX_GET_TICK(t2);
+    ticks[k] = elapsed(t1, t2)/COLD_BLOCK;
+  }
+  percentiles(r->p[COLD], ticks, COLD_BLOCKS);
+  (void) sink;
+
+  r->second_steps = -1;
+#if EVAL_PERF==1
+  crlibm_second_step_taken = 0;
+  for(i = 0; i < n; i++)
+    sink = call_testfun(f, nbarg, x, y, i);
+  r->second_steps = 100.0*crlibm_second_step_taken/n;
+#endif
+}
+
+static void print_result(FILE *out, const result_t *r, int last) {
+  int m;
+
+  fprintf(out, "  {\"name\": \"%s\", \"distribution\": \"%s\"", r->name, r->distribution);
+  for(m = 0; m < NB_MEASURES; m++)
+    fprintf(out, ", \"%s_p50\": %.1f, \"%s_p90\": %.1f, \"%s_p99\": %.1f",
+            measure_names[m], r->p[m][0], measure_names[m], r->p[m][1],
+            measure_names[m], r->p[m][2]);
+  if(r->second_steps >= 0)
+    fprintf(out, ", \"second_steps\": %.3f", r->second_steps);
+  fprintf(out, "}%s\n", last ? "" : ",");
+}
+
+/* The value of "key": in a line written by print_result, or -1 */
+static double json_value(const char *line, const char *key) {
+  char pattern[64];
+  const char *s;
+  double v;
+
+  sprintf(pattern, "\"%s\": ", key);
+  s = strstr(line, pattern);
+  if(s == NULL || sscanf(s + strlen(pattern), "%lf", &v) != 1)
+    return -1;
+  return v;
+}
+
+static int json_string(const char *line, const char *key, char *value, int size) {
+  char pattern[64];
+  const char *s, *e;
+
+  sprintf(pattern, "\"%s\": \"", key);
+  s = strstr(line, pattern);
+  if(s == NULL)
+    return 0;
+  s += strlen(pattern);
+  e = strchr(s, '"');
+  if(e == NULL || e - s >= size)
+    return 0;
+  memcpy(value, s, e - s);
+  value[e - s] = 0;
+  return 1;
+}
+
+/* Compares the medians of throughput and latency of the n results
+   against the baseline file, and returns the number of regressions
+   beyond tolerance percent */
+static int compare(const char *file, const result_t *results, int n, double tolerance) {
+  char line[MAX_LINE], name[32], distribution[8];
+  double old, new;
+  int i, m, regressions = 0, found = 0;
+  FILE *f;
+
+  f = fopen(file, "r");
+  if(f == NULL) {
+    fprintf(stderr, "Cannot open the baseline %s\n", file);
+    exit(EXIT_FAILURE);
+  }
+  while(fgets(line, MAX_LINE, f) != NULL) {
+    if(!json_string(line, "name", name, sizeof(name))
+       || !json_string(line, "distribution", distribution, sizeof(distribution)))
+      continue;
+    for(i = 0; i < n; i++)
+      if(strcmp(results[i].name, name) == 0 && strcmp(results[i].distribution, distribution) == 0)
+        break;
+    if(i == n)
+      continue;
+    found++;
+    for(m = THROUGHPUT; m <= LATENCY; m++) {
+      char key[32];
+      sprintf(key, "%s_p50", measure_names[m]);
+      old = json_value(line, key);
+      new = results[i].p[m][0];
+      if(old > 0 && new > old*(1 + tolerance/100)) {
+        fprintf(stderr, "REGRESSION %s (%s) %s: %.1f ticks, baseline %.1f\n",
+                name, distribution, measure_names[m], new, old);
+        regressions++;
+      }
+    }
+  }
+  fclose(f);
+  fprintf(stderr, "%d of %d results found in %s, %d regressions beyond %g%%\n",
+          found, n, file, regressions, tolerance);
+  return regressions;
+}
+
+int main(int argc, char *argv[]) {
+  double (*randfun_perf)(), (*randfun_soaktest)(), (*randfun)();
+  double (*testfun_crlibm)(), (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  int (*testfun_mpfr)();
+  const char *only_function = NULL, *only_mode = NULL, *output = NULL, *baseline = NULL;
+  double tolerance = DEFAULT_TOLERANCE, worstcase;
+  unsigned int fn;
+  int n = DEFAULT_SAMPLES, i, mode, dist, nresults = 0, regressions = 0;
+  result_t *results;
+  FILE *out;
+
+  for(i = 1; i < argc; i++) {
+    switch(bench_option(argc, argv, &i, &only_function, &only_mode, &n)) {
+    case 0: break;
+    case 'o': output = argv[++i]; break;
+    case 'c': baseline = argv[++i]; break;
+    case 't': tolerance = atof(argv[++i]); break;
+    default: usage(argv[0]);
+    }
+  }
+  if(n < BLOCK)
+    usage(argv[0]);
+
+  x = malloc(n*sizeof(double));
+  y = malloc(n*sizeof(double));
+  ticks = malloc(n*sizeof(double));
+  results = malloc(NB_FUNCTIONS*4*2*sizeof(result_t));
+  if(x == NULL || y == NULL || ticks == NULL || results == NULL)
+    return EXIT_FAILURE;
+
+  crlibm_init();
+
+  tbx_time = timestamp_overhead();
+
+  for(fn = 0; fn < NB_FUNCTIONS; fn++) {
+    if(only_function != NULL && strcmp(only_function, function_names[fn]) != 0)
+      continue;
+    nbarg = (strcmp(function_names[fn], "pow") == 0) ? 2 : 1;
+    for(mode = 0; mode < 4; mode++) {
+      if(only_mode != NULL && strcmp(only_mode, mode_names[mode]) != 0)
+        continue;
+      testfun_crlibm = NULL;
+      test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+                &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+                (char *) function_names[fn], (char *) mode_names[mode]);
+      if(testfun_crlibm == NULL)
+        continue;
+      for(dist = 0; dist < 2; dist++) {
+        randfun = (dist == 0) ? randfun_perf : randfun_soaktest;
+        draw_arguments(randfun, nbarg, x, y, n);
+        entry_name(results[nresults].name, function_names[fn], mode_names[mode]);
+        strcpy(results[nresults].distribution, distribution_names[dist]);
+        measure(&results[nresults], testfun_crlibm, n);
+        nresults++;
+      }
+    }
+  }
+  if(nresults == 0)
+    usage(argv[0]);
+
+  out = stdout;
+  if(output != NULL && (out = fopen(output, "w")) == NULL) {
+    fprintf(stderr, "Cannot open %s\n", output);
+    return EXIT_FAILURE;
+  }
+  fprintf(out, "{\"unit\": \"ticks per call\", \"samples\": %d, \"results\": [\n", n);
+  for(i = 0; i < nresults; i++)
+    print_result(out, &results[i], i == nresults - 1);
+  fprintf(out, "]}\n");
+  if(out != stdout)
+    fclose(out);
+
+  if(baseline != NULL)
+    regressions = compare(baseline, results, nresults, tolerance);
+
+  free(x);
+  free(y);
+  free(ticks);
+  free(results);
+  return (regressions == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
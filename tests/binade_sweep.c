@@ -0,0 +1,242 @@
+/*
+ * Cost of the functions of one argument, binade by binade
+ *
+ * For each function and rounding mode, each binade of the finite
+ * doubles of each sign is sampled uniformly (random mantissa, fixed
+ * exponent), and for each binade are measured:
+ *
+ * - the mean time of a call, over a block of calls, and the 99th
+ *   percentile of the time of one call, in ticks, the time of the
+ *   time stamps removed,
+ * - the rate of calls which take the second step, counted by
+ *   crlibm_second_step_taken,
+ * - the rate of calls which return without any rounding test (special
+ *   cases, exact or tiny results), and therefore the rate of calls
+ *   which return after the quick phase: these are the calls which
+ *   still do not take the second step when it is forced by the hook of
+ *   crlibm_private.h (see QUICK_PHASE).
+ *
+ * The output is CSV, one binade per line, with the unbiased exponent
+ * (-1023 for the subnormals) as the binade. A rate is left empty when
+ * it cannot be measured: the rates of special and quick exits need
+ * crlibm configured with --enable-accurate-hook, and all the rates need
+ * a function whose second step updates the counter.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+
+#include "scs_lib/tests/tbx_timing.h"
+
+#define DEFAULT_SAMPLES 128
+
+static const char *function_names[] = {
+  "exp", "log", "log2", "log10", "expm1", "log1p",
+  "sin", "cos", "tan", "atan", "atanpi",
+  "sinh", "cosh", "asin", "acos", "asinpi", "acospi",
+  "sinpi", "cospi", "tanpi"
+};
+#define NB_FUNCTIONS (sizeof(function_names)/sizeof(function_names[0]))
+
+static const char *mode_names[] = {"RN", "RU", "RD", "RZ"};
+
+/* The time of two consecutive time stamps */
+static unsigned long long tbx_time;
+
+
+static void usage(const char *name) {
+  bench_usage(name, " [-o file]", 1, "arguments per binade", DEFAULT_SAMPLES);
+  fprintf(stderr, " -o file     : write the CSV there (default: standard output)\n");
+  exit(EXIT_FAILURE);
+}
+
+/* Whether f counts its second steps: it does if forcing them on a few
+   ordinary arguments moves the counter. Without the hook, many more
+   arguments are needed to meet a second step. */
+static int counts_second_steps(double (*f)(), double (*randfun)()) {
+#if EVAL_PERF==1
+  volatile double sink;
+  int i;
+
+  crlibm_second_step_taken = 0;
+#ifdef BUILD_ACCURATE_HOOK
+  crlibm_force_accurate = 1;
+  for(i = 0; i < 1000; i++)
+    sink = f(randfun());
+  crlibm_force_accurate = 0;
+#else
+  for(i = 0; i < 100000 && crlibm_second_step_taken == 0; i++)
+    sink = f(randfun());
+#endif
+  (void) sink;
+  return crlibm_second_step_taken > 0;
+#else
+  (void) f; (void) randfun;
+  return 0;
+#endif
+}
+
+static void print_rate(FILE *out, int measured, int count, int n) {
+  if(measured)
+    fprintf(out, ",%.4f", (double) count/n);
+  else
+    fprintf(out, ",");
+}
+
+/* Sweeps the binades of the given sign of f, writing one line each */
+static void sweep(FILE *out, const char *name, double (*f)(), int counted,
+                  int sign, double *x, double *ticks, int n) {
+  tbx_tick_t t1, t2;
+  unsigned long long dt;
+  volatile double sink;
+  db_number xdb;
+  double mean;
+  int e, i, accurate, special;
+
+  for(e = 0; e < 0x7ff; e++) {
+    for(i = 0; i < n; i++) {
+      xdb.i[LO] = rand_int();
+      xdb.i[HI] = (rand_int() & 0x000fffff) | (e << 20) | (sign ? 0x80000000 : 0);
+      x[i] = xdb.d;
+    }
+
+    /* the mean over one block of calls, steadier than the sum of the
+       single calls below, each of which pays for its time stamps */
+    TBX_GET_TICK(t1);
+    for(i = 0; i < n; i++)
+      sink = f(x[i]);
+    TBX_GET_TICK(t2);
+    dt = TBX_TICK_RAW_DIFF(t1, t2);
+    mean = net_ticks(dt, tbx_time)/n;
+
+    accurate = 0;
+    for(i = 0; i < n; i++) {
+#if EVAL_PERF==1
+      crlibm_second_step_taken = 0;
+#endif
+      TBX_GET_TICK(t1);
+      sink = f(x[i]);
+      TBX_GET_TICK(t2);
+      dt = TBX_TICK_RAW_DIFF(t1, t2);
+      ticks[i] = net_ticks(dt, tbx_time);
+#if EVAL_PERF==1
+      accurate += (crlibm_second_step_taken != 0);
+#endif
+    }
+    qsort(ticks, n, sizeof(double), compare_doubles);
+
+    special = 0;
+#if defined(BUILD_ACCURATE_HOOK) && EVAL_PERF==1
+    crlibm_force_accurate = 1;
+    for(i = 0; i < n; i++) {
+      crlibm_second_step_taken = 0;
+      sink = f(x[i]);
+      special += (crlibm_second_step_taken == 0);
+    }
+    crlibm_force_accurate = 0;
+#endif
+    (void) sink;
+
+    fprintf(out, "%s,%c,%d,%d,%.1f,%.1f", name, sign ? '-' : '+', e - 1023, n,
+            mean, ticks[(int) ((n - 1)*0.99)]);
+#ifdef BUILD_ACCURATE_HOOK
+    print_rate(out, counted, special, n);
+    print_rate(out, counted, n - special - accurate, n);
+#else
+    print_rate(out, 0, 0, n);
+    print_rate(out, 0, 0, n);
+#endif
+    print_rate(out, counted, accurate, n);
+    fprintf(out, "\n");
+  }
+}
+
+int main(int argc, char *argv[]) {
+  double (*randfun_perf)(), (*randfun_soaktest)();
+  double (*testfun_crlibm)(), (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  int (*testfun_mpfr)();
+  const char *only_function = NULL, *only_mode = NULL, *output = NULL;
+  double worstcase, *x, *ticks;
+  unsigned int fn;
+  int n = DEFAULT_SAMPLES, i, mode, sign, counted, found = 0;
+  char name[32];
+  FILE *out;
+
+  for(i = 1; i < argc; i++) {
+    switch(bench_option(argc, argv, &i, &only_function, &only_mode, &n)) {
+    case 0: break;
+    case 'o': output = argv[++i]; break;
+    default: usage(argv[0]);
+    }
+  }
+  if(n < 1)
+    usage(argv[0]);
+
+  x = malloc(n*sizeof(double));
+  ticks = malloc(n*sizeof(double));
+  if(x == NULL || ticks == NULL)
+    return EXIT_FAILURE;
+
+  out = stdout;
+  if(output != NULL && (out = fopen(output, "w")) == NULL) {
+    fprintf(stderr, "Cannot open %s\n", output);
+    return EXIT_FAILURE;
+  }
+
+  crlibm_init();
+
+  tbx_time = timestamp_overhead();
+
+  fprintf(out, "function,sign,exponent,samples,mean,p99,special,quick,accurate\n");
+
+  for(fn = 0; fn < NB_FUNCTIONS; fn++) {
+    if(only_function != NULL && strcmp(only_function, function_names[fn]) != 0)
+      continue;
+    for(mode = 0; mode < 4; mode++) {
+      if(only_mode != NULL && strcmp(only_mode, mode_names[mode]) != 0)
+        continue;
+      testfun_crlibm = NULL;
+      test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+                &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+                (char *) function_names[fn], (char *) mode_names[mode]);
+      if(testfun_crlibm == NULL)
+        continue;
+      found++;
+      entry_name(name, function_names[fn], mode_names[mode]);
+      srandom(42);
+      counted = counts_second_steps(testfun_crlibm, randfun_perf);
+      for(sign = 0; sign < 2; sign++)
+        sweep(out, name, testfun_crlibm, counted, sign, x, ticks, n);
+    }
+  }
+  if(found == 0)
+    usage(argv[0]);
+  if(out != stdout)
+    fclose(out);
+
+  free(x);
+  free(ticks);
+  return EXIT_SUCCESS;
+}
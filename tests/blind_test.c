@@ -15,23 +15,6 @@ void usage(char *fct_name){
 int nbarg;          
 
 
-char* skip_comments(FILE* f, char* line) {
-  char* r; 
-  int i;
-  do {
-    r=fgets(line, 200, f);
-  }
-    /* Look if the first char was a #, a newline or a blank character */
-  while((line[0]=='#' || line[0]=='\n' || line[0]==' ' || line[0]=='\t' || line[0]==0) && r!=NULL);
-
-  /* look for a comment in the line, and remove it */
-  i=0;
-  while(line[i]!=0 && line[i]!='#') i++;
-  line[i]=0;
-  return r;
-}
-
-
 int main (int argc, char *argv[]) 
 { 
   int verbose=0;
@@ -53,6 +36,41 @@ int main (int argc, char *argv[])
   int (*mpfr_fun)() = NULL;
   double (*testfun_crlibm)() = NULL;
   double (*unused)() = NULL;
+  /* The vectors of the functions which have a batch version are also
+     checked through it, all together at the end of the file, so that
+     the batch has to cope with all the cases of the file at once */
+  void (*batchfun)(double *, const double *, int);
+  void (**batch_fun)(double *, const double *, int) = NULL;
+  double *batch_input = NULL, *batch_in = NULL, *batch_out = NULL;
+  db_number *batch_expected = NULL, *batch_exp = NULL, batch_output;
+  int nbatch=0, maxbatch=0, i, j, n;
+  /* The vectors in round toward zero of the functions which have a
+     round-to-odd version are also checked through it: the result
+     must be the expected one, or its odd successor in magnitude (if
+     the expected one was even and inexact) */
+  double (*rofun)(double) = NULL;
+  db_number ro_output;
+#ifdef BUILD_INTERVAL_FUNCTIONS
+  /* The vectors in the directed modes of the functions which have an
+     interval batch version are checked through it as well, on [x, x]
+     and on [x, +inf] (RD) or [lo, x] (RU), lo being the lower end of
+     the domain: the thin and the wide intervals take different paths */
+  void (*ibatchfun)(double *, double *, const double *, const double *, int) = NULL;
+  double *ibatch_input = NULL, *ibatch_inf = NULL, *ibatch_sup = NULL;
+  double *ibatch_rinf = NULL, *ibatch_rsup = NULL, lo;
+  double (*ibatch_rd)() = NULL, (*ibatch_ru)() = NULL;
+  db_number *ibatch_expected = NULL;
+  int *ibatch_up = NULL;
+  int nibatch=0, maxibatch=0, up, pass;
+  /* Those in the directed modes of the functions which have a scalar
+     interval version are checked on [x, x], both bounds, the other one
+     being the result of the function in the other direction */
+  interval (*ifun)(interval) = NULL;
+  interval ithin, ires;
+  double (*otherfun)() = NULL;
+  db_number ilow, iup, iout;
+  int ibound;
+#endif
 
   FILE* f;
 
@@ -83,6 +101,14 @@ int main (int argc, char *argv[])
   if (strcmp(function_name,"pow")==0) nbarg=2;
   else nbarg=1;
 
+#ifdef BUILD_INTERVAL_FUNCTIONS
+  ibatchfun = test_interval_batch_init(function_name, &lo);
+  if (nbarg==1 && !test_interval_init(&unused, &ifun, &mpfr_fun, function_name))
+    ifun = NULL;
+#endif
+
+  if (nbarg==1) rofun = test_ro_init(function_name);
+
   if(verbose)  printf("Testing function: %s\n", function_name);
 
   r=skip_comments(f, line);
@@ -115,6 +141,76 @@ int main (int argc, char *argv[])
 
     count++;
 
+    if (nbarg==1) {
+      batchfun = test_batch_init(function_name, rounding_mode);
+      if (batchfun != NULL) {
+	if (nbatch == maxbatch) {
+	  maxbatch = 2*maxbatch + 64;
+	  batch_fun      = realloc(batch_fun, maxbatch*sizeof(*batch_fun));
+	  batch_input    = realloc(batch_input, maxbatch*sizeof(double));
+	  batch_expected = realloc(batch_expected, maxbatch*sizeof(db_number));
+	  if (batch_fun==NULL || batch_input==NULL || batch_expected==NULL) {
+	    fprintf(stderr, "%s: out of memory, exiting\n", argv[0]);
+	    exit(EXIT_FAILURE);
+	  }
+	}
+	batch_fun[nbatch] = batchfun;
+	batch_input[nbatch] = input.d;
+	batch_expected[nbatch] = expected;
+	nbatch++;
+      }
+    }
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+    up = (strcmp(rounding_mode,"RU")==0) || (strcmp(rounding_mode,"P")==0);
+    /* Outside the domain, the interval functions return empty
+       intervals (or clip the domain), not what the vectors expect */
+    if (ibatchfun != NULL 
+	&& (up || (strcmp(rounding_mode,"RD")==0) || (strcmp(rounding_mode,"M")==0))
+	&& !(input.d < lo) && !(lo == 0.0 && input.i[HI] < 0)) {
+      if (nibatch == maxibatch) {
+	maxibatch = 2*maxibatch + 64;
+	ibatch_input    = realloc(ibatch_input, maxibatch*sizeof(double));
+	ibatch_expected = realloc(ibatch_expected, maxibatch*sizeof(db_number));
+	ibatch_up       = realloc(ibatch_up, maxibatch*sizeof(int));
+	if (ibatch_input==NULL || ibatch_expected==NULL || ibatch_up==NULL) {
+	  fprintf(stderr, "%s: out of memory, exiting\n", argv[0]);
+	  exit(EXIT_FAILURE);
+	}
+      }
+      ibatch_input[nibatch] = input.d;
+      ibatch_expected[nibatch] = expected;
+      ibatch_up[nibatch] = up;
+      nibatch++;
+    }
+    if (ifun != NULL 
+	&& (up || (strcmp(rounding_mode,"RD")==0) || (strcmp(rounding_mode,"M")==0))
+	&& (expected.d == expected.d) && !(input.d == 0.0 && input.i[HI] < 0)) {
+      test_init(&unused, &unused, &otherfun, 
+		&mpfr_fun, &unused, &unused, &unused, &worstcase,
+		function_name, up ? "RD" : "RU");
+      if (up) { ilow.d = otherfun(input.d); iup = expected; }
+      else    { ilow = expected; iup.d = otherfun(input.d); }
+      ASSIGN_LOW(ithin, input.d);
+      ASSIGN_UP(ithin, input.d);
+      ires = ifun(ithin);
+      for(ibound=0; ibound<2; ibound++) {
+	iout.d = ibound ? UP(ires) : LOW(ires);
+	expected = ibound ? iup : ilow;
+	count++;
+	if(    ((expected.d != expected.d) && (iout.d == iout.d))
+	    || ((expected.d == expected.d) && (iout.l != expected.l))    ) {
+	  failures ++;
+	  printf("ERROR for the interval version of %s, %s bound on [%0.20e, %0.20e]\n", 
+		 function_name, ibound ? "upper" : "lower", input.d, input.d);
+	  printf("      Output: %08x %08x  (%0.50e)\n", iout.i[HI], iout.i[LO], iout.d ); 
+	  printf("    Expected: %08x %08x  (%0.50e)\n", expected.i[HI], expected.i[LO], expected.d ); 
+	}
+      }
+      expected = up ? iup : ilow;
+    }
+#endif
+
     if(verbose){
       if (nbarg==2)
         printf("Input1: %08x %08x  (%0.50e),       Input2: %08x %08x  (%0.50e)\n", 
@@ -170,10 +266,125 @@ int main (int argc, char *argv[])
 #endif /* HAVE_MPFR_H */ 
 
     }
+    if (rofun != NULL 
+	&& ((strcmp(rounding_mode,"RZ")==0) || (strcmp(rounding_mode,"Z")==0))) {
+      ro_output.d = rofun(input.d);
+      count++;
+      if(    ((expected.d != expected.d) && (ro_output.d == ro_output.d))
+	  || ((expected.d == expected.d) && (ro_output.l != expected.l) 
+	      && ((ro_output.l != expected.l+1) || !(ro_output.l & 1)))    ) {
+	failures ++;
+	printf("ERROR for the round-to-odd version of %s\n", function_name);
+	printf("       Input:      %08x %08x  (%0.50e)\n", input.i[HI], input.i[LO], input.d ); 
+	printf("      Output: %08x %08x  (%0.50e)\n", ro_output.i[HI], ro_output.i[LO], ro_output.d ); 
+	printf("  Expected RZ: %08x %08x  (%0.50e)\n", expected.i[HI], expected.i[LO], expected.d ); 
+      }
+    }
+
     fflush(stdout); /* To help debugging */
     
     r=skip_comments(f, line);
   } 
+
+  /* Now the batch versions, one call per rounding mode */
+  if (nbatch > 0) {
+    batch_in  = malloc(nbatch*sizeof(double));
+    batch_out = malloc(nbatch*sizeof(double));
+    batch_exp = malloc(nbatch*sizeof(db_number));
+    if (batch_in==NULL || batch_out==NULL || batch_exp==NULL) {
+      fprintf(stderr, "%s: out of memory, exiting\n", argv[0]);
+      exit(EXIT_FAILURE);
+    }
+  }
+  for(i=0; i<nbatch; i++) {
+    if (batch_fun[i] == NULL) continue;
+    batchfun = batch_fun[i];
+    n=0;
+    for(j=i; j<nbatch; j++) 
+      if (batch_fun[j] == batchfun) {
+	batch_in[n]  = batch_input[j];
+	batch_exp[n] = batch_expected[j];
+	batch_fun[j] = NULL;
+	n++;
+      }
+    batchfun(batch_out, batch_in, n);
+    for(j=0; j<n; j++) {
+      batch_output.d = batch_out[j];
+      count++;
+      if(    ((batch_exp[j].d != batch_exp[j].d) && (batch_output.d == batch_output.d))
+          || ((batch_exp[j].d == batch_exp[j].d) && (batch_output.l != batch_exp[j].l))    ) {
+	failures ++;
+	input.d = batch_in[j];
+	printf("ERROR for the batch version of %s\n", function_name);
+	printf("       Input:      %08x %08x  (%0.50e)\n", input.i[HI], input.i[LO], input.d ); 
+	printf("      Output: %08x %08x  (%0.50e)\n", batch_output.i[HI], batch_output.i[LO], batch_output.d ); 
+	printf("    Expected: %08x %08x  (%0.50e)\n", batch_exp[j].i[HI], batch_exp[j].i[LO], batch_exp[j].d ); 
+      }
+    }
+  }
+  free(batch_fun);  free(batch_input);  free(batch_expected);
+  free(batch_in);   free(batch_out);    free(batch_exp);
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+  /* The interval batch version, once on the thin intervals and once
+     on the wide ones */
+  if (nibatch > 0) {
+    test_init(&unused, &unused, &ibatch_rd, &mpfr_fun, &unused, &unused, &unused, &worstcase,
+	      function_name, "RD");
+    test_init(&unused, &unused, &ibatch_ru, &mpfr_fun, &unused, &unused, &unused, &worstcase,
+	      function_name, "RU");
+    ibatch_inf  = malloc(nibatch*sizeof(double));
+    ibatch_sup  = malloc(nibatch*sizeof(double));
+    ibatch_rinf = malloc(nibatch*sizeof(double));
+    ibatch_rsup = malloc(nibatch*sizeof(double));
+    if (ibatch_inf==NULL || ibatch_sup==NULL || ibatch_rinf==NULL || ibatch_rsup==NULL) {
+      fprintf(stderr, "%s: out of memory, exiting\n", argv[0]);
+      exit(EXIT_FAILURE);
+    }
+  }
+  for(pass=0; pass<2 && nibatch>0; pass++) {
+    for(j=0; j<nibatch; j++) {
+      ibatch_inf[j] = ibatch_input[j];
+      ibatch_sup[j] = ibatch_input[j];
+      if (pass==1) {
+	if (ibatch_up[j]) ibatch_inf[j] = lo;
+	else              ibatch_sup[j] = 1.0/0.0;
+      }
+    }
+    ibatchfun(ibatch_rinf, ibatch_rsup, ibatch_inf, ibatch_sup, nibatch);
+    for(j=0; j<nibatch; j++) {
+      batch_output.d = ibatch_up[j] ? ibatch_rsup[j] : ibatch_rinf[j];
+      count++;
+      if(    ((ibatch_expected[j].d != ibatch_expected[j].d) && (batch_output.d == batch_output.d))
+          || ((ibatch_expected[j].d == ibatch_expected[j].d) && (batch_output.l != ibatch_expected[j].l))    ) {
+	failures ++;
+	printf("ERROR for the interval batch version of %s, on [%0.20e, %0.20e]\n", 
+	       function_name, ibatch_inf[j], ibatch_sup[j]);
+	printf("      Output: %08x %08x  (%0.50e)\n", batch_output.i[HI], batch_output.i[LO], batch_output.d ); 
+	printf("    Expected: %08x %08x  (%0.50e)\n", ibatch_expected[j].i[HI], ibatch_expected[j].i[LO], ibatch_expected[j].d ); 
+      }
+      /* Both bounds, the functions being increasing: the result must
+	 be [f_rd(inf), f_ru(sup)], not only agree with the vector on
+	 the bound it gives */
+      for(up=0; up<2; up++) {
+	batch_output.d = up ? ibatch_rsup[j] : ibatch_rinf[j];
+	expected.d = up ? ibatch_ru(ibatch_sup[j]) : ibatch_rd(ibatch_inf[j]);
+	count++;
+	if(    ((expected.d != expected.d) && (batch_output.d == batch_output.d))
+	    || ((expected.d == expected.d) && (batch_output.l != expected.l))    ) {
+	  failures ++;
+	  printf("ERROR for the interval batch version of %s, %s bound on [%0.20e, %0.20e]\n", 
+		 function_name, up ? "upper" : "lower", ibatch_inf[j], ibatch_sup[j]);
+	  printf("      Output: %08x %08x  (%0.50e)\n", batch_output.i[HI], batch_output.i[LO], batch_output.d ); 
+	  printf("    Expected: %08x %08x  (%0.50e)\n", expected.i[HI], expected.i[LO], expected.d ); 
+	}
+      }
+    }
+  }
+  free(ibatch_input); free(ibatch_expected); free(ibatch_up);
+  free(ibatch_inf);   free(ibatch_sup);      free(ibatch_rinf);  free(ibatch_rsup);
+#endif
+
   printf("Test completed for %s, %d failures in %d tests\n", function_name, failures, count);
   return failures;
   
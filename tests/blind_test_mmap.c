@@ -0,0 +1,259 @@
+/*
+ * Check of the binary file of test vectors
+ *
+ * Usage: crlibm_blindtest_mmap [-t threads] file
+ *
+ * The file, written by testvectors_convert.c from the .testdata files
+ * (see testvectors.h), is mapped in memory, and its vectors are
+ * distributed in blocks over a number of threads, each of which
+ * compares the results of the functions to the expected ones as
+ * blind_test.c does. The batch, round-to-odd and interval versions
+ * are only checked by blind_test.c.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+#include "testvectors.h"
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#define BLOCK 1024
+#define MAX_THREADS 256
+#define MAX_REPORTED 10
+
+static const char *mode_names[4] = {"RN", "RU", "RD", "RZ"};
+
+/* The mapped file, and the functions of its vectors by mode */
+static const char *names;
+static const test_vector *vectors;
+static unsigned int nb_functions, nb_vectors;
+static double (*functions[TESTVECTORS_MAX_FUNCTIONS][4])();
+static int nbargs[TESTVECTORS_MAX_FUNCTIONS];
+
+static int nb_threads;
+static long long errors[MAX_THREADS];
+#ifdef HAVE_PTHREAD_H
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static int reported;
+
+static void report(const test_vector *v, db_number output) {
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock(&report_lock);
+#endif
+  if(reported < MAX_REPORTED) {
+    printf("ERROR for %s with rounding %s\n",
+           names + v->function*TESTVECTORS_NAME_SIZE, mode_names[v->mode]);
+    if(nbargs[v->function] == 2)
+      printf("       Input1: %08x %08x  (%0.50e),       Input2: %08x %08x  (%0.50e)\n",
+             v->x.i[HI], v->x.i[LO], v->x.d, v->y.i[HI], v->y.i[LO], v->y.d);
+    else
+      printf("       Input:      %08x %08x  (%0.50e)\n", v->x.i[HI], v->x.i[LO], v->x.d);
+    printf("      Output: %08x %08x  (%0.50e)\n", output.i[HI], output.i[LO], output.d);
+    printf("    Expected: %08x %08x  (%0.50e)\n",
+           v->expected.i[HI], v->expected.i[LO], v->expected.d);
+  }
+  reported++;
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock(&report_lock);
+#endif
+}
+
+/* Thread t checks the blocks t, t+nb_threads, etc */
+static void *check_blocks(void *arg) {
+  const test_vector *v;
+  db_number output;
+  unsigned int b, j, nb_blocks;
+  int t;
+
+  t = (int) (long) arg;
+  nb_blocks = (nb_vectors + BLOCK - 1) / BLOCK;
+  for(b=t; b<nb_blocks; b+=nb_threads) {
+    for(j=b*BLOCK; j<(b+1)*BLOCK && j<nb_vectors; j++) {
+      v = &vectors[j];
+      if(nbargs[v->function] == 2)
+        output.d = functions[v->function][v->mode](v->x.d, v->y.d);
+      else
+        output.d = functions[v->function][v->mode](v->x.d);
+      /* The same test as blind_test, contrived because of NaN */
+      if(    ((v->expected.d != v->expected.d) && (output.d == output.d))
+          || ((v->expected.d == v->expected.d) && (output.l != v->expected.l))    ) {
+        report(v, output);
+        errors[t]++;
+      }
+    }
+  }
+  return NULL;
+}
+
+/* The whole file in memory, mapped if possible */
+static void *load(const char *filename, size_t *size) {
+  struct stat st;
+  void *p;
+  int fd;
+
+  fd = open(filename, O_RDONLY);
+  if(fd < 0)
+    return NULL;
+  if(fstat(fd, &st) != 0 || st.st_size < TESTVECTORS_HEADER_SIZE) {
+    close(fd);
+    return NULL;
+  }
+  *size = st.st_size;
+#ifdef HAVE_SYS_MMAN_H
+  p = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED)
+    p = NULL;
+#else
+  p = malloc(*size);
+  if(p != NULL) {
+    size_t done = 0;
+    ssize_t r;
+    while(done < *size) {
+      r = read(fd, (char *) p + done, *size - done);
+      if(r <= 0) {
+        free(p);
+        p = NULL;
+        break;
+      }
+      done += r;
+    }
+  }
+#endif
+  close(fd);
+  return p;
+}
+
+static void usage(char *prog_name) {
+  fprintf(stderr, "\nUsage: %s [-t threads] file\n", prog_name);
+  fprintf(stderr, "  file is written by crlibm_testvectors_convert\n\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[]) {
+#ifdef HAVE_PTHREAD_H
+  pthread_t threads[MAX_THREADS];
+#endif
+  double (*unused)() = NULL;
+  int (*mpfr_unused)() = NULL;
+  double worstcase;
+  unsigned int header[4], f;
+  struct timespec t1, t2;
+  char *p;
+  size_t size;
+  int t, mode, opt;
+
+#ifdef HAVE_PTHREAD_H
+  nb_threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#else
+  nb_threads = 1;
+#endif
+  while((opt = getopt(argc, argv, "t:")) != -1) {
+    if(opt == 't') nb_threads = atoi(optarg);
+    else           usage(argv[0]);
+  }
+  if(nb_threads < 1) nb_threads = 1;
+  if(nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+#ifndef HAVE_PTHREAD_H
+  nb_threads = 1;
+#endif
+  if(optind != argc - 1) usage(argv[0]);
+
+  p = load(argv[optind], &size);
+  if(p == NULL) {
+    fprintf(stderr, "%s: problem opening %s, exiting\n", argv[0], argv[optind]);
+    exit(EXIT_FAILURE);
+  }
+  memcpy(header, p + 8, sizeof(header));
+  if(memcmp(p, TESTVECTORS_MAGIC, 8) != 0
+     || header[0] != TESTVECTORS_VERSION
+     || header[1] != TESTVECTORS_BYTE_ORDER
+     || header[2] > TESTVECTORS_MAX_FUNCTIONS
+     || size != TESTVECTORS_FILE_SIZE(header[2], header[3])) {
+    fprintf(stderr, "%s: %s is not a test vector file of this machine, exiting\n",
+            argv[0], argv[optind]);
+    exit(EXIT_FAILURE);
+  }
+  nb_functions = header[2];
+  nb_vectors = header[3];
+  names = p + TESTVECTORS_HEADER_SIZE;
+  vectors = (const test_vector *) (p + TESTVECTORS_OFFSET(nb_functions));
+
+  crlibm_init();
+
+  /* Centralized test initialization function, once per function and mode */
+  for(f=0; f<nb_functions; f++) {
+    char function_name[TESTVECTORS_NAME_SIZE];
+    memcpy(function_name, names + f*TESTVECTORS_NAME_SIZE, TESTVECTORS_NAME_SIZE);
+    function_name[TESTVECTORS_NAME_SIZE - 1] = 0;
+    nbargs[f] = (strcmp(function_name, "pow") == 0) ? 2 : 1;
+    for(mode=0; mode<4; mode++) {
+      test_init(&unused, &unused, &functions[f][mode], &mpfr_unused,
+                &unused, &unused, &unused, &worstcase,
+                function_name, (char *) mode_names[mode]);
+    }
+  }
+  for(f=0; f<nb_vectors; f++) {
+    if(vectors[f].function >= nb_functions || vectors[f].mode > 3) {
+      fprintf(stderr, "%s: %s is corrupted, exiting\n", argv[0], argv[optind]);
+      exit(EXIT_FAILURE);
+    }
+    if(functions[vectors[f].function][vectors[f].mode] == NULL) {
+      fprintf(stderr, "%s: no function %s in %s, exiting\n", argv[0],
+              names + vectors[f].function*TESTVECTORS_NAME_SIZE, mode_names[vectors[f].mode]);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+#ifdef HAVE_PTHREAD_H
+  for(t=0; t<nb_threads; t++)
+    pthread_create(&threads[t], NULL, check_blocks, (void *) (long) t);
+  for(t=0; t<nb_threads; t++)
+    pthread_join(threads[t], NULL);
+#else
+  check_blocks((void *) 0);
+#endif
+  clock_gettime(CLOCK_MONOTONIC, &t2);
+  for(t=1; t<nb_threads; t++)
+    errors[0] += errors[t];
+
+  printf("Test completed for %u functions, %lld failures in %u tests, %.3f s on %d threads\n",
+         nb_functions, errors[0], nb_vectors,
+         (t2.tv_sec - t1.tv_sec) + 1e-9*(t2.tv_nsec - t1.tv_nsec), nb_threads);
+#ifdef HAVE_SYS_MMAN_H
+  munmap(p, size);
+#else
+  free(p);
+#endif
+  return (errors[0] == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
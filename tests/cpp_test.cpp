@@ -0,0 +1,467 @@
+/*
+ * Test of the C++ interface, crlibm.hpp and crlibm_simd.hpp
+ *
+ * - crlibm::f<R>(x) must be the function of crlibm.h in the rounding
+ *   mode R, and rounding::toward_zero that rounded downwards for exp,
+ *   acos and acospi, which have no f_rz,
+ * - the overloads on std::span must give the scalar results, and throw
+ *   std::length_error if the result span is shorter than the argument,
+ * - the bounds of the interval operators + - * / must be the exact
+ *   result rounded downwards and upwards, checked with fma, including
+ *   operands above 2^996 (where Mul12 is done on the operand divided
+ *   by 2^53), overflows, and products of a zero and an infinite bound,
+ * - the vector overloads (__m128d, __m256d, __m512d and simd<double>)
+ *   must give the scalar results in each lane.
+ *
+ * The __m256d and __m512d overloads exist only when compiled for AVX
+ * and AVX-512: this file is also built as crlibm_cpp_test_avx and
+ * crlibm_cpp_test_avx512, which check that the processor has them.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "crlibm_config.h"
+#endif
+/* otherwise CMake is used, and defines all the useful variables using -D switch */
+
+/* The fi_lib-compatible interval functions of crlibm.h are C only, and
+   their interval type would hide crlibm::interval: they are not tested here */
+#undef BUILD_INTERVAL_FUNCTIONS
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include "crlibm.hpp"
+
+#if defined(__x86_64__) && defined(BUILD_VECTOR_ABI)
+#include "crlibm_simd.hpp"
+#define TEST_SIMD 1
+#endif
+
+#define NB_TESTS 10000
+#define MAX_REPORTED 10
+
+using crlibm::rounding;
+typedef crlibm::interval<double> interval;
+
+static const char *mode_names[] = {"rn", "ru", "rd", "rz"};
+
+static long long errors = 0;
+
+static void report(const char *name, const char *mode, double x,
+                   double got, double expected) {
+  if(errors < MAX_REPORTED)
+    printf("ERROR for %s_%s(%a): %a instead of %a\n", name, mode, x, got, expected);
+  errors++;
+}
+
+/* The same double, or both NaN */
+static bool same(double a, double b) {
+  if(std::isnan(a) || std::isnan(b))
+    return std::isnan(a) && std::isnan(b);
+  return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+/* A random double of [-2^e, 2^e] */
+static double random_arg(int e) {
+  return std::ldexp(2*drand48() - 1, e);
+}
+
+static const double special[] = {
+  0.0, -0.0, 1.0, -1.0, 0.5, 0x1p-1074, -0x1p-1074, 0x1.fffffffffffffp1023,
+  INFINITY, -INFINITY, NAN, 710.0, -746.0, 1e22, 0x1.921fb54442d18p0
+};
+#define NB_SPECIAL (sizeof(special)/sizeof(special[0]))
+
+
+
+/* The mapping of crlibm::f<R> to the functions of crlibm.h */
+
+typedef double (*function_t)(double);
+
+static void check_mapping(const char *name, const function_t cpp[4],
+                          const function_t c[4], function_t cpp_default, int e) {
+  double x;
+  int i, mode;
+
+  for(i = 0; i < (int) NB_SPECIAL + 100; i++) {
+    x = (i < (int) NB_SPECIAL) ? special[i] : random_arg(e);
+    for(mode = 0; mode < 4; mode++)
+      if(!same(cpp[mode](x), c[mode](x)))
+        report(name, mode_names[mode], x, cpp[mode](x), c[mode](x));
+    if(!same(cpp_default(x), c[0](x)))
+      report(name, "default", x, cpp_default(x), c[0](x));
+  }
+}
+
+#define CHECK_MAPPING(f, rn, ru, rd, rz, e)                                     \
+  {                                                                            \
+    const function_t cpp[4] = {crlibm::f<rounding::to_nearest>, crlibm::f<rounding::up>, \
+                               crlibm::f<rounding::down>, crlibm::f<rounding::toward_zero>}; \
+    const function_t c[4] = {rn, ru, rd, rz};                                  \
+    check_mapping(#f, cpp, c, crlibm::f<>, e);                                 \
+  }
+
+static void check_mappings(void) {
+  double x, y;
+  int i;
+
+  /* exp, acos and acospi are positive: toward zero is downwards */
+  CHECK_MAPPING(exp,    exp_rn,    exp_ru,    exp_rd,    exp_rd,    10)
+  CHECK_MAPPING(acos,   acos_rn,   acos_ru,   acos_rd,   acos_rd,   0)
+  CHECK_MAPPING(acospi, acospi_rn, acospi_ru, acospi_rd, acospi_rd, 0)
+  CHECK_MAPPING(log,    log_rn,    log_ru,    log_rd,    log_rz,    20)
+  CHECK_MAPPING(cos,    cos_rn,    cos_ru,    cos_rd,    cos_rz,    10)
+  CHECK_MAPPING(sin,    sin_rn,    sin_ru,    sin_rd,    sin_rz,    10)
+  CHECK_MAPPING(tan,    tan_rn,    tan_ru,    tan_rd,    tan_rz,    10)
+  CHECK_MAPPING(cospi,  cospi_rn,  cospi_ru,  cospi_rd,  cospi_rz,  10)
+  CHECK_MAPPING(sinpi,  sinpi_rn,  sinpi_ru,  sinpi_rd,  sinpi_rz,  10)
+  CHECK_MAPPING(tanpi,  tanpi_rn,  tanpi_ru,  tanpi_rd,  tanpi_rz,  10)
+  CHECK_MAPPING(atan,   atan_rn,   atan_ru,   atan_rd,   atan_rz,   10)
+  CHECK_MAPPING(atanpi, atanpi_rn, atanpi_ru, atanpi_rd, atanpi_rz, 10)
+  CHECK_MAPPING(cosh,   cosh_rn,   cosh_ru,   cosh_rd,   cosh_rz,   9)
+  CHECK_MAPPING(sinh,   sinh_rn,   sinh_ru,   sinh_rd,   sinh_rz,   9)
+  CHECK_MAPPING(log2,   log2_rn,   log2_ru,   log2_rd,   log2_rz,   20)
+  CHECK_MAPPING(log10,  log10_rn,  log10_ru,  log10_rd,  log10_rz,  20)
+  CHECK_MAPPING(asin,   asin_rn,   asin_ru,   asin_rd,   asin_rz,   0)
+  CHECK_MAPPING(asinpi, asinpi_rn, asinpi_ru, asinpi_rd, asinpi_rz, 0)
+  CHECK_MAPPING(expm1,  expm1_rn,  expm1_ru,  expm1_rd,  expm1_rz,  6)
+  CHECK_MAPPING(log1p,  log1p_rn,  log1p_ru,  log1p_rd,  log1p_rz,  6)
+
+  for(i = 0; i < 100; i++) {
+    x = std::fabs(random_arg(4));
+    y = random_arg(4);
+    if(!same(crlibm::pow(x, y), pow_rn(x, y)))
+      report("pow", "rn", x, crlibm::pow(x, y), pow_rn(x, y));
+  }
+}
+
+
+
+/* The overloads on std::span */
+
+#if CRLIBM_HAS_SPAN
+static void check_span(const char *name, const char *mode,
+                       void (*fspan)(std::span<double>, std::span<const double>),
+                       double (*f)(double), int e) {
+  /* more than a block of the batch functions, and an odd count */
+  const std::size_t n = 1001;
+  std::vector<double> x(n), res(n + 1);
+  std::size_t i;
+  bool thrown = false;
+
+  for(i = 0; i < n; i++)
+    x[i] = (i < NB_SPECIAL) ? special[i] : random_arg(e);
+  res[n] = 42.0;
+  fspan(res, x);
+  for(i = 0; i < n; i++)
+    if(!same(res[i], f(x[i])))
+      report(name, mode, x[i], res[i], f(x[i]));
+  /* only the first n results are written */
+  if(res[n] != 42.0)
+    report(name, mode, 0, res[n], 42.0);
+
+  try {
+    fspan(std::span<double>(res.data(), n - 1), x);
+  }
+  catch(const std::length_error&) {
+    thrown = true;
+  }
+  if(!thrown) {
+    if(errors < MAX_REPORTED)
+      printf("ERROR for %s_%s on spans: no length_error for a short result\n", name, mode);
+    errors++;
+  }
+}
+
+#define CHECK_SPAN(f, e)                                                       \
+  check_span(#f, "rn", crlibm::f<rounding::to_nearest>, crlibm::f<rounding::to_nearest>, e); \
+  check_span(#f, "ru", crlibm::f<rounding::up>, crlibm::f<rounding::up>, e);  \
+  check_span(#f, "rd", crlibm::f<rounding::down>, crlibm::f<rounding::down>, e); \
+  check_span(#f, "rz", crlibm::f<rounding::toward_zero>, crlibm::f<rounding::toward_zero>, e);
+
+static void check_spans(void) {
+  /* the batch functions */
+  CHECK_SPAN(exp, 10)
+  CHECK_SPAN(log, 20)
+  CHECK_SPAN(sin, 10)
+  CHECK_SPAN(cos, 10)
+  CHECK_SPAN(tan, 10)
+  /* the loops */
+  CHECK_SPAN(atan, 10)
+  CHECK_SPAN(acos, 0)
+  CHECK_SPAN(log1p, 6)
+}
+#endif
+
+
+
+/* The interval operators. For each bound b of x op y, fma gives the
+   sign of the exact x op y - b: b must be the exact result if it is
+   representable, and else one of the two doubles around it. */
+
+static void report_interval(const char *op, interval x, interval y,
+                            interval got, const char *what) {
+  if(errors < MAX_REPORTED)
+    printf("ERROR for [%a, %a] %s [%a, %a]: [%a, %a] (%s)\n",
+           x.lo, x.hi, op, y.lo, y.hi, got.lo, got.hi, what);
+  errors++;
+}
+
+/* The sign of a*b - c, of a/b - c (b > 0) */
+static double sign_mul(double a, double b, double c) { return std::fma(a, b, -c); }
+static double sign_div(double a, double b, double c) { return -std::fma(c, b, -a); }
+
+/* r for a op b, whose exact result is finite and not close to the
+   underflow threshold: r.lo is the result rounded downwards, r.hi
+   rounded upwards, beyond the largest double if it overflows */
+static void check_bounds(const char *op, double (*sign)(double, double, double),
+                         double a, double b, interval r) {
+  interval x(a), y(b);
+  double s_lo, s_hi;
+
+  if(std::isnan(r.lo) || std::isnan(r.hi)) {
+    report_interval(op, x, y, r, "NaN bound");
+    return;
+  }
+  s_lo = std::isinf(r.lo) ? 1 : sign(a, b, r.lo);
+  s_hi = std::isinf(r.hi) ? -1 : sign(a, b, r.hi);
+  if(s_lo < 0 || s_hi > 0)
+    report_interval(op, x, y, r, "does not contain the exact result");
+  else if(s_lo == 0 ? r.hi != r.lo : r.hi != std::nextafter(r.lo, INFINITY))
+    report_interval(op, x, y, r, "not the smallest interval");
+}
+
+static void check_interval(const char *op, interval x, interval y,
+                           interval got, interval expected) {
+  if(!same(got.lo, expected.lo) || !same(got.hi, expected.hi))
+    report_interval(op, x, y, got, "wrong bounds");
+}
+
+static void check_intervals(void) {
+  const double max = 0x1.fffffffffffffp1023;
+  double a, b;
+  interval x, y;
+  int i;
+
+  /* + and - */
+  x = interval(1, 2);
+  y = interval(0x1p-60, 0x1p-60);
+  check_interval("+", x, y, x + y, interval(1, 0x1.0000000000001p1));
+  check_interval("-", x, y, x - y, interval(0x1.fffffffffffffp-1, 2));
+  x = interval(max, max);
+  check_interval("+", x, x, x + x, interval(max, INFINITY));
+  check_interval("-", -x, x, -x - x, interval(-INFINITY, -max));
+  x = interval(-INFINITY, 1);
+  y = interval(1, INFINITY);
+  check_interval("+", x, y, x + y, interval(-INFINITY, INFINITY));
+
+  /* * and / on random operands, some above 2^996. Below 2^-969, the
+     bounds may be one ulp wider (see crlibm.hpp): these are left out */
+  for(i = 0; i < NB_TESTS; i++) {
+    a = random_arg((int) (drand48()*1960) - 950);
+    b = random_arg((int) (drand48()*1960) - 950);
+    if(a == 0 || b == 0)
+      continue;
+    if(std::fabs(std::log2(std::fabs(a)) + std::log2(std::fabs(b))) < 900)
+      check_bounds("*", sign_mul, a, b, interval(a) * interval(b));
+    if(std::fabs(std::log2(std::fabs(a)) - std::log2(std::fabs(b))) < 900)
+      check_bounds("/", sign_div, a, std::fabs(b), interval(a) / interval(std::fabs(b)));
+  }
+
+  /* an operand above 2^996, for which Mul12 would overflow */
+  check_bounds("*", sign_mul, 0x1.8000000000001p1000, 0x1.0000000000003p-500,
+               interval(0x1.8000000000001p1000) * interval(0x1.0000000000003p-500));
+  check_bounds("*", sign_mul, 0x1.0000000000003p-500, -0x1.8000000000001p1000,
+               interval(0x1.0000000000003p-500) * interval(-0x1.8000000000001p1000));
+  check_bounds("/", sign_div, 0x1.8000000000001p1000, 0x1.0000000000003p-10,
+               interval(0x1.8000000000001p1000) / interval(0x1.0000000000003p-10));
+  check_bounds("/", sign_div, 0x1.5555555555555p1010, 0x1.0000000000003p1000,
+               interval(0x1.5555555555555p1010) / interval(0x1.0000000000003p1000));
+
+  /* overflows */
+  x = interval(0x1p1000, 0x1p1000);
+  y = interval(0x1.8p30, 0x1.8p30);
+  check_interval("*", x, y, x * y, interval(max, INFINITY));
+  check_interval("*", -x, y, -x * y, interval(-INFINITY, -max));
+  check_interval("/", x, 1/y, x / (1/y), interval(max, INFINITY));
+
+  /* 0 times an infinite bound is 0, and the zero bounds are -0 and +0 */
+  x = interval(0, 1);
+  y = interval(-INFINITY, 1);
+  check_interval("*", x, y, x * y, interval(-INFINITY, 1));
+  check_interval("*", y, x, y * x, interval(-INFINITY, 1));
+  x = interval(-0.0, 0);
+  y = interval(1, INFINITY);
+  check_interval("*", x, y, x * y, interval(-0.0, 0));
+  y = interval(-INFINITY, INFINITY);
+  check_interval("*", x, y, x * y, interval(-0.0, 0));
+  check_interval("*", y, y, y * y, interval(-INFINITY, INFINITY));
+  y = interval(1, 2);
+  check_interval("/", x, y, x / y, interval(-0.0, 0));
+
+  /* a divisor containing zero */
+  x = interval(1, 2);
+  y = interval(-1, 1);
+  check_interval("/", x, y, x / y, interval(-INFINITY, INFINITY));
+}
+
+
+
+/* The vector overloads */
+
+#if TEST_SIMD
+static void store(double *p, __m128d v) { _mm_storeu_pd(p, v); }
+static void load(__m128d *v, const double *p) { *v = _mm_loadu_pd(p); }
+#if defined(__AVX__)
+static void store(double *p, __m256d v) { _mm256_storeu_pd(p, v); }
+static void load(__m256d *v, const double *p) { *v = _mm256_loadu_pd(p); }
+#endif
+#if defined(__AVX512F__)
+static void store(double *p, __m512d v) { _mm512_storeu_pd(p, v); }
+static void load(__m512d *v, const double *p) { *v = _mm512_loadu_pd(p); }
+#endif
+
+/* vf(x) and the shorthand vs(x) against f in each lane of x */
+template <class V>
+static void check_vector(const char *name, const char *mode, V (*vf)(V), V (*vs)(const V&),
+                         double (*f)(double), int e) {
+  const int lanes = sizeof(V)/sizeof(double);
+  double x[8], r[8], s[8];
+  V v;
+  int i, j;
+
+  for(i = 0; i < (int) NB_SPECIAL + 200; i += lanes) {
+    for(j = 0; j < lanes; j++)
+      x[j] = (i + j < (int) NB_SPECIAL) ? special[i + j] : random_arg(e);
+    load(&v, x);
+    store(r, vf(v));
+    store(s, vs(v));
+    for(j = 0; j < lanes; j++) {
+      if(!same(r[j], f(x[j])))
+        report(name, mode, x[j], r[j], f(x[j]));
+      if(!same(s[j], f(x[j])))
+        report(name, mode, x[j], s[j], f(x[j]));
+    }
+  }
+}
+
+#if CRLIBM_HAS_STD_SIMD
+namespace stdx = std::experimental;
+
+/* Also a simd of 3 lanes, which is not a multiple of the registers */
+template <rounding R, class Abi>
+static void check_std_simd(const char *name, const char *mode,
+                           stdx::simd<double, Abi> (*vf)(const stdx::simd<double, Abi>&),
+                           double (*f)(double), int e) {
+  typedef stdx::simd<double, Abi> V;
+  double x[V::size()];
+  V r;
+  std::size_t i, j;
+
+  for(i = 0; i < 200; i++) {
+    for(j = 0; j < V::size(); j++)
+      x[j] = (i*V::size() + j < NB_SPECIAL) ? special[i*V::size() + j] : random_arg(e);
+    r = vf(V(x, stdx::element_aligned));
+    for(j = 0; j < V::size(); j++)
+      if(!same(r[j], f(x[j])))
+        report(name, mode, x[j], r[j], f(x[j]));
+  }
+}
+#define CHECK_STD_SIMD(f, R, mode, e)                                          \
+  check_std_simd<R>(#f, mode, crlibm::f<R, stdx::simd_abi::native<double>>, crlibm::f<R>, e); \
+  check_std_simd<R>(#f, mode, crlibm::f<R, stdx::simd_abi::fixed_size<3>>, crlibm::f<R>, e);
+#else
+#define CHECK_STD_SIMD(f, R, mode, e)
+#endif
+
+#define CHECK_VECTOR_TYPE(V, f, R, rx, mode, e)                                \
+  check_vector<V>(#f, mode, crlibm::f<R>, crlibm::f##_##rx<V>, crlibm::f<R>, e);
+
+#if defined(__AVX__)
+#define CHECK_VECTOR_256(f, R, rx, mode, e) CHECK_VECTOR_TYPE(__m256d, f, R, rx, mode, e)
+#else
+#define CHECK_VECTOR_256(f, R, rx, mode, e)
+#endif
+#if defined(__AVX512F__)
+#define CHECK_VECTOR_512(f, R, rx, mode, e) CHECK_VECTOR_TYPE(__m512d, f, R, rx, mode, e)
+#else
+#define CHECK_VECTOR_512(f, R, rx, mode, e)
+#endif
+
+#define CHECK_VECTOR_MODE(f, R, rx, mode, e)                                   \
+  CHECK_VECTOR_TYPE(__m128d, f, R, rx, mode, e)                                \
+  CHECK_VECTOR_256(f, R, rx, mode, e)                                          \
+  CHECK_VECTOR_512(f, R, rx, mode, e)                                          \
+  CHECK_STD_SIMD(f, R, mode, e)
+
+/* exp has no shorthand exp_rz: rounding::toward_zero is checked
+   against exp_rd through the scalar crlibm::exp */
+#define CHECK_VECTOR(f, e)                                                     \
+  CHECK_VECTOR_MODE(f, rounding::to_nearest, rn, "rn", e)                      \
+  CHECK_VECTOR_MODE(f, rounding::up, ru, "ru", e)                              \
+  CHECK_VECTOR_MODE(f, rounding::down, rd, "rd", e)
+
+#define CHECK_VECTOR_RZ(f, e)                                                  \
+  CHECK_VECTOR(f, e)                                                           \
+  CHECK_VECTOR_MODE(f, rounding::toward_zero, rz, "rz", e)
+
+static void check_vectors(void) {
+  CHECK_VECTOR(exp, 10)
+  CHECK_VECTOR_MODE(exp, rounding::toward_zero, rd, "rz", 10)
+  CHECK_VECTOR_RZ(log, 20)
+  CHECK_VECTOR_RZ(sin, 10)
+  CHECK_VECTOR_RZ(cos, 10)
+  CHECK_VECTOR_RZ(tan, 10)
+  CHECK_VECTOR_RZ(atan, 10)
+}
+#endif /* TEST_SIMD */
+
+
+
+int main(void) {
+#if defined(__AVX512F__)
+  if(!__builtin_cpu_supports("avx512f")) {
+    printf("C++ interface (AVX-512): not run on this processor\n");
+    return EXIT_SUCCESS;
+  }
+#elif defined(__AVX__)
+  if(!__builtin_cpu_supports("avx")) {
+    printf("C++ interface (AVX): not run on this processor\n");
+    return EXIT_SUCCESS;
+  }
+#endif
+
+  crlibm_init();
+  srand48(42);
+
+  check_mappings();
+#if CRLIBM_HAS_SPAN
+  check_spans();
+#endif
+  check_intervals();
+#if TEST_SIMD
+  check_vectors();
+#endif
+
+  printf("C++ interface: %lld errors\n", errors);
+  return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,317 @@
+/*
+ * Test of the double-double and triple-double results (exp_dd, exp_td etc)
+ *
+ * On random arguments of each function:
+ * - the high part must be the correctly rounded result f_rn(x), since
+ *   it is the rounding to nearest of the result of the accurate phase,
+ * - f_dd must return the high part and the sum of the lower parts of f_td,
+ * - identities between the triple-doubles must hold to 2^-100:
+ *   exp(x) exp(-x) = 1, log(x 2^k) = log(x) + k log(2),
+ *   log2(x) log(2) = log(x) (to 2^-114), sin(x)^2 + cos(x)^2 = 1,
+ *   atan(2^k) + atan(2^-k) = 2 atan(1), cosh(x)^2 - sinh(x)^2 = 1,
+ * - the functions of double-double arguments (exp_dd_rn etc) must
+ *   return f_rn(x) for xl = 0, and else the rounding of the Taylor
+ *   expansion in xl of f_td(xh), when this rounding is decided.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "triple-double.h"
+
+#define NB_TESTS 20000
+#define MAX_REPORTED 10
+#define TOLERANCE 0x1p-100
+#define MIDPOINT_MARGIN 0x1p-90
+
+typedef struct {
+  const char *name;
+  void (*td)(double *, double *, double *, double);
+  void (*dd)(double *, double *, double);
+  double (*rn)(double);
+  double min, max;   /* the arguments are drawn in [min, max] */
+} function_dd;
+
+static const function_dd functions[] = {
+  {"exp",  exp_td,  exp_dd,  exp_rn,    -700.0, 700.0},
+  {"log",  log_td,  log_dd,  log_rn,    1e-300, 1e300},
+  {"log2", log2_td, log2_dd, log2_rn,   1e-300, 1e300},
+  {"sin",  sin_td,  sin_dd,  sin_rn,    -1e10,  1e10},
+  {"cos",  cos_td,  cos_dd,  cos_rn,    -1e10,  1e10},
+  {"atan", atan_td, atan_dd, atan_rn,   -1e20,  1e20},
+  {"sinh", sinh_td, sinh_dd, sinh_rn,   -700.0, 700.0},
+  {"cosh", cosh_td, cosh_dd, cosh_rn,   -700.0, 700.0}
+};
+
+static long long errors = 0;
+
+static void report(const char *name, double x, const char *what) {
+  if(errors < MAX_REPORTED)
+    printf("ERROR for %s(%1.17e): %s\n", name, x, what);
+  errors++;
+}
+
+/* A random double of [min, max], logarithmically distributed when
+   the bounds are far apart */
+static double random_arg(double min, double max) {
+  double u = rand() / (RAND_MAX + 1.0);
+
+  if(min > 0)
+    return exp(log(min) + u * (log(max) - log(min)));
+  if(rand() & 1)
+    return u * max;
+  return u * min;
+}
+
+/* Whether a = b up to TOLERANCE * scale */
+static int close3(double ah, double am, double al,
+                  double bh, double bm, double bl, double scale) {
+  double th, tm, tl, rh, rm, rl;
+
+  Add33Cond(&th, &tm, &tl, ah, am, al, -bh, -bm, -bl);
+  Renormalize3(&rh, &rm, &rl, th, tm, tl);
+  return fabs(rh) <= TOLERANCE * scale;
+}
+
+/* Rounds h + m + l to nearest in *r, h being normalized; returns 0 if
+   the sum lies within MIDPOINT_MARGIN of a midpoint, relatively */
+static int round3(double h, double m, double l, double *r) {
+  double tail = m + l, next, gap;
+
+  next = nextafter(h, (tail > 0) ? 1.0/0.0 : -1.0/0.0);
+  gap = fabs(next - h);
+  if(fabs(fabs(tail) - gap/2) < MIDPOINT_MARGIN * fabs(h))
+    return 0;
+  *r = (fabs(tail) < gap/2) ? h : next;
+  return 1;
+}
+
+/* f(xh + xl) from the Taylor expansion in xl, to about 2^-100 */
+static void taylor_dd(const char *name, double xh, double xl,
+                      double *h, double *m, double *l) {
+  double ah, am, al, bh, bm, bl, ch, cm, cl, t;
+
+  switch(name[0]) {
+  case 'e':   /* exp(xh) (1 + xl + xl^2/2) */
+    exp_td(&ah, &am, &al, xh);
+    Mul33(&bh, &bm, &bl, ah, am, al, 1.0, xl, xl*xl*0.5);
+    Renormalize3(h, m, l, bh, bm, bl);
+    break;
+  case 'l':   /* log(xh) + t - t^2/2, t = xl/xh */
+    log_td(&ah, &am, &al, xh);
+    t = xl/xh;
+    Add133Cond(&bh, &bm, &bl, t - t*t*0.5, ah, am, al);
+    Renormalize3(h, m, l, bh, bm, bl);
+    break;
+  case 's':   /* sin(xh) + xl cos(xh) - xl^2/2 sin(xh) */
+    sin_td(&ah, &am, &al, xh);
+    cos_td(&bh, &bm, &bl, xh);
+    Mul133(&ch, &cm, &cl, xl, bh, bm, bl);
+    Add33Cond(&bh, &bm, &bl, ah, am, al, ch, cm, cl);
+    Add133Cond(&ch, &cm, &cl, -xl*xl*0.5*ah, bh, bm, bl);
+    Renormalize3(h, m, l, ch, cm, cl);
+    break;
+  default:    /* cos(xh) - xl sin(xh) - xl^2/2 cos(xh) */
+    cos_td(&ah, &am, &al, xh);
+    sin_td(&bh, &bm, &bl, xh);
+    Mul133(&ch, &cm, &cl, -xl, bh, bm, bl);
+    Add33Cond(&bh, &bm, &bl, ah, am, al, ch, cm, cl);
+    Add133Cond(&ch, &cm, &cl, -xl*xl*0.5*ah, bh, bm, bl);
+    Renormalize3(h, m, l, ch, cm, cl);
+  }
+}
+
+typedef struct {
+  const char *name;
+  double (*dd_rn)(double, double);
+  double (*rn)(double);
+  double min, max;
+} function_dd_rn;
+
+static const function_dd_rn functions_dd_rn[] = {
+  {"exp", exp_dd_rn, exp_rn, -600.0, 690.0},
+  {"log", log_dd_rn, log_rn, 1e-300, 1e300},
+  {"sin", sin_dd_rn, sin_rn, -100.0, 100.0},
+  {"cos", cos_dd_rn, cos_rn, -100.0, 100.0},
+  {"sin", sin_dd_rn, sin_rn, -0.02, 0.02},
+  {"cos", cos_dd_rn, cos_rn, -0.02, 0.02}
+};
+
+/* xh random in [min, max], xl random of at most ulp(xh)/2 */
+static void check_dd_rn(const function_dd_rn *f, double xh, double xl) {
+  double h, m, l, r, y;
+
+  y = f->dd_rn(xh, xl);
+  if(xl == 0) {
+    if(y != f->rn(xh))
+      report(f->name, xh, "f_dd_rn(x, 0) is not f_rn(x)");
+    return;
+  }
+  taylor_dd(f->name, xh, xl, &h, &m, &l);
+  if(round3(h, m, l, &r) && y != r) {
+    if(errors < MAX_REPORTED)
+      printf("ERROR for %s_dd_rn(%1.17e, %1.17e): %1.17e instead of %1.17e\n",
+             f->name, xh, xl, y, r);
+    errors++;
+  }
+}
+
+static void check_identities(double x) {
+  double ah, am, al, bh, bm, bl, ch, cm, cl, dh, dm, dl, eh, em, el;
+  double scale;
+  int k;
+
+  /* exp(x) exp(-x) = 1, where the lower parts of exp(-x) are normal */
+  if(fabs(x) < 634) {
+    exp_td(&ah, &am, &al, x);
+    exp_td(&bh, &bm, &bl, -x);
+    Mul33(&ch, &cm, &cl, ah, am, al, bh, bm, bl);
+    if(!close3(ch, cm, cl, 1.0, 0, 0, 1.0))
+      report("exp", x, "exp(x) exp(-x) != 1");
+  }
+
+  /* sin(x)^2 + cos(x)^2 = 1 */
+  sin_td(&ah, &am, &al, x);
+  cos_td(&bh, &bm, &bl, x);
+  Mul33(&ch, &cm, &cl, ah, am, al, ah, am, al);
+  Mul33(&dh, &dm, &dl, bh, bm, bl, bh, bm, bl);
+  Add33Cond(&eh, &em, &el, ch, cm, cl, dh, dm, dl);
+  if(!close3(eh, em, el, 1.0, 0, 0, 1.0))
+    report("sin", x, "sin(x)^2 + cos(x)^2 != 1");
+
+  /* cosh(x)^2 - sinh(x)^2 = 1, to TOLERANCE relative to cosh(x)^2 */
+  if(fabs(x) < 20) {
+    sinh_td(&ah, &am, &al, x);
+    cosh_td(&bh, &bm, &bl, x);
+    Mul33(&ch, &cm, &cl, ah, am, al, ah, am, al);
+    Mul33(&dh, &dm, &dl, bh, bm, bl, bh, bm, bl);
+    Add33Cond(&eh, &em, &el, dh, dm, dl, -ch, -cm, -cl);
+    if(!close3(eh, em, el, 1.0, 0, 0, dh))
+      report("cosh", x, "cosh(x)^2 - sinh(x)^2 != 1");
+  }
+
+  if(x > 0) {
+    /* log(x 2^k) = log(x) + k log(2), to TOLERANCE relative to the terms */
+    k = (rand() % 201) - 100;
+    log_td(&ah, &am, &al, ldexp(x, k));
+    log_td(&bh, &bm, &bl, x);
+    log_td(&ch, &cm, &cl, 2.0);
+    Mul133(&dh, &dm, &dl, (double) k, ch, cm, cl);
+    Add33Cond(&eh, &em, &el, bh, bm, bl, dh, dm, dl);
+    scale = fabs(bh) + fabs(dh);
+    if(!close3(ah, am, al, eh, em, el, scale))
+      report("log", x, "log(x 2^k) != log(x) + k log(2)");
+
+    /* log2(x) log(2) = log(x), to 2^-114 relative to log(x): both are
+       within 2^-117, and a double-double 1/ln(2) would give 2^-110 */
+    log2_td(&ah, &am, &al, x);
+    Mul33(&dh, &dm, &dl, ah, am, al, ch, cm, cl);
+    if(!close3(dh, dm, dl, bh, bm, bl, fabs(bh) * (0x1p-114 / TOLERANCE)))
+      report("log2", x, "log2(x) log(2) != log(x)");
+  }
+}
+
+int main(int argc, char *argv[]) {
+  double x, h, m, l, dh, dl;
+  unsigned int f;
+  int i, k;
+
+  crlibm_init();
+  srand(42);
+
+  for(f = 0; f < sizeof(functions)/sizeof(functions[0]); f++)
+    for(i = 0; i < NB_TESTS; i++) {
+      x = random_arg(functions[f].min, functions[f].max);
+      functions[f].td(&h, &m, &l, x);
+      functions[f].dd(&dh, &dl, x);
+      if(h != functions[f].rn(x))
+        report(functions[f].name, x, "high part is not f_rn(x)");
+      if(dh != h || dl != m + l)
+        report(functions[f].name, x, "f_dd differs from f_td");
+    }
+
+  for(i = 0; i < NB_TESTS; i++)
+    check_identities(random_arg(-700.0, 700.0));
+
+  for(f = 0; f < sizeof(functions_dd_rn)/sizeof(functions_dd_rn[0]); f++)
+    for(i = 0; i < NB_TESTS; i++) {
+      x = random_arg(functions_dd_rn[f].min, functions_dd_rn[f].max);
+      check_dd_rn(&functions_dd_rn[f], x, 0);
+      dl = (rand() / (RAND_MAX + 1.0) - 0.5) * (nextafter(x, 1.0/0.0) - x);
+      check_dd_rn(&functions_dd_rn[f], x, dl);
+    }
+  /* Arguments reduced by the SCS reduction, with xl small enough for
+     the Taylor expansion */
+  for(i = 0; i < NB_TESTS/10; i++) {
+    x = random_arg(1e10, 1e300);
+    dl = (rand() / (RAND_MAX + 1.0) - 0.5) * 0x1p-40;
+    check_dd_rn(&functions_dd_rn[2], x, dl);
+    check_dd_rn(&functions_dd_rn[3], -x, dl);
+  }
+  /* Overflow and underflow thresholds of exp_dd_rn */
+  x = 7.09782712893383973096206318587064743041992187500000e+02;
+  if(exp_dd_rn(x, 0x1.aac9e3b39803fp-46) != 0x1.fffffffffffffp+1023
+     || exp_dd_rn(x, 0x1.aac9e3b398040p-46) != 1.0/0.0)
+    report("exp_dd_rn", x, "wrong overflow threshold");
+  x = -7.45133219101941222106688655912876129150390625000000e+02;
+  if(exp_dd_rn(x, 0x1.04e7ce353629dp-46) != 0
+     || exp_dd_rn(x, 0x1.04e7ce353629ep-46) != 0x1p-1074)
+    report("exp_dd_rn", x, "wrong underflow threshold");
+  if(exp_dd_rn(0.0, 0.0) != 1.0 || log_dd_rn(1.0, 0.0) != 0
+     || cos_dd_rn(0.0, 0.0) != 1.0 || sin_dd_rn(0.0, 0.0) != 0)
+    report("dd_rn", 0.0, "wrong exact case");
+
+  /* atan(2^k) + atan(2^-k) = 2 atan(1) */
+  atan_td(&dh, &m, &l, 1.0);
+  for(k = 0; k <= 1023; k++) {
+    double ah, am, al, bh, bm, bl, ch, cm, cl;
+    atan_td(&ah, &am, &al, ldexp(1.0, k));
+    atan_td(&bh, &bm, &bl, ldexp(1.0, -k));
+    Add33Cond(&ch, &cm, &cl, ah, am, al, bh, bm, bl);
+    if(!close3(ch, cm, cl, 2*dh, 2*m, 2*l, 1.0))
+      report("atan", ldexp(1.0, k), "atan(x) + atan(1/x) != 2 atan(1)");
+  }
+
+  /* Special cases */
+  exp_td(&h, &m, &l, 0.0);
+  if(h != 1.0 || m != 0 || l != 0)
+    report("exp", 0.0, "not exactly 1");
+  log_td(&h, &m, &l, 1.0);
+  if(h != 0 || m != 0 || l != 0)
+    report("log", 1.0, "not exactly 0");
+  cosh_td(&h, &m, &l, 0.0);
+  if(h != 1.0 || m != 0 || l != 0)
+    report("cosh", 0.0, "not exactly 1");
+  x = 1.0/0.0;
+  exp_td(&h, &m, &l, -x);
+  if(h != 0 || m != 0 || l != 0)
+    report("exp", -x, "not 0");
+  atan_td(&h, &m, &l, x);
+  if(h != atan_rn(x) || m == 0)
+    report("atan", x, "not Pi/2");
+  log_td(&h, &m, &l, -1.0);
+  if(h == h)
+    report("log", -1.0, "not NaN");
+
+  printf("double-double and triple-double functions: %lld errors\n", errors);
+  return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
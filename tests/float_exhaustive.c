@@ -0,0 +1,212 @@
+/*
+ * Exhaustive test of the binary32 functions (expf_rn etc)
+ *
+ * Every float x (or one out of stride) is checked, in the four
+ * rounding modes, against the double function rounded to odd (exp_ro
+ * etc) and then to float by float_from_ro, which is a correct double
+ * rounding. The batch versions are checked on the same inputs. The
+ * inputs are split in blocks, which are distributed over a number of
+ * threads.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or 
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#define BLOCK 4096
+#define MAX_THREADS 256
+#define MAX_REPORTED 10
+
+typedef struct {
+  char *name;
+  double (*ro)(double);
+  float (*f[4])(float);
+  void (*batch[4])(float *, const float *, int);
+} float_function;
+
+/* In the order of the modes CRLIBM_RN, CRLIBM_RU, CRLIBM_RD, CRLIBM_RZ */
+#define FLOAT_FUNCTION(f, d) \
+  {#f, d##_ro, {f##_rn, f##_ru, f##_rd, f##_rz}, \
+   {f##_rn_batch, f##_ru_batch, f##_rd_batch, f##_rz_batch}}
+
+static float_function functions[] = {
+  FLOAT_FUNCTION(expf, exp),
+  FLOAT_FUNCTION(expm1f, expm1),
+  FLOAT_FUNCTION(logf, log),
+  FLOAT_FUNCTION(log1pf, log1p),
+  FLOAT_FUNCTION(sinf, sin),
+  FLOAT_FUNCTION(cosf, cos),
+  FLOAT_FUNCTION(atanf, atan),
+};
+
+#define NB_FUNCTIONS ((int) (sizeof(functions)/sizeof(functions[0])))
+
+static const char *mode_names[4] = {"RN", "RU", "RD", "RZ"};
+
+/* The test in progress, shared by the threads */
+static float_function *fun;
+static unsigned long long stride, nb_inputs, nb_blocks;
+static int nb_threads;
+static long long errors[MAX_THREADS];
+#ifdef HAVE_PTHREAD_H
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static int reported;
+
+typedef union {float f; unsigned int i;} float_bits;
+
+static int same_float(float a, float b) {
+  float_bits ua, ub;
+  ua.f = a;
+  ub.f = b;
+  return (ua.i == ub.i) || ((a != a) && (b != b));
+}
+
+static void report(const char *version, int mode, float x, float res, float expected) {
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock(&report_lock);
+#endif
+  if(reported < MAX_REPORTED)
+    printf("ERROR for %s%s_%s(%a): %a instead of %a\n",
+           fun->name, version, mode_names[mode], x, res, expected);
+  reported++;
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock(&report_lock);
+#endif
+}
+
+/* Thread t checks the blocks t, t+nb_threads, etc */
+static void *check_blocks(void *arg) {
+  float x[BLOCK], expected[4][BLOCK], res[BLOCK], r;
+  float_bits xb;
+  double ro;
+  unsigned long long b, j;
+  int t, n, i, mode;
+
+  t = (int) (long) arg;
+  for(b=t; b<nb_blocks; b+=nb_threads) {
+    n = 0;
+    for(j=b*BLOCK; j<(b+1)*BLOCK && j<nb_inputs; j++) {
+      xb.i = (unsigned int) (j*stride);
+      x[n] = xb.f;
+      ro = fun->ro(x[n]);
+      for(mode=0; mode<4; mode++) {
+        expected[mode][n] = float_from_ro(ro, mode);
+        r = fun->f[mode](x[n]);
+        if(!same_float(r, expected[mode][n])) {
+          report("", mode, x[n], r, expected[mode][n]);
+          errors[t]++;
+        }
+      }
+      n++;
+    }
+    for(mode=0; mode<4; mode++) {
+      fun->batch[mode](res, x, n);
+      for(i=0; i<n; i++)
+        if(!same_float(res[i], expected[mode][i])) {
+          report("_batch", mode, x[i], res[i], expected[mode][i]);
+          errors[t]++;
+        }
+    }
+  }
+  return NULL;
+}
+
+static void usage(char *prog_name) {
+  int i;
+  fprintf(stderr, "\nUsage: %s [-t threads] [-s stride] [function ...]\n", prog_name);
+  fprintf(stderr, "  checks every stride-th float (default 1: all of them)\n");
+  fprintf(stderr, "  function in: ");
+  for(i=0; i<NB_FUNCTIONS; i++)
+    fprintf(stderr, "%s ", functions[i].name);
+  fprintf(stderr, "(default: all)\n\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[]) {
+#ifdef HAVE_PTHREAD_H
+  pthread_t threads[MAX_THREADS];
+#endif
+  int selected[NB_FUNCTIONS];
+  long long total_errors;
+  int i, t, opt, any;
+
+  stride = 1;
+#ifdef HAVE_PTHREAD_H
+  nb_threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#else
+  nb_threads = 1;
+#endif
+  while((opt = getopt(argc, argv, "t:s:")) != -1) {
+    if(opt == 't')      nb_threads = atoi(optarg);
+    else if(opt == 's') stride = strtoull(optarg, NULL, 0);
+    else                usage(argv[0]);
+  }
+  if(nb_threads < 1) nb_threads = 1;
+  if(nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+#ifndef HAVE_PTHREAD_H
+  nb_threads = 1;
+#endif
+  if(stride < 1) usage(argv[0]);
+
+  any = (optind < argc);
+  for(i=0; i<NB_FUNCTIONS; i++)
+    selected[i] = !any;
+  for(; optind<argc; optind++) {
+    for(i=0; i<NB_FUNCTIONS; i++)
+      if(strcmp(argv[optind], functions[i].name) == 0)
+        break;
+    if(i == NB_FUNCTIONS) usage(argv[0]);
+    selected[i] = 1;
+  }
+
+  crlibm_init();
+  nb_inputs = ((1ULL<<32) + stride - 1) / stride;
+  nb_blocks = (nb_inputs + BLOCK - 1) / BLOCK;
+
+  total_errors = 0;
+  for(i=0; i<NB_FUNCTIONS; i++) {
+    if(!selected[i]) continue;
+    fun = &functions[i];
+    reported = 0;
+    memset(errors, 0, sizeof(errors));
+#ifdef HAVE_PTHREAD_H
+    for(t=0; t<nb_threads; t++)
+      pthread_create(&threads[t], NULL, check_blocks, (void *) (long) t);
+    for(t=0; t<nb_threads; t++)
+      pthread_join(threads[t], NULL);
+#else
+    check_blocks((void *) 0);
+#endif
+    for(t=1; t<nb_threads; t++)
+      errors[0] += errors[t];
+    printf("%s: %llu inputs, %lld errors\n", fun->name, nb_inputs, errors[0]);
+    fflush(stdout);
+    total_errors += errors[0];
+  }
+
+  return (total_errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
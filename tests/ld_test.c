@@ -0,0 +1,309 @@
+/*
+ * Test of the long double functions (expl_rn etc)
+ *
+ * - a few arguments whose results were computed with exact rational
+ *   arithmetic: large and subnormal results of expl, logl near 1 and
+ *   of a subnormal, sinl and cosl near Pi/2 and of huge arguments,
+ * - the special cases,
+ * - on random arguments, the four roundings of each result must be
+ *   those of one value: RD and RU consecutive (no result is exact),
+ *   RN one of them and RZ the one toward zero; RN must be within one
+ *   ulp of the long double function of the libm; the results must not
+ *   depend on the precision control of the x87 unit (crlibm_init sets
+ *   it to double),
+ * - if MPFR is available, the four roundings against MPFR.
+ *
+ * With -b, times crlibm against the libm instead.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+
+#if (defined(CRLIBM_TYPECPU_X86) || defined(CRLIBM_TYPECPU_AMD64)) && defined(CRLIBM_HAS_FPU_CONTROL)
+
+#include <fpu_control.h>
+#include "scs_lib/tests/tbx_timing.h"
+
+#ifdef HAVE_MPFR_H
+#include <gmp.h>
+#include <mpfr.h>
+#endif
+
+#define NB_TESTS 20000
+#define NB_BENCH 100000
+#define MAX_REPORTED 10
+
+typedef long double (*function_ld)(long double);
+
+typedef struct {
+  const char *name;
+  function_ld f[4];     /* in the order of CRLIBM_RN, RU, RD, RZ */
+  function_ld libm;
+  long double min, max; /* the arguments are drawn in [min, max] */
+  int logscale;         /* or in [2^min, 2^max] */
+#ifdef HAVE_MPFR_H
+  int (*mpfr)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+#endif
+} function_ldt;
+
+#ifdef HAVE_MPFR_H
+#define MPFR(f) , f
+#else
+#define MPFR(f)
+#endif
+
+static const function_ldt functions[] = {
+  {"expl", {expl_rn, expl_ru, expl_rd, expl_rz}, expl, -11390.0L, 11350.0L, 0 MPFR(mpfr_exp)},
+  {"expl", {expl_rn, expl_ru, expl_rd, expl_rz}, expl, -1.0L, 1.0L, 0 MPFR(mpfr_exp)},
+  {"logl", {logl_rn, logl_ru, logl_rd, logl_rz}, logl, -16400.0L, 16383.0L, 1 MPFR(mpfr_log)},
+  {"logl", {logl_rn, logl_ru, logl_rd, logl_rz}, logl, 0.99L, 1.01L, 0 MPFR(mpfr_log)},
+  {"sinl", {sinl_rn, sinl_ru, sinl_rd, sinl_rz}, sinl, -100.0L, 100.0L, 0 MPFR(mpfr_sin)},
+  {"sinl", {sinl_rn, sinl_ru, sinl_rd, sinl_rz}, sinl, -30.0L, 3000.0L, 1 MPFR(mpfr_sin)},
+  {"cosl", {cosl_rn, cosl_ru, cosl_rd, cosl_rz}, cosl, -100.0L, 100.0L, 0 MPFR(mpfr_cos)},
+  {"cosl", {cosl_rn, cosl_ru, cosl_rd, cosl_rz}, cosl, -30.0L, 3000.0L, 1 MPFR(mpfr_cos)}
+};
+
+#define NB_FUNCTIONS (sizeof(functions)/sizeof(functions[0]))
+
+static const char *mode_names[] = {"rn", "ru", "rd", "rz"};
+
+static long long errors = 0;
+
+static void report(const char *name, int mode, long double x,
+                   long double got, long double expected, const char *what) {
+  if(errors < MAX_REPORTED)
+    printf("ERROR for %s_%s(%La): %La instead of %La (%s)\n",
+           name, mode_names[mode], x, got, expected, what);
+  errors++;
+}
+
+/* A random long double of [min, max], or of [2^min, 2^max] */
+static long double random_arg(const function_ldt *f) {
+  long double u = (drand48() + drand48()*0x1p-48L)*(f->max - f->min) + f->min;
+  if(f->logscale)
+    return ldexpl(1.0L + (u - floorl(u)), (int) floorl(u));
+  return u;
+}
+
+/* Results computed with exact rational arithmetic: x, f_rn(x), f_rd(x),
+   f_ru(x) being the long double after f_rd(x) */
+static const struct {
+  int fn;   /* 0 for expl, 1 for logl, 2 for sinl, 3 for cosl */
+  long double x, rn, rd;
+} reference[] = {
+  {0, 0x8000000000000000p-63L, 0xadf85458a2bb4a9bp-62L, 0xadf85458a2bb4a9ap-62L},
+  {0, -0xc000000000000000p-66L, 0xd43b4096043bde03p-64L, 0xd43b4096043bde02p-64L},
+  {0, 0xb17217f7d1cf4000p-50L, 0xfffffffff1950d87p+16320L, 0xfffffffff1950d87p+16320L},
+  {0, -0xb1f8000000000000p-50L, 0xd070000000000000p-16496L, 0xd070000000000000p-16496L},
+  {0, -0xb17217f7d1cf79acp-50L, 0xfffffffffffff278p-16448L, 0xfffffffffffff278p-16448L},
+  {1, 0x8000000000000001p-63L, 0xffffffffffffffffp-127L, 0xffffffffffffffffp-127L},
+  {1, 0xffffffffffffffffp-64L, -0x8000000000000000p-127L, -0x8000000000000001p-127L},
+  {1, 0x8000000000000000p-16508L, -0xb21b38b6aa03736cp-50L, -0xb21b38b6aa03736cp-50L},
+  {1, 0xabcdef0123456789p+3940L, 0xad6f665c3b15be90p-52L, 0xad6f665c3b15be8fp-52L},
+  {1, 0xc000000000000000p-62L, 0x8c9f53d5681854bbp-63L, 0x8c9f53d5681854bbp-63L},
+  {2, 0x8000000000000000p-63L, 0xd76aa47848677021p-64L, 0xd76aa47848677020p-64L},
+  {2, 0xc90fdaa22168c000p-63L, 0x8000000000000000p-63L, 0xffffffffffffffffp-64L},
+  {2, 0xc90fdaa22168c235p-63L, 0x8000000000000000p-63L, 0xffffffffffffffffp-64L},
+  {2, 0x8000000000000000p+15937L, 0xb301c733f168e24ep-64L, 0xb301c733f168e24dp-64L},
+  {2, -0x91a2800000000000p-3L, 0xbc7d0fb6d9271a54p-64L, 0xbc7d0fb6d9271a54p-64L},
+  {3, 0x8000000000000000p-63L, 0x8a51407da8345c92p-64L, 0x8a51407da8345c91p-64L},
+  {3, 0xc90fdaa22168c235p-63L, -0xece675d1fc8f8cbbp-129L, -0xece675d1fc8f8cbcp-129L},
+  {3, 0x8000000000000000p+16320L, 0xebcc2fc82ae39ec0p-64L, 0xebcc2fc82ae39ebfp-64L},
+  {3, -0x8ac7230489e80000p+3L, -0xff6beb2ad36e1f2cp-64L, -0xff6beb2ad36e1f2cp-64L},
+  {3, 0xc800000000000000p-59L, 0xfdbf77aca827f8c6p-64L, 0xfdbf77aca827f8c5p-64L},
+};
+
+static const function_ld reference_functions[4][4] = {
+  {expl_rn, expl_ru, expl_rd, expl_rz},
+  {logl_rn, logl_ru, logl_rd, logl_rz},
+  {sinl_rn, sinl_ru, sinl_rd, sinl_rz},
+  {cosl_rn, cosl_ru, cosl_rd, cosl_rz}
+};
+static const char *reference_names[] = {"expl", "logl", "sinl", "cosl"};
+
+static void check_reference(void) {
+  long double x, r[4], got;
+  unsigned int i;
+  int mode;
+
+  for(i = 0; i < sizeof(reference)/sizeof(reference[0]); i++) {
+    x = reference[i].x;
+    r[CRLIBM_RN] = reference[i].rn;
+    r[CRLIBM_RD] = reference[i].rd;
+    r[CRLIBM_RU] = nextafterl(r[CRLIBM_RD], INFINITY);
+    r[CRLIBM_RZ] = (r[CRLIBM_RD] >= 0) ? r[CRLIBM_RD] : r[CRLIBM_RU];
+    for(mode = 0; mode < 4; mode++) {
+      got = reference_functions[reference[i].fn][mode](x);
+      if(got != r[mode])
+        report(reference_names[reference[i].fn], mode, x, got, r[mode], "reference");
+    }
+  }
+}
+
+static void check_special(void) {
+  static const struct {
+    int fn;
+    long double x, y;
+  } special[] = {
+    {0, 0.0L, 1.0L}, {0, -0.0L, 1.0L}, {0, INFINITY, INFINITY}, {0, -INFINITY, 0.0L},
+    {1, 1.0L, 0.0L}, {1, 0.0L, -INFINITY}, {1, INFINITY, INFINITY},
+    {2, 0.0L, 0.0L}, {2, -0.0L, -0.0L}, {3, 0.0L, 1.0L}
+  };
+  unsigned int i;
+  long double y;
+  int mode;
+
+  for(i = 0; i < sizeof(special)/sizeof(special[0]); i++)
+    for(mode = 0; mode < 4; mode++) {
+      y = reference_functions[special[i].fn][mode](special[i].x);
+      if(y != special[i].y || signbit(y) != signbit(special[i].y))
+        report(reference_names[special[i].fn], mode, special[i].x, y, special[i].y, "special");
+    }
+  for(mode = 0; mode < 4; mode++) {
+    if(!isnan(logl_rn(-1.0L)) || !isnan(sinl_rn(INFINITY)) || !isnan(cosl_rn(NAN))
+       || !isnan(reference_functions[1][mode](-1.0L)) || !isnan(reference_functions[0][mode](NAN)))
+      report("nan", mode, 0, 0, NAN, "special");
+    /* overflow and underflow of expl */
+    y = reference_functions[0][mode](20000.0L);
+    if(y != ((mode == CRLIBM_RN || mode == CRLIBM_RU) ? INFINITY : LDBL_MAX))
+      report("expl", mode, 20000.0L, y, INFINITY, "overflow");
+    y = reference_functions[0][mode](-20000.0L);
+    if(y != ((mode == CRLIBM_RU) ? 0x1p-16445L : 0.0L))
+      report("expl", mode, -20000.0L, y, 0.0L, "underflow");
+  }
+}
+
+static void check_random(const function_ldt *f, unsigned short cw) {
+  long double x, r[4], next, lib;
+  int i, mode;
+
+  for(i = 0; i < NB_TESTS; i++) {
+    x = random_arg(f);
+    for(mode = 0; mode < 4; mode++)
+      r[mode] = f->f[mode](x);
+
+    if(nextafterl(r[CRLIBM_RD], INFINITY) != r[CRLIBM_RU])
+      report(f->name, CRLIBM_RU, x, r[CRLIBM_RU], nextafterl(r[CRLIBM_RD], INFINITY), "order");
+    if(r[CRLIBM_RN] != r[CRLIBM_RD] && r[CRLIBM_RN] != r[CRLIBM_RU])
+      report(f->name, CRLIBM_RN, x, r[CRLIBM_RN], r[CRLIBM_RD], "order");
+    next = (r[CRLIBM_RD] >= 0) ? r[CRLIBM_RD] : r[CRLIBM_RU];
+    if(r[CRLIBM_RZ] != next)
+      report(f->name, CRLIBM_RZ, x, r[CRLIBM_RZ], next, "order");
+
+    /* the libm in extended precision, crlibm in double precision */
+    _FPU_SETCW(cw);
+    lib = f->libm(x);
+    crlibm_init();
+    if(r[CRLIBM_RN] != lib
+       && nextafterl(r[CRLIBM_RN], INFINITY) != lib && nextafterl(r[CRLIBM_RN], -INFINITY) != lib)
+      report(f->name, CRLIBM_RN, x, r[CRLIBM_RN], lib, "libm");
+    if(f->f[CRLIBM_RN](x) != r[CRLIBM_RN])
+      report(f->name, CRLIBM_RN, x, f->f[CRLIBM_RN](x), r[CRLIBM_RN], "precision control");
+    _FPU_SETCW(cw);
+
+#ifdef HAVE_MPFR_H
+    {
+      static const mpfr_rnd_t rnd[4] = {GMP_RNDN, GMP_RNDU, GMP_RNDD, GMP_RNDZ};
+      mpfr_t mx, my;
+      long double y;
+      int inex;
+
+      mpfr_set_emin(-16444);
+      mpfr_set_emax(16384);
+      mpfr_init2(mx, 64);
+      mpfr_init2(my, 64);
+      mpfr_set_ld(mx, x, GMP_RNDN);
+      for(mode = 0; mode < 4; mode++) {
+        inex = f->mpfr(my, mx, rnd[mode]);
+        inex = mpfr_subnormalize(my, inex, rnd[mode]);
+        y = mpfr_get_ld(my, rnd[mode]);
+        if(y != r[mode])
+          report(f->name, mode, x, r[mode], y, "mpfr");
+      }
+      mpfr_clear(mx);
+      mpfr_clear(my);
+    }
+#endif
+  }
+}
+
+/* The time of n calls of f, in ticks per call */
+static double bench(function_ld f, const long double *x, int n) {
+  tbx_tick_t t1, t2;
+  volatile long double y;
+  int i;
+
+  TBX_GET_TICK(t1);
+  for(i = 0; i < n; i++)
+    y = f(x[i]);
+  TBX_GET_TICK(t2);
+  (void) y;
+  return (double) TBX_TICK_RAW_DIFF(t1, t2) / n;
+}
+
+int main(int argc, char *argv[]) {
+  unsigned short cw;
+  unsigned int i;
+  long double *x;
+  int j;
+
+  /* the control word of the libm, with extended precision */
+  _FPU_GETCW(cw);
+  srand48(42);
+
+  if(argc == 2 && strcmp(argv[1], "-b") == 0) {
+    x = malloc(NB_BENCH*sizeof(long double));
+    if(x == NULL)
+      return EXIT_FAILURE;
+    for(i = 0; i < NB_FUNCTIONS; i++) {
+      for(j = 0; j < NB_BENCH; j++)
+        x[j] = random_arg(&functions[i]);
+      printf("%s in [%Lg, %Lg]%s: crlibm %.1f, libm %.1f ticks\n",
+             functions[i].name, functions[i].min, functions[i].max,
+             functions[i].logscale ? " (exponents)" : "",
+             bench(functions[i].f[CRLIBM_RN], x, NB_BENCH),
+             bench(functions[i].libm, x, NB_BENCH));
+    }
+    free(x);
+    return EXIT_SUCCESS;
+  }
+
+  check_reference();
+  check_special();
+  for(i = 0; i < NB_FUNCTIONS; i++)
+    check_random(&functions[i], cw);
+
+  printf("long double functions: %lld errors\n", errors);
+  return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+int main(void) {
+  printf("long double functions: not built on this processor\n");
+  return EXIT_SUCCESS;
+}
+
+#endif
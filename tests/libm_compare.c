@@ -0,0 +1,381 @@
+/*
+ * Comparison of the double functions of crlibm with other libraries
+ *
+ * For each function, in round to nearest, on the arguments of
+ * test_perf (the rand_for_* generators of test_common.c), the same
+ * arguments for all, the following are compared:
+ *
+ * - crlibm: f_rn, one call at a time,
+ * - crlibm_batch: f_rn_batch, for the functions which have one,
+ * - libm: the function of the system libm,
+ * - libmvec2, libmvec4: the vector variants of glibc's libmvec, on two
+ *   doubles (SSE2) and four doubles (AVX2, if the processor has it),
+ *   when configure found libmvec,
+ * - mpfr: the MPFR function at 53 bits, with the conversions,
+ *
+ * each by its time per argument, the median over blocks of BLOCK
+ * arguments, in ticks (cycles on most processors), and by its largest
+ * error in ulps over the arguments. With MPFR the error is measured
+ * against a 200-bit result; without, it is the distance in ulps to
+ * the correctly rounded result of crlibm.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+
+#include "scs_lib/tests/tbx_timing.h"
+
+#ifdef HAVE_MPFR_H
+#include <gmp.h>
+#include <mpfr.h>
+#endif
+
+#define DEFAULT_SAMPLES 4096
+#define BLOCK 64
+
+/* The functions which have a counterpart in the C99 libm */
+static const char *function_names[] = {
+  "exp", "log", "log2", "log10", "expm1", "log1p",
+  "sin", "cos", "tan", "atan",
+  "sinh", "cosh", "asin", "acos", "pow"
+};
+#define NB_FUNCTIONS (sizeof(function_names)/sizeof(function_names[0]))
+
+#if defined(HAVE_LIBMVEC) && defined(__x86_64__)
+#define USE_LIBMVEC
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef double v4df __attribute__ ((vector_size (32)));
+
+/* The variants of libmvec. They are declared without their vector
+   types, which change the calling convention of the code they appear
+   in, and only given them in the loops below. */
+#define LIBMVEC(f) {#f, _ZGVbN2v_##f, _ZGVdN4v_##f}
+#define LIBMVEC_DECLARE(f) extern void _ZGVbN2v_##f(void), _ZGVdN4v_##f(void)
+LIBMVEC_DECLARE(exp);  LIBMVEC_DECLARE(log);   LIBMVEC_DECLARE(log2);
+LIBMVEC_DECLARE(log10); LIBMVEC_DECLARE(expm1); LIBMVEC_DECLARE(log1p);
+LIBMVEC_DECLARE(sin);  LIBMVEC_DECLARE(cos);   LIBMVEC_DECLARE(tan);
+LIBMVEC_DECLARE(atan); LIBMVEC_DECLARE(sinh);  LIBMVEC_DECLARE(cosh);
+LIBMVEC_DECLARE(asin); LIBMVEC_DECLARE(acos);
+
+static const struct {
+  const char *name;
+  void (*v2)(void);
+  void (*v4)(void);
+} libmvec_functions[] = {
+  LIBMVEC(exp), LIBMVEC(log), LIBMVEC(log2), LIBMVEC(log10), LIBMVEC(expm1),
+  LIBMVEC(log1p), LIBMVEC(sin), LIBMVEC(cos), LIBMVEC(tan), LIBMVEC(atan),
+  LIBMVEC(sinh), LIBMVEC(cosh), LIBMVEC(asin), LIBMVEC(acos)
+};
+#define NB_LIBMVEC (sizeof(libmvec_functions)/sizeof(libmvec_functions[0]))
+#endif
+
+/* The time of two consecutive time stamps */
+static unsigned long long tbx_time;
+
+static int nbarg;
+static double *x, *y, *res, *cr, *ticks;
+
+/* The libraries, in the order of the report */
+enum {CRLIBM, CRLIBM_BATCH, LIBM, LIBMVEC2, LIBMVEC4, MPFR, NB_LIBRARIES};
+static const char *library_names[] = {
+  "crlibm", "crlibm_batch", "libm", "libmvec2", "libmvec4", "mpfr"
+};
+
+/* What the library to measure is, for compute() */
+static double (*scalar_fun)();
+static void (*batch_fun)(double *, const double *, int);
+#ifdef USE_LIBMVEC
+static void (*vector_fun)(void);
+#endif
+#ifdef HAVE_MPFR_H
+static int (*mpfr_fun)();
+static mpfr_t mp_res, mp_inpt, mp_inpt2, mp_err;
+static mpfr_t *reference;
+#endif
+
+
+static void usage(const char *name) {
+  bench_usage(name, "", 0, "arguments", DEFAULT_SAMPLES);
+  exit(EXIT_FAILURE);
+}
+
+#ifdef USE_LIBMVEC
+static void libmvec2_block(double *r, const double *a, int n) {
+  v2df (*f)(v2df) = (v2df (*)(v2df)) vector_fun;
+  v2df u;
+  int i;
+
+  for(i = 0; i < n; i += 2) {
+    memcpy(&u, a + i, sizeof(u));
+    u = f(u);
+    memcpy(r + i, &u, sizeof(u));
+  }
+}
+
+__attribute__ ((target ("avx2")))
+static void libmvec4_block(double *r, const double *a, int n) {
+  v4df (*f)(v4df) = (v4df (*)(v4df)) vector_fun;
+  v4df u;
+  int i;
+
+  for(i = 0; i < n; i += 4) {
+    memcpy(&u, a + i, sizeof(u));
+    u = f(u);
+    memcpy(r + i, &u, sizeof(u));
+  }
+}
+#endif
+
+/* res[i] for i in [start, start+n), n a multiple of 4, with the given
+   library */
+static void compute(int library, int start, int n) {
+  int i;
+
+  switch(library) {
+  case CRLIBM:
+  case LIBM:
+    if(nbarg == 1)
+      for(i = start; i < start + n; i++)
+        res[i] = scalar_fun(x[i]);
+    else
+      for(i = start; i < start + n; i++)
+        res[i] = scalar_fun(x[i], y[i]);
+    break;
+  case CRLIBM_BATCH:
+    batch_fun(res + start, x + start, n);
+    break;
+#ifdef USE_LIBMVEC
+  case LIBMVEC2:
+    libmvec2_block(res + start, x + start, n);
+    break;
+  case LIBMVEC4:
+    libmvec4_block(res + start, x + start, n);
+    break;
+#endif
+#ifdef HAVE_MPFR_H
+  case MPFR:
+    for(i = start; i < start + n; i++) {
+      mpfr_set_d(mp_inpt, x[i], GMP_RNDN);
+      if(nbarg == 1)
+        mpfr_fun(mp_res, mp_inpt, GMP_RNDN);
+      else {
+        mpfr_set_d(mp_inpt2, y[i], GMP_RNDN);
+        mpfr_fun(mp_res, mp_inpt, mp_inpt2, GMP_RNDN);
+      }
+      res[i] = mpfr_get_d(mp_res, GMP_RNDN);
+    }
+    break;
+#endif
+  }
+}
+
+/* The median time per argument of blocks of BLOCK arguments, after a
+   first pass which leaves all the results in res */
+static double median_time(int library, int n) {
+  tbx_tick_t t1, t2;
+  unsigned long long dt;
+  int k, nblocks = n/BLOCK;
+
+  compute(library, 0, n);
+  for(k = 0; k < nblocks; k++) {
+    TBX_GET_TICK(t1);
+    compute(library, k*BLOCK, BLOCK);
+    TBX_GET_TICK(t2);
+    dt = TBX_TICK_RAW_DIFF(t1, t2);
+    ticks[k] = net_ticks(dt, tbx_time)/BLOCK;
+  }
+  return median_sort(ticks, nblocks);
+}
+
+/* The error of r in ulps of the double nearest to the reference, or
+   -1 if both are infinities or NaNs */
+static double error(double r, int i) {
+#ifndef HAVE_MPFR_H
+  db_number a, b;
+#endif
+
+  if(r != r || r - r != 0) {
+    if(cr[i] != cr[i] || cr[i] - cr[i] != 0)
+      return (r == cr[i] || (r != r && cr[i] != cr[i])) ? -1 : 1.0/0.0;
+    return 1.0/0.0;
+  }
+#ifdef HAVE_MPFR_H
+  if(mpfr_number_p(reference[i])) {
+    mpfr_exp_t e = mpfr_get_exp(reference[i]);
+    double d;
+
+    if(mpfr_zero_p(reference[i]))
+      return (r == 0) ? 0 : 1.0/0.0;
+    mpfr_sub_d(mp_err, reference[i], r, GMP_RNDN);
+    /* ulp of a double of exponent e, or of the subnormals */
+    mpfr_mul_2si(mp_err, mp_err, 53 - (e < -1021 ? -1021 : e), GMP_RNDN);
+    d = mpfr_get_d(mp_err, GMP_RNDN);
+    return (d < 0) ? -d : d;
+  }
+  return 1.0/0.0;
+#else
+  a.d = r;
+  b.d = cr[i];
+  if(cr[i] != cr[i] || cr[i] - cr[i] != 0 || (a.i[HI] ^ b.i[HI]) < 0)
+    return (r == cr[i]) ? 0 : 1.0/0.0;
+  return (a.l > b.l) ? (double) (a.l - b.l) : (double) (b.l - a.l);
+#endif
+}
+
+static double max_error(int n) {
+  double e, m = 0;
+  int i;
+
+  for(i = 0; i < n; i++) {
+    e = error(res[i], i);
+    if(e > m)
+      m = e;
+  }
+  return m;
+}
+
+int main(int argc, char *argv[]) {
+  double (*randfun_perf)(), (*randfun_soaktest)();
+  double (*testfun_crlibm)(), (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  int (*testfun_mpfr)();
+  const char *only_function = NULL;
+  double worstcase;
+  unsigned int fn;
+  int n = DEFAULT_SAMPLES, i, j, library, found = 0;
+
+  for(i = 1; i < argc; i++) {
+    if(bench_option(argc, argv, &i, &only_function, NULL, &n) != 0)
+      usage(argv[0]);
+  }
+  if(n < BLOCK)
+    usage(argv[0]);
+  n -= n % BLOCK;
+
+  x = malloc(n*sizeof(double));
+  y = malloc(n*sizeof(double));
+  res = malloc(n*sizeof(double));
+  cr = malloc(n*sizeof(double));
+  ticks = malloc(n*sizeof(double));
+  if(x == NULL || y == NULL || res == NULL || cr == NULL || ticks == NULL)
+    return EXIT_FAILURE;
+#ifdef HAVE_MPFR_H
+  reference = malloc(n*sizeof(mpfr_t));
+  if(reference == NULL)
+    return EXIT_FAILURE;
+  for(i = 0; i < n; i++)
+    mpfr_init2(reference[i], 200);
+  mpfr_init2(mp_res, 53);
+  mpfr_init2(mp_inpt, 53);
+  mpfr_init2(mp_inpt2, 53);
+  mpfr_init2(mp_err, 200);
+#endif
+
+  crlibm_init();
+
+  tbx_time = timestamp_overhead();
+
+#ifdef HAVE_MPFR_H
+  printf("Errors against MPFR at 200 bits\n");
+#else
+  printf("Errors in ulps from the correctly rounded result (no MPFR)\n");
+#endif
+  printf("%-8s %-14s %12s %12s\n", "function", "library", "ticks/arg", "max ulp");
+
+  for(fn = 0; fn < NB_FUNCTIONS; fn++) {
+    if(only_function != NULL && strcmp(only_function, function_names[fn]) != 0)
+      continue;
+    nbarg = (strcmp(function_names[fn], "pow") == 0) ? 2 : 1;
+    testfun_crlibm = NULL;
+    test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+              &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+              (char *) function_names[fn], "RN");
+    if(testfun_crlibm == NULL)
+      continue;
+    found++;
+    draw_arguments(randfun_perf, nbarg, x, y, n);
+    for(i = 0; i < n; i++)
+      cr[i] = call_testfun(testfun_crlibm, nbarg, x, y, i);
+#ifdef HAVE_MPFR_H
+    mpfr_fun = testfun_mpfr;
+    for(i = 0; i < n; i++) {
+      mpfr_set_d(mp_inpt, x[i], GMP_RNDN);
+      if(nbarg == 1)
+        mpfr_fun(reference[i], mp_inpt, GMP_RNDN);
+      else {
+        mpfr_set_d(mp_inpt2, y[i], GMP_RNDN);
+        mpfr_fun(reference[i], mp_inpt, mp_inpt2, GMP_RNDN);
+      }
+    }
+#endif
+
+    for(library = 0; library < NB_LIBRARIES; library++) {
+      scalar_fun = (library == CRLIBM) ? testfun_crlibm : testfun_libm;
+      if(library == CRLIBM_BATCH) {
+        if(nbarg == 2
+           || (batch_fun = test_batch_init((char *) function_names[fn], "RN")) == NULL)
+          continue;
+      }
+      if(library == LIBMVEC2 || library == LIBMVEC4) {
+#ifdef USE_LIBMVEC
+        for(j = 0; j < (int) NB_LIBMVEC; j++)
+          if(strcmp(libmvec_functions[j].name, function_names[fn]) == 0)
+            break;
+        if(j == (int) NB_LIBMVEC)
+          continue;
+        if(library == LIBMVEC4 && !__builtin_cpu_supports("avx2"))
+          continue;
+        vector_fun = (library == LIBMVEC2) ? libmvec_functions[j].v2 : libmvec_functions[j].v4;
+#else
+        continue;
+#endif
+      }
+#ifndef HAVE_MPFR_H
+      if(library == MPFR)
+        continue;
+#endif
+      printf("%-8s %-14s %12.1f", function_names[fn], library_names[library],
+             median_time(library, n));
+      printf(" %12.3f\n", max_error(n));
+    }
+  }
+  if(found == 0)
+    usage(argv[0]);
+
+#ifdef HAVE_MPFR_H
+  for(i = 0; i < n; i++)
+    mpfr_clear(reference[i]);
+  free(reference);
+  mpfr_clear(mp_res);
+  mpfr_clear(mp_inpt);
+  mpfr_clear(mp_inpt2);
+  mpfr_clear(mp_err);
+#endif
+  free(x);
+  free(y);
+  free(res);
+  free(cr);
+  free(ticks);
+  return EXIT_SUCCESS;
+}
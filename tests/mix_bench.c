@@ -0,0 +1,393 @@
+/*
+ * Benchmark of a mix of calls to several functions
+ *
+ * Production code interleaves calls to exp, log, sin, cos, atan, pow...
+ * whose tables (twoPowerIndex1/2 of exp-tables.c, argredtable of log-td.h,
+ * sincosTable of trigo_fast.h, cosh_sinh_table of csh_fast.h,
+ * arctan_table of atan_fast.h, the tables of pow.h) then contend for
+ * the caches, which the benchmarks of one function at a time do not
+ * show. Here a sequence of calls is built, either drawn at random from
+ * a mix of functions with weights (on the arguments of test_perf, the
+ * rand_for_* generators of test_common.c) or read from a trace, and
+ * each call is timed
+ *
+ * - in the sequence, under the interference of the other functions,
+ * - in isolation, all the calls of its function one after the other,
+ *
+ * in ticks, the time of the time stamps removed. For each function the
+ * median and mean of both are reported, with their ratio. Optionally,
+ * a buffer standing for the data of the application is walked between
+ * two calls, out of the timings.
+ *
+ * A trace has one call per line: the entry point, then its arguments
+ * as C99 hexadecimal floats, e.g. "pow_rn 0x1.8p+1 -0x1p-2"; lines
+ * starting with # are comments, and what follows the arguments is
+ * ignored, as the slow paths written by crlibm_slow_path_dump. -o
+ * writes the sequence drawn from a mix as a trace, to be edited or
+ * replayed. With crlibm configured with --enable-latency-histograms,
+ * -l writes the histograms of the timed calls of the library (see
+ * latency.c) after the runs.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+
+#include "scs_lib/tests/tbx_timing.h"
+
+#define DEFAULT_CALLS 100000
+#define DEFAULT_MIX "exp_rn:30,log_rn:25,sin_rn:15,cos_rn:10,atan_rn:10,pow_rn:10"
+#define MAX_ENTRIES 32
+#define MAX_LINE 256
+
+typedef struct {
+  char name[32];                  /* entry point, exp_rn etc */
+  double (*f)();
+  double (*randfun)();
+  int nbarg;
+  double weight;
+  int count;
+} entry_t;
+
+static entry_t entries[MAX_ENTRIES];
+static int nb_entries;
+
+/* The sequence of calls */
+static int nb_calls, max_calls;
+static int *entry;
+static double *x, *y, *mixed, *isolated, *ticks;
+
+/* The time of two consecutive time stamps */
+static unsigned long long tbx_time;
+
+/* Walked between two calls, if -p is given */
+static char *pollution;
+static int pollution_size;
+
+
+static void usage(const char *name) {
+  fprintf(stderr, "\nUsage: %s [-x mix | -r trace] [-n calls] [-o trace] [-p bytes] [-l file]\n", name);
+  fprintf(stderr, " -x mix    : entry points and weights (default %s)\n", DEFAULT_MIX);
+  fprintf(stderr, " -r trace  : replay the calls of this trace instead\n");
+  fprintf(stderr, " -n calls  : number of calls drawn from the mix (default %d)\n", DEFAULT_CALLS);
+  fprintf(stderr, " -o trace  : write the calls drawn from the mix there\n");
+  fprintf(stderr, " -p bytes  : walk a buffer of this size between two calls\n");
+  fprintf(stderr, " -l file   : write the latency histograms of the library there\n");
+  exit(EXIT_FAILURE);
+}
+
+/* The entry of the entry point name (exp_rn, or exp for exp_rn),
+   added if needed, or -1 if crlibm has no such function */
+static int find_entry(const char *name) {
+  double (*randfun_perf)(), (*randfun_soaktest)(), (*testfun_crlibm)();
+  double (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  int (*testfun_mpfr)();
+  char function[32], mode[3] = "RN";
+  double worstcase;
+  const char *u;
+  int i;
+
+  u = strrchr(name, '_');
+  if(u != NULL && strlen(u) == 3 && strlen(name) < sizeof(function)) {
+    memcpy(function, name, u - name);
+    function[u - name] = 0;
+    mode[0] = u[1] - 'a' + 'A';
+    mode[1] = u[2] - 'a' + 'A';
+  }
+  else if(strlen(name) < sizeof(function) - 3)
+    strcpy(function, name);
+  else
+    return -1;
+  for(i = 0; i < nb_entries; i++)
+    if(strcmp(entries[i].name, name) == 0)
+      return i;
+  if(nb_entries == MAX_ENTRIES)
+    return -1;
+
+  testfun_crlibm = NULL;
+  test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+            &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+            function, mode);
+  if(testfun_crlibm == NULL)
+    return -1;
+  strcpy(entries[nb_entries].name, name);
+  entries[nb_entries].f = testfun_crlibm;
+  entries[nb_entries].randfun = randfun_perf;
+  entries[nb_entries].nbarg = (strcmp(function, "pow") == 0) ? 2 : 1;
+  entries[nb_entries].weight = 0;
+  entries[nb_entries].count = 0;
+  return nb_entries++;
+}
+
+static void add_call(int e, double a, double b) {
+  if(nb_calls == max_calls) {
+    max_calls = 2*max_calls + 1024;
+    entry = realloc(entry, max_calls*sizeof(int));
+    x = realloc(x, max_calls*sizeof(double));
+    y = realloc(y, max_calls*sizeof(double));
+    if(entry == NULL || x == NULL || y == NULL) {
+      fprintf(stderr, "out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  entry[nb_calls] = e;
+  x[nb_calls] = a;
+  y[nb_calls] = b;
+  entries[e].count++;
+  nb_calls++;
+}
+
+/* Draws n calls from a mix "exp_rn:30,log_rn:25,..." */
+static void draw_mix(const char *mix, int n) {
+  char spec[MAX_LINE], *item, *colon;
+  double total = 0, r;
+  int i, e;
+
+  if(strlen(mix) >= sizeof(spec)) {
+    fprintf(stderr, "mix too long: %s\n", mix);
+    exit(EXIT_FAILURE);
+  }
+  strcpy(spec, mix);
+  for(item = strtok(spec, ","); item != NULL; item = strtok(NULL, ",")) {
+    colon = strchr(item, ':');
+    if(colon != NULL)
+      *colon = 0;
+    e = find_entry(item);
+    if(e < 0) {
+      fprintf(stderr, "Unknown entry point %s\n", item);
+      exit(EXIT_FAILURE);
+    }
+    entries[e].weight += (colon != NULL) ? atof(colon + 1) : 1;
+  }
+  for(e = 0; e < nb_entries; e++)
+    total += entries[e].weight;
+  if(total <= 0) {
+    fprintf(stderr, "empty mix: %s\n", mix);
+    exit(EXIT_FAILURE);
+  }
+
+  srandom(42);
+  for(i = 0; i < n; i++) {
+    double a, b = 0;
+    r = total*(random()/2147483648.0);
+    for(e = 0; e < nb_entries - 1 && r >= entries[e].weight; e++)
+      r -= entries[e].weight;
+    if(entries[e].nbarg == 1)
+      a = entries[e].randfun();
+    else
+      a = (*((double (*)(double *)) entries[e].randfun))(&b);
+    add_call(e, a, b);
+  }
+}
+
+static void read_trace(const char *file) {
+  char line[MAX_LINE], name[32];
+  double a, b;
+  int e, k;
+  FILE *f;
+
+  f = fopen(file, "r");
+  if(f == NULL) {
+    fprintf(stderr, "Cannot open the trace %s\n", file);
+    exit(EXIT_FAILURE);
+  }
+  while(fgets(line, MAX_LINE, f) != NULL) {
+    if(line[0] == '#' || line[0] == '\n')
+      continue;
+    b = 0;
+    k = sscanf(line, "%31s %la %la", name, &a, &b);
+    e = (k >= 2) ? find_entry(name) : -1;
+    if(e < 0 || k != 1 + entries[e].nbarg) {
+      fprintf(stderr, "%s: cannot read the line: %s", file, line);
+      exit(EXIT_FAILURE);
+    }
+    add_call(e, a, b);
+  }
+  fclose(f);
+}
+
+static void write_trace(const char *file) {
+  FILE *f;
+  int i;
+
+  f = fopen(file, "w");
+  if(f == NULL) {
+    fprintf(stderr, "Cannot open %s\n", file);
+    exit(EXIT_FAILURE);
+  }
+  fprintf(f, "# crlibm call trace: entry point, then arguments\n");
+  for(i = 0; i < nb_calls; i++) {
+    if(entries[entry[i]].nbarg == 1)
+      fprintf(f, "%s %a\n", entries[entry[i]].name, x[i]);
+    else
+      fprintf(f, "%s %a %a\n", entries[entry[i]].name, x[i], y[i]);
+  }
+  fclose(f);
+}
+
+static void pollute(void) {
+  int i;
+
+  for(i = 0; i < pollution_size; i += 64)
+    pollution[i]++;
+}
+
+/* Times call i into t[i] */
+static void time_call(double *t, int i) {
+  tbx_tick_t t1, t2;
+  unsigned long long dt;
+  volatile double sink;
+  entry_t *e = &entries[entry[i]];
+
+  if(e->nbarg == 1) {
+    TBX_GET_TICK(t1);
+    sink = e->f(x[i]);
+    TBX_GET_TICK(t2);
+  }
+  else {
+    TBX_GET_TICK(t1);
+    sink = e->f(x[i], y[i]);
+    TBX_GET_TICK(t2);
+  }
+  (void) sink;
+  dt = TBX_TICK_RAW_DIFF(t1, t2);
+  t[i] = net_ticks(dt, tbx_time);
+}
+
+/* The median and mean of the times of t of the calls to entry e */
+static void statistics(const double *t, int e, double *median, double *mean) {
+  int i, n = 0;
+
+  *mean = 0;
+  for(i = 0; i < nb_calls; i++)
+    if(entry[i] == e) {
+      ticks[n++] = t[i];
+      *mean += t[i];
+    }
+  *mean /= n;
+  *median = median_sort(ticks, n);
+}
+
+int main(int argc, char *argv[]) {
+  const char *mix = DEFAULT_MIX, *trace = NULL, *output = NULL, *latencies = NULL;
+  double median_mixed, mean_mixed, median_isolated, mean_isolated;
+  double total_mixed = 0, total_isolated = 0;
+  int n = DEFAULT_CALLS, i, e, pass;
+
+  for(i = 1; i < argc; i++) {
+    if(i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2)
+      usage(argv[0]);
+    switch(argv[i][1]) {
+    case 'x': mix = argv[++i]; break;
+    case 'r': trace = argv[++i]; break;
+    case 'n': n = atoi(argv[++i]); break;
+    case 'o': output = argv[++i]; break;
+    case 'p': pollution_size = atoi(argv[++i]); break;
+    case 'l': latencies = argv[++i]; break;
+    default: usage(argv[0]);
+    }
+  }
+  if(n < 1 || pollution_size < 0)
+    usage(argv[0]);
+#ifndef BUILD_LATENCY_HISTOGRAMS
+  if(latencies != NULL) {
+    fprintf(stderr, "-l needs crlibm configured with --enable-latency-histograms\n");
+    return EXIT_FAILURE;
+  }
+#endif
+
+  crlibm_init();
+
+  if(trace != NULL)
+    read_trace(trace);
+  else
+    draw_mix(mix, n);
+  if(nb_calls == 0) {
+    fprintf(stderr, "No calls\n");
+    return EXIT_FAILURE;
+  }
+  if(output != NULL)
+    write_trace(output);
+
+  mixed = malloc(nb_calls*sizeof(double));
+  isolated = malloc(nb_calls*sizeof(double));
+  ticks = malloc(nb_calls*sizeof(double));
+  if(mixed == NULL || isolated == NULL || ticks == NULL)
+    return EXIT_FAILURE;
+  if(pollution_size > 0 && (pollution = calloc(pollution_size, 1)) == NULL)
+    return EXIT_FAILURE;
+
+  tbx_time = timestamp_overhead();
+
+  /* The sequence, once to warm up, then timed */
+  for(pass = 0; pass < 2; pass++)
+    for(i = 0; i < nb_calls; i++) {
+      if(pollution_size > 0)
+        pollute();
+      time_call(mixed, i);
+    }
+
+  /* Each function alone, in the same way */
+  for(e = 0; e < nb_entries; e++)
+    for(pass = 0; pass < 2; pass++)
+      for(i = 0; i < nb_calls; i++)
+        if(entry[i] == e) {
+          if(pollution_size > 0)
+            pollute();
+          time_call(isolated, i);
+        }
+
+  printf("%d calls%s, ticks per call\n", nb_calls,
+         (pollution_size > 0) ? ", buffer walked between the calls" : "");
+  printf("%-12s %8s %7s %10s %10s %10s %10s %7s\n", "function", "calls", "share",
+         "isolated", "mixed", "iso mean", "mix mean", "ratio");
+  for(e = 0; e < nb_entries; e++) {
+    if(entries[e].count == 0)
+      continue;
+    statistics(isolated, e, &median_isolated, &mean_isolated);
+    statistics(mixed, e, &median_mixed, &mean_mixed);
+    total_isolated += mean_isolated*entries[e].count;
+    total_mixed += mean_mixed*entries[e].count;
+    printf("%-12s %8d %6.1f%% %10.1f %10.1f %10.1f %10.1f %7.2f\n", entries[e].name,
+           entries[e].count, 100.0*entries[e].count/nb_calls,
+           median_isolated, median_mixed, mean_isolated, mean_mixed,
+           (mean_isolated > 0) ? mean_mixed/mean_isolated : 0);
+  }
+  printf("%-12s %8d %7s %10s %10s %10.1f %10.1f %7.2f\n", "all", nb_calls, "", "", "",
+         total_isolated/nb_calls, total_mixed/nb_calls,
+         (total_isolated > 0) ? total_mixed/total_isolated : 0);
+#ifdef BUILD_LATENCY_HISTOGRAMS
+  if(latencies != NULL && crlibm_latency_dump(latencies) != 0)
+    fprintf(stderr, "Cannot write %s\n", latencies);
+#endif
+
+  free(entry);
+  free(x);
+  free(y);
+  free(mixed);
+  free(isolated);
+  free(ticks);
+  free(pollution);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,300 @@
+/*
+ * Hardware counters of the double functions of crlibm
+ *
+ * For each function, rounding mode and input distribution (the
+ * rand_for_* generators of test_common.c used by test_perf, then those
+ * of soak_test), the counters of perf_event_open (Linux) are read
+ * around batches of calls, and given per call:
+ *
+ * - task-clock, in ns (a software counter, always there),
+ * - cycles, instructions and their ratio,
+ * - branch-misses,
+ * - L1D-misses, the misses of the reads in the level 1 data cache,
+ * - uops, if a raw event code is given with -u, as the encoding of
+ *   uops_issued.any or equivalent differs from one processor to the
+ *   other (0x10e on recent Intel processors),
+ *
+ * each the median over REPEAT batches. A counter which the processor
+ * or the kernel (see /proc/sys/kernel/perf_event_paranoid) refuses is
+ * reported as n/a.
+ *
+ * The counts are attributed to the phases with the hooks of
+ * crlibm_private.h: the "all" line is the normal calls, whose second
+ * step rate is counted by crlibm_second_step_taken, and the "accurate"
+ * line the calls forced to the accurate phase (see QUICK_PHASE), minus
+ * the normal ones, so that the mean cost of a call is about
+ * all = quick + rate*accurate. The accurate line needs crlibm
+ * configured with --enable-accurate-hook.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+
+#ifdef HAVE_LINUX_PERF_EVENT_H
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#define DEFAULT_SAMPLES 4096
+#define REPEAT 7
+
+static const char *function_names[] = {
+  "exp", "log", "log2", "log10", "expm1", "log1p",
+  "sin", "cos", "tan", "atan", "atanpi",
+  "sinh", "cosh", "asin", "acos", "asinpi", "acospi",
+  "sinpi", "cospi", "tanpi", "pow"
+};
+#define NB_FUNCTIONS (sizeof(function_names)/sizeof(function_names[0]))
+
+static const char *mode_names[] = {"RN", "RU", "RD", "RZ"};
+static const char *distribution_names[] = {"perf", "soak"};
+
+enum {TASK_CLOCK, CYCLES, INSTRUCTIONS, BRANCH_MISSES, L1D_MISSES, UOPS, NB_COUNTERS};
+
+static struct {
+  const char *name;
+  unsigned int type;
+  unsigned long long config;
+  int fd;
+} counters[NB_COUNTERS] = {
+  {"task-clock",    PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, -1},
+  {"cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1},
+  {"instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1},
+  {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, -1},
+  {"L1D-misses",    PERF_TYPE_HW_CACHE,
+   PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+   | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), -1},
+  {"uops",          PERF_TYPE_RAW, 0, -1}
+};
+
+static int nbarg;
+static double *x, *y, *counts[NB_COUNTERS];
+
+
+static void usage(const char *name) {
+  bench_usage(name, " [-u code]", 1, "arguments per distribution", DEFAULT_SAMPLES);
+  fprintf(stderr, " -u code     : raw event code counting the uops (default: not counted)\n");
+  exit(EXIT_FAILURE);
+}
+
+/* Opens the counters of this thread, disabled; those which fail stay
+   at -1 */
+static void open_counters(void) {
+  struct perf_event_attr attr;
+  int c;
+
+  for(c = 0; c < NB_COUNTERS; c++) {
+    if(c == UOPS && counters[c].config == 0)
+      continue;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = counters[c].type;
+    attr.config = counters[c].config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    counters[c].fd = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+}
+
+/* The median over REPEAT batches of the n calls of each counter per
+   call, in c[] (-1 for the counters which are not there) */
+static void measure(double c[NB_COUNTERS], double (*f)(), int n) {
+  volatile double sink;
+  unsigned long long v;
+  int i, k, r;
+
+  for(i = 0; i < n; i++)
+    sink = call_testfun(f, nbarg, x, y, i);
+
+  for(r = 0; r < REPEAT; r++) {
+    for(k = 0; k < NB_COUNTERS; k++)
+      if(counters[k].fd >= 0) {
+        ioctl(counters[k].fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counters[k].fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    for(i = 0; i < n; i++)
+      sink = call_testfun(f, nbarg, x, y, i);
+    for(k = 0; k < NB_COUNTERS; k++)
+      if(counters[k].fd >= 0)
+        ioctl(counters[k].fd, PERF_EVENT_IOC_DISABLE, 0);
+    for(k = 0; k < NB_COUNTERS; k++)
+      if(counters[k].fd >= 0) {
+        if(read(counters[k].fd, &v, sizeof(v)) != sizeof(v))
+          v = 0;
+        counts[k][r] = (double) v/n;
+      }
+  }
+  (void) sink;
+
+  for(k = 0; k < NB_COUNTERS; k++) {
+    if(counters[k].fd < 0) {
+      c[k] = -1;
+      continue;
+    }
+    c[k] = median_sort(counts[k], REPEAT);
+  }
+}
+
+static void print_line(const char *name, const char *distribution, const char *phase,
+                       double c[NB_COUNTERS], double rate) {
+  int k;
+
+  printf("%-10s %-5s %-9s", name, distribution, phase);
+  for(k = 0; k < NB_COUNTERS; k++) {
+    if(c[k] < 0)
+      printf(" %13s", "n/a");
+    else
+      printf(" %13.1f", c[k]);
+    if(k == INSTRUCTIONS) {
+      if(c[CYCLES] > 0 && c[INSTRUCTIONS] >= 0)
+        printf(" %6.2f", c[INSTRUCTIONS]/c[CYCLES]);
+      else
+        printf(" %6s", "n/a");
+    }
+  }
+  if(rate < 0)
+    printf(" %8s\n", "n/a");
+  else
+    printf(" %8.3f\n", rate);
+}
+
+int main(int argc, char *argv[]) {
+  double (*randfun_perf)(), (*randfun_soaktest)(), (*randfun)();
+  double (*testfun_crlibm)(), (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  int (*testfun_mpfr)();
+  const char *only_function = NULL, *only_mode = NULL;
+  double worstcase, all[NB_COUNTERS], rate;
+#ifdef BUILD_ACCURATE_HOOK
+  double accurate[NB_COUNTERS];
+#endif
+  unsigned int fn;
+  int n = DEFAULT_SAMPLES, i, k, mode, distribution, found = 0, opened = 0;
+  char name[32];
+
+  for(i = 1; i < argc; i++) {
+    switch(bench_option(argc, argv, &i, &only_function, &only_mode, &n)) {
+    case 0: break;
+    case 'u': counters[UOPS].config = strtoull(argv[++i], NULL, 0); break;
+    default: usage(argv[0]);
+    }
+  }
+  if(n < 1)
+    usage(argv[0]);
+
+  x = malloc(n*sizeof(double));
+  y = malloc(n*sizeof(double));
+  if(x == NULL || y == NULL)
+    return EXIT_FAILURE;
+  for(k = 0; k < NB_COUNTERS; k++)
+    if((counts[k] = malloc(REPEAT*sizeof(double))) == NULL)
+      return EXIT_FAILURE;
+
+  open_counters();
+  for(k = 0; k < NB_COUNTERS; k++)
+    opened += (counters[k].fd >= 0);
+  if(opened == 0) {
+    fprintf(stderr, "%s: perf_event_open gives no counter (see /proc/sys/kernel/perf_event_paranoid)\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  crlibm_init();
+
+#ifndef BUILD_ACCURATE_HOOK
+  printf("crlibm was configured without --enable-accurate-hook: the accurate phase cannot be forced\n");
+#endif
+  printf("Counts per call, median of %d batches of %d calls\n", REPEAT, n);
+  printf("%-10s %-5s %-9s", "function", "dist", "phase");
+  for(k = 0; k < NB_COUNTERS; k++) {
+    printf(" %13s", counters[k].name);
+    if(k == INSTRUCTIONS)
+      printf(" %6s", "IPC");
+  }
+  printf(" %8s\n", "2nd rate");
+
+  for(fn = 0; fn < NB_FUNCTIONS; fn++) {
+    if(only_function != NULL && strcmp(only_function, function_names[fn]) != 0)
+      continue;
+    nbarg = (strcmp(function_names[fn], "pow") == 0) ? 2 : 1;
+    for(mode = 0; mode < 4; mode++) {
+      if(only_mode != NULL && strcmp(only_mode, mode_names[mode]) != 0)
+        continue;
+      testfun_crlibm = NULL;
+      test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+                &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+                (char *) function_names[fn], (char *) mode_names[mode]);
+      if(testfun_crlibm == NULL)
+        continue;
+      found++;
+      entry_name(name, function_names[fn], mode_names[mode]);
+
+      for(distribution = 0; distribution < 2; distribution++) {
+        randfun = (distribution == 0) ? randfun_perf : randfun_soaktest;
+        draw_arguments(randfun, nbarg, x, y, n);
+
+        measure(all, testfun_crlibm, n);
+        rate = -1;
+#if EVAL_PERF==1
+        crlibm_second_step_taken = 0;
+        for(i = 0; i < n; i++)
+          call_testfun(testfun_crlibm, nbarg, x, y, i);
+        rate = (double) crlibm_second_step_taken/n;
+#endif
+        print_line(name, distribution_names[distribution], "all", all, rate);
+
+#ifdef BUILD_ACCURATE_HOOK
+        crlibm_force_accurate = 1;
+        measure(accurate, testfun_crlibm, n);
+        crlibm_force_accurate = 0;
+        for(k = 0; k < NB_COUNTERS; k++)
+          if(accurate[k] >= 0)
+            accurate[k] = (accurate[k] > all[k]) ? accurate[k] - all[k] : 0;
+        print_line(name, distribution_names[distribution], "accurate", accurate, -1);
+#endif
+      }
+    }
+  }
+  if(found == 0)
+    usage(argv[0]);
+
+  for(k = 0; k < NB_COUNTERS; k++) {
+    if(counters[k].fd >= 0)
+      close(counters[k].fd);
+    free(counts[k]);
+  }
+  free(x);
+  free(y);
+  return EXIT_SUCCESS;
+}
+
+
+#else
+int main (int argc, char *argv[])
+{
+  printf("Sorry, the hardware counters need the perf_event_open of Linux\n");
+  return 0;
+}
+#endif /* HAVE_LINUX_PERF_EVENT_H */
@@ -0,0 +1,405 @@
+/*
+ * Test of the binary128 functions (expq_rn etc)
+ *
+ * - a few arguments whose results were computed with exact rational
+ *   arithmetic: large, subnormal and near-1 results of expq, logq near
+ *   1 and of a subnormal,
+ * - the special cases,
+ * - on random arguments, the four roundings of each result must be
+ *   those of one value: RD and RU consecutive (no result is exact),
+ *   RN one of them and RZ the one toward zero; if libquadmath is
+ *   available, RN must be within one ulp of its function,
+ * - if MPFR is available, the four roundings against MPFR.
+ *
+ * With -b, times crlibm against libquadmath and MPFR instead.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+
+#ifdef __SIZEOF_FLOAT128__
+
+#include "scs_lib/tests/tbx_timing.h"
+
+#ifdef HAVE_QUADMATH_H
+#include <quadmath.h>
+#endif
+
+#ifdef HAVE_MPFR_H
+#define MPFR_WANT_FLOAT128
+#include <gmp.h>
+#include <mpfr.h>
+#endif
+
+#define NB_TESTS 20000
+#define NB_BENCH 100000
+#define MAX_REPORTED 10
+
+typedef __float128 (*function_q)(__float128);
+
+typedef struct {
+  const char *name;
+  function_q f[4];      /* in the order of CRLIBM_RN, RU, RD, RZ */
+  double min, max;      /* the arguments are drawn in [min, max] */
+  int logscale;         /* or in [2^min, 2^max] */
+#ifdef HAVE_QUADMATH_H
+  function_q quadmath;
+#endif
+#ifdef HAVE_MPFR_H
+  int (*mpfr)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+#endif
+} function_qt;
+
+#ifdef HAVE_QUADMATH_H
+#define QUADMATH(f) , f
+#else
+#define QUADMATH(f)
+#endif
+
+#ifdef HAVE_MPFR_H
+#define MPFR(f) , f
+#else
+#define MPFR(f)
+#endif
+
+static const function_qt functions[] = {
+  {"expq", {expq_rn, expq_ru, expq_rd, expq_rz}, -11400.0, 11350.0, 0 QUADMATH(expq) MPFR(mpfr_exp)},
+  {"expq", {expq_rn, expq_ru, expq_rd, expq_rz}, -1.0, 1.0, 0 QUADMATH(expq) MPFR(mpfr_exp)},
+  {"logq", {logq_rn, logq_ru, logq_rd, logq_rz}, -16450.0, 16383.0, 1 QUADMATH(logq) MPFR(mpfr_log)},
+  {"logq", {logq_rn, logq_ru, logq_rd, logq_rz}, 0.99, 1.01, 0 QUADMATH(logq) MPFR(mpfr_log)}
+};
+
+#define NB_FUNCTIONS (sizeof(functions)/sizeof(functions[0]))
+
+static const char *mode_names[] = {"rn", "ru", "rd", "rz"};
+
+static long long errors = 0;
+
+typedef union {
+  __float128 f;
+  unsigned long long w[2];
+} q_number;
+
+#ifdef WORDS_BIGENDIAN
+#define QHI 0
+#define QLO 1
+#else
+#define QHI 1
+#define QLO 0
+#endif
+
+/* printf has no format for binary128: its bits */
+static void print_q(__float128 x) {
+  q_number u;
+
+  u.f = x;
+  printf("0x%016llx%016llx", u.w[QHI], u.w[QLO]);
+}
+
+static void report(const char *name, int mode, __float128 x,
+                   __float128 got, __float128 expected, const char *what) {
+  if(errors < MAX_REPORTED) {
+    printf("ERROR for %s_%s(", name, mode_names[mode]);
+    print_q(x);
+    printf("): ");
+    print_q(got);
+    printf(" instead of ");
+    print_q(expected);
+    printf(" (%s)\n", what);
+  }
+  errors++;
+}
+
+/* The binary128 number after x toward +inf, for x finite */
+static __float128 next_up(__float128 x) {
+  q_number u;
+
+  if(x == 0)
+    return 0x1p-16494Q;
+  u.f = x;
+  if((u.w[QHI] >> 63) == 0) {
+    if(++u.w[QLO] == 0)
+      u.w[QHI]++;
+  }
+  else {
+    if(u.w[QLO]-- == 0)
+      u.w[QHI]--;
+  }
+  return u.f;
+}
+
+static __float128 next_down(__float128 x) {
+  return -next_up(-x);
+}
+
+/* 2^e, for -16382 <= e <= 16383 */
+static __float128 pow2(int e) {
+  q_number u;
+
+  u.w[QHI] = (unsigned long long) (e + 16383) << 48;
+  u.w[QLO] = 0;
+  return u.f;
+}
+
+/* A random binary128 of [min, max], or of [2^min, 2^max] */
+static __float128 random_arg(const function_qt *f) {
+  __float128 u = ((__float128) drand48() + (__float128) drand48()*0x1p-48Q
+                  + (__float128) drand48()*0x1p-96Q) * (f->max - f->min) + f->min;
+  __float128 y;
+  int e;
+
+  if(f->logscale) {
+    e = (int) u;
+    if(e > u)
+      e--;
+    y = 1 + (u - e);
+    if(e < -16382) {
+      y *= 0x1p-200Q;
+      e += 200;
+    }
+    return y * pow2(e);
+  }
+  return u;
+}
+
+/* Results computed with exact rational arithmetic: x, f_rn(x), f_rd(x),
+   f_ru(x) being the binary128 after f_rd(x) */
+static const struct {
+  int fn;   /* 0 for expq, 1 for logq */
+  __float128 x, rn, rd;
+} reference[] = {
+  {0, 0x1.0000000000000000000000000000p+0Q, 0x1.5bf0a8b1457695355fb8ac404e7ap+1Q, 0x1.5bf0a8b1457695355fb8ac404e7ap+1Q},
+  {0, -0x1.0000000000000000000000000000p-3Q, 0x1.c3d6a24ed82218787d624d3e5ebbp-1Q, 0x1.c3d6a24ed82218787d624d3e5ebap-1Q},
+  {0, 0x1.62e4000000000000000000000000p+13Q, 0x1.f427b74653baed1967480b308defp+16383Q, 0x1.f427b74653baed1967480b308deep+16383Q},
+  {0, -0x1.64e4000000000000000000000000p+13Q, 0x0.000000000000000000000003407dp-16382Q, 0x0.000000000000000000000003407cp-16382Q},
+  {0, 0x1.0000000000000000000000000000p-100Q, 0x1.0000000000000000000000001000p+0Q, 0x1.0000000000000000000000001000p+0Q},
+  {0, -0x1.8000000000000000000000000000p-50Q, 0x1.ffffffffffff4000000000002400p-1Q, 0x1.ffffffffffff40000000000023ffp-1Q},
+  {0, 0x1.9100000000000000000000000000p+6Q, 0x1.8c39b9134bac4156775ec333672bp+144Q, 0x1.8c39b9134bac4156775ec333672ap+144Q},
+  {1, 0x1.0000000000000000000000000001p+0Q, 0x1.ffffffffffffffffffffffffffffp-113Q, 0x1.ffffffffffffffffffffffffffffp-113Q},
+  {1, 0x1.ffffffffffffffffffffffffffffp-1Q, -0x1.0000000000000000000000000000p-113Q, -0x1.0000000000000000000000000001p-113Q},
+  {1, 0x0.0000000000000000100000000000p-16382Q, -0x1.64522b4112bfaf428617ccd2716ep+13Q, -0x1.64522b4112bfaf428617ccd2716fp+13Q},
+  {1, 0x1.23456789abcdef00000000000000p+10000Q, 0x1.b1399d371def4f4d29e96929a045p+12Q, 0x1.b1399d371def4f4d29e96929a044p+12Q},
+  {1, 0x1.8000000000000000000000000000p+1Q, 0x1.193ea7aad030a976a4198d55053bp+0Q, 0x1.193ea7aad030a976a4198d55053bp+0Q},
+  {1, 0x1.8000000000000000000000000000p-1Q, -0x1.269621134db92783beb7676c0aaap-2Q, -0x1.269621134db92783beb7676c0aaap-2Q},
+  {1, 0x1.4000000000000000000000000000p+3Q, 0x1.26bb1bbb5551582dd4adac5705a6p+1Q, 0x1.26bb1bbb5551582dd4adac5705a6p+1Q}
+};
+
+static const function_q reference_functions[2][4] = {
+  {expq_rn, expq_ru, expq_rd, expq_rz},
+  {logq_rn, logq_ru, logq_rd, logq_rz}
+};
+static const char *reference_names[] = {"expq", "logq"};
+
+static void check_reference(void) {
+  __float128 x, r[4], got;
+  unsigned int i;
+  int mode;
+
+  for(i = 0; i < sizeof(reference)/sizeof(reference[0]); i++) {
+    x = reference[i].x;
+    r[CRLIBM_RN] = reference[i].rn;
+    r[CRLIBM_RD] = reference[i].rd;
+    r[CRLIBM_RU] = next_up(r[CRLIBM_RD]);
+    r[CRLIBM_RZ] = (r[CRLIBM_RD] >= 0) ? r[CRLIBM_RD] : r[CRLIBM_RU];
+    for(mode = 0; mode < 4; mode++) {
+      got = reference_functions[reference[i].fn][mode](x);
+      if(got != r[mode])
+        report(reference_names[reference[i].fn], mode, x, got, r[mode], "reference");
+    }
+  }
+}
+
+static void check_special(void) {
+  const __float128 inf = 1.0/0.0, largest = 0x1.ffffffffffffffffffffffffffffp16383Q;
+  const struct {
+    int fn;
+    __float128 x, y;
+  } special[] = {
+    {0, 0, 1}, {0, -inf, 0}, {0, inf, inf},
+    {1, 1, 0}, {1, 0, -inf}, {1, inf, inf}
+  };
+  unsigned int i;
+  __float128 y;
+  int mode;
+
+  for(i = 0; i < sizeof(special)/sizeof(special[0]); i++)
+    for(mode = 0; mode < 4; mode++) {
+      y = reference_functions[special[i].fn][mode](special[i].x);
+      if(y != special[i].y)
+        report(reference_names[special[i].fn], mode, special[i].x, y, special[i].y, "special");
+    }
+  for(mode = 0; mode < 4; mode++) {
+    y = reference_functions[1][mode](-1);
+    if(y == y)
+      report("logq", mode, -1, y, inf - inf, "special");
+    y = reference_functions[0][mode](inf - inf);
+    if(y == y)
+      report("expq", mode, inf - inf, y, inf - inf, "special");
+    /* overflow and underflow of expq */
+    y = reference_functions[0][mode](20000);
+    if(y != ((mode == CRLIBM_RN || mode == CRLIBM_RU) ? inf : largest))
+      report("expq", mode, 20000, y, inf, "overflow");
+    y = reference_functions[0][mode](-20000);
+    if(y != ((mode == CRLIBM_RU) ? 0x1p-16494Q : 0))
+      report("expq", mode, -20000, y, 0, "underflow");
+  }
+}
+
+static void check_random(const function_qt *f) {
+  __float128 x, r[4], next;
+  int i, mode;
+
+  for(i = 0; i < NB_TESTS; i++) {
+    x = random_arg(f);
+    for(mode = 0; mode < 4; mode++)
+      r[mode] = f->f[mode](x);
+
+    if(next_up(r[CRLIBM_RD]) != r[CRLIBM_RU])
+      report(f->name, CRLIBM_RU, x, r[CRLIBM_RU], next_up(r[CRLIBM_RD]), "order");
+    if(r[CRLIBM_RN] != r[CRLIBM_RD] && r[CRLIBM_RN] != r[CRLIBM_RU])
+      report(f->name, CRLIBM_RN, x, r[CRLIBM_RN], r[CRLIBM_RD], "order");
+    next = (r[CRLIBM_RD] >= 0) ? r[CRLIBM_RD] : r[CRLIBM_RU];
+    if(r[CRLIBM_RZ] != next)
+      report(f->name, CRLIBM_RZ, x, r[CRLIBM_RZ], next, "order");
+
+#ifdef HAVE_QUADMATH_H
+    {
+      __float128 lib = f->quadmath(x);
+      if(r[CRLIBM_RN] != lib && next_up(r[CRLIBM_RN]) != lib && next_down(r[CRLIBM_RN]) != lib)
+        report(f->name, CRLIBM_RN, x, r[CRLIBM_RN], lib, "libquadmath");
+    }
+#endif
+
+#ifdef HAVE_MPFR_H
+    {
+      static const mpfr_rnd_t rnd[4] = {GMP_RNDN, GMP_RNDU, GMP_RNDD, GMP_RNDZ};
+      mpfr_t mx, my;
+      __float128 y;
+      int inex;
+
+      mpfr_set_emin(-16493);
+      mpfr_set_emax(16384);
+      mpfr_init2(mx, 113);
+      mpfr_init2(my, 113);
+      mpfr_set_float128(mx, x, GMP_RNDN);
+      for(mode = 0; mode < 4; mode++) {
+        inex = f->mpfr(my, mx, rnd[mode]);
+        inex = mpfr_subnormalize(my, inex, rnd[mode]);
+        y = mpfr_get_float128(my, rnd[mode]);
+        if(y != r[mode])
+          report(f->name, mode, x, r[mode], y, "mpfr");
+      }
+      mpfr_clear(mx);
+      mpfr_clear(my);
+    }
+#endif
+  }
+}
+
+/* The time of n calls of f, in ticks per call */
+static double bench(function_q f, const __float128 *x, int n) {
+  tbx_tick_t t1, t2;
+  volatile __float128 y;
+  int i;
+
+  TBX_GET_TICK(t1);
+  for(i = 0; i < n; i++)
+    y = f(x[i]);
+  TBX_GET_TICK(t2);
+  (void) y;
+  return (double) TBX_TICK_RAW_DIFF(t1, t2) / n;
+}
+
+#ifdef HAVE_MPFR_H
+/* The same for MPFR at 113 bits, conversions included */
+static double bench_mpfr(int (*f)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t),
+                         const __float128 *x, int n) {
+  tbx_tick_t t1, t2;
+  volatile __float128 y;
+  mpfr_t mx, my;
+  int i;
+
+  mpfr_init2(mx, 113);
+  mpfr_init2(my, 113);
+  TBX_GET_TICK(t1);
+  for(i = 0; i < n; i++) {
+    mpfr_set_float128(mx, x[i], GMP_RNDN);
+    f(my, mx, GMP_RNDN);
+    y = mpfr_get_float128(my, GMP_RNDN);
+  }
+  TBX_GET_TICK(t2);
+  (void) y;
+  mpfr_clear(mx);
+  mpfr_clear(my);
+  return (double) TBX_TICK_RAW_DIFF(t1, t2) / n;
+}
+#endif
+
+int main(int argc, char *argv[]) {
+  unsigned int i;
+  __float128 *x;
+  int j;
+
+  crlibm_init();
+  srand48(42);
+
+  if(argc == 2 && strcmp(argv[1], "-b") == 0) {
+    x = malloc(NB_BENCH*sizeof(__float128));
+    if(x == NULL)
+      return EXIT_FAILURE;
+    for(i = 0; i < NB_FUNCTIONS; i++) {
+      for(j = 0; j < NB_BENCH; j++)
+        x[j] = random_arg(&functions[i]);
+      printf("%s in [%g, %g]%s: crlibm %.1f", functions[i].name,
+             functions[i].min, functions[i].max,
+             functions[i].logscale ? " (exponents)" : "",
+             bench(functions[i].f[CRLIBM_RN], x, NB_BENCH));
+#ifdef HAVE_QUADMATH_H
+      printf(", libquadmath %.1f", bench(functions[i].quadmath, x, NB_BENCH));
+#endif
+#ifdef HAVE_MPFR_H
+      printf(", mpfr %.1f", bench_mpfr(functions[i].mpfr, x, NB_BENCH));
+#endif
+      printf(" ticks\n");
+    }
+    free(x);
+    return EXIT_SUCCESS;
+  }
+
+  check_reference();
+  check_special();
+  for(i = 0; i < NB_FUNCTIONS; i++)
+    check_random(&functions[i]);
+
+  printf("binary128 functions: %lld errors\n", errors);
+  return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+int main(void) {
+  printf("binary128 functions: not built with this compiler\n");
+  return EXIT_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * Capture of the calls taking a slow path
+ *
+ * With crlibm configured with --enable-slow-path-capture, the library
+ * keeps the last calls of each thread which went to the accurate phase,
+ * the SCS argument reduction of the trigonometric functions, the SCS
+ * arctangent or the check of the exact cases of pow (see latency.c).
+ * This program calls a function on the random arguments of the soak
+ * test (-d perf for those of test_perf), reads the captured calls back
+ * with crlibm_slow_path_read, prints how many took each slow path, and
+ * writes them with crlibm_slow_path_dump as a trace, which
+ * crlibm_mix_bench -r replays:
+ *
+ *   crlibm_slow_paths -f sin -m RN -n 1000000 -o sin_slow.trace
+ *   crlibm_mix_bench -r sin_slow.trace
+ *
+ * A service calls crlibm_slow_path_dump itself, on a signal for
+ * instance, to get the trace of its own slow calls.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+
+#ifdef BUILD_SLOW_PATH_CAPTURE
+
+#define DEFAULT_SAMPLES 1000000
+#define MAX_CALLS 65536
+
+static const char *path_names[] = {"accurate", "scs_rr", "scs_atan", "pow_exact"};
+#define NB_PATHS (sizeof(path_names)/sizeof(path_names[0]))
+
+static crlibm_slow_call calls[MAX_CALLS];
+
+static void usage(const char *name) {
+  fprintf(stderr, "\nUsage: %s -f function [-m mode] [-n samples] [-d soak|perf] [-o trace]\n", name);
+  fprintf(stderr, " -f function : exp, log, sin, atan, pow...\n");
+  fprintf(stderr, " -m mode     : RN, RU, RD or RZ (default RN)\n");
+  fprintf(stderr, " -n samples  : number of calls (default %d)\n", DEFAULT_SAMPLES);
+  fprintf(stderr, " -d          : the random arguments of the soak test (default) or of test_perf\n");
+  fprintf(stderr, " -o trace    : write the captured calls there, for crlibm_mix_bench -r\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[]) {
+  double (*randfun_perf)(), (*randfun_soaktest)(), (*randfun)(), (*testfun_crlibm)();
+  double (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  int (*testfun_mpfr)();
+  const char *function = NULL, *mode = "RN", *distribution = "soak", *output = NULL;
+  double worstcase, x, y = 0;
+  volatile double sink;
+  int count[NB_PATHS];
+  int n = DEFAULT_SAMPLES, nbarg, i, p, captured;
+
+  for(i = 1; i < argc; i++) {
+    if(i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2)
+      usage(argv[0]);
+    switch(argv[i][1]) {
+    case 'f': function = argv[++i]; break;
+    case 'm': mode = argv[++i]; break;
+    case 'n': n = atoi(argv[++i]); break;
+    case 'd': distribution = argv[++i]; break;
+    case 'o': output = argv[++i]; break;
+    default: usage(argv[0]);
+    }
+  }
+  if(function == NULL || n < 1
+     || (strcmp(distribution, "soak") != 0 && strcmp(distribution, "perf") != 0))
+    usage(argv[0]);
+
+  crlibm_init();
+
+  testfun_crlibm = NULL;
+  test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+            &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+            (char *) function, (char *) mode);
+  if(testfun_crlibm == NULL) {
+    fprintf(stderr, "No function %s in mode %s\n", function, mode);
+    return EXIT_FAILURE;
+  }
+  randfun = (strcmp(distribution, "soak") == 0) ? randfun_soaktest : randfun_perf;
+  nbarg = (strcmp(function, "pow") == 0) ? 2 : 1;
+
+  srandom(42);
+  for(i = 0; i < n; i++) {
+    if(nbarg == 1) {
+      x = randfun();
+      sink = testfun_crlibm(x);
+    }
+    else {
+      x = (*((double (*)(double *)) randfun))(&y);
+      sink = testfun_crlibm(x, y);
+    }
+  }
+  (void) sink;
+
+  captured = crlibm_slow_path_read(calls, MAX_CALLS);
+  for(p = 0; p < (int) NB_PATHS; p++)
+    count[p] = 0;
+  for(i = 0; i < captured; i++)
+    for(p = 0; p < (int) NB_PATHS; p++)
+      if(calls[i].paths & (1 << p))
+        count[p]++;
+  printf("%s_%s, %d calls, the last %d slow ones kept:", function, mode, n, captured);
+  for(p = 0; p < (int) NB_PATHS; p++)
+    printf(" %s %d", path_names[p], count[p]);
+  printf("\n");
+
+  if(output != NULL && crlibm_slow_path_dump(output) != 0) {
+    fprintf(stderr, "Cannot write %s\n", output);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+
+#else
+int main (int argc, char *argv[])
+{
+  printf("Sorry, the capture of the slow calls needs crlibm configured with --enable-slow-path-capture\n");
+  return 0;
+}
+#endif /* BUILD_SLOW_PATH_CAPTURE */
@@ -0,0 +1,337 @@
+/*
+ * Parallel soak test against MPFR
+ *
+ * The same test as soak_test (and soak_test-interval with -i), but on
+ * all the cores, for a given number of arguments, and on all the
+ * functions and rounding modes in one run. Each thread has its own
+ * MPFR variables and its own random stream (see rand_seed_thread in
+ * test_common.c), seeded from the seed, the test and the thread
+ * number, so that a run can be reproduced with the same seed and
+ * number of threads.
+ *
+ * For each function and mode, the misrounded results are counted, the
+ * first ones printed, and the throughput given. The exit status tells
+ * whether there was any.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#ifdef HAVE_MPFR_H  /* stop here if MPFR not present */
+#include "test_common.h"
+#include <gmp.h>
+#include <mpfr.h>
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#define DEFAULT_INPUTS 1000000
+#define MAX_THREADS 256
+#define MAX_REPORTED 10
+
+static const char *function_names[] = {
+  "exp", "log", "log2", "log10", "expm1", "log1p",
+  "sin", "cos", "tan", "atan", "atanpi",
+  "sinh", "cosh", "asin", "acos", "asinpi", "acospi",
+  "sinpi", "cospi", "tanpi", "pow"
+};
+#define NB_FUNCTIONS ((int) (sizeof(function_names)/sizeof(function_names[0])))
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* The interval functions known to test_interval_init */
+static const char *interval_names[] = {
+  "exp", "log", "log2", "log10", "expm1", "log1p", "atan", "asin", "sinh"
+};
+#define NB_INTERVAL_FUNCTIONS ((int) (sizeof(interval_names)/sizeof(interval_names[0])))
+#endif
+
+static const char *mode_names[4] = {"RN", "RU", "RD", "RZ"};
+
+/* The test in progress, shared by the threads */
+static char test_name[32];
+static double (*randfun)();
+static double (*testfun_crlibm)();
+static int (*testfun_mpfr)();
+#ifdef BUILD_INTERVAL_FUNCTIONS
+static interval (*testfun_interval)(interval);
+#endif
+static mp_rnd_t mpfr_rnd_mode;
+static int nbarg, interval_test, nb_threads, reported, test_number;
+static unsigned long long nb_inputs, seed;
+static long long misses[MAX_THREADS];
+#ifdef HAVE_PTHREAD_H
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* Whether a and b are the same double, or MPFR gave no finite result */
+static int same_double(db_number a, db_number b) {
+  return ((b.i[HI] & 0x7ff00000) == 0x7ff00000)
+    || (a.i[HI] == b.i[HI] && a.i[LO] == b.i[LO]);
+}
+
+static void report(int t, db_number x, db_number y, db_number res, db_number expected) {
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock(&report_lock);
+#endif
+  if(reported < MAX_REPORTED) {
+    printf("*** CRLIBM ERROR *** %s, thread %d\n", test_name, t);
+    printf("  x =%.50e \n         (%08x %08x) \n", x.d, x.i[HI], x.i[LO]);
+    if(nbarg == 2 || interval_test)
+      printf("  y =%.50e \n         (%08x %08x) \n", y.d, y.i[HI], y.i[LO]);
+    printf("crlibm gives    %.50e \n         (%08x %08x) \n", res.d, res.i[HI], res.i[LO]);
+    printf("MPFR gives      %.50e \n         (%08x %08x) \n\n",
+           expected.d, expected.i[HI], expected.i[LO]);
+  }
+  reported++;
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock(&report_lock);
+#endif
+}
+
+/* Thread t checks its share of the nb_inputs arguments */
+static void *soak(void *arg) {
+  mpfr_t mp_res, mp_inpt, mp_inpt2;
+  db_number x, y, res, expected, tmp;
+  unsigned long long i, n;
+  int t;
+
+  t = (int) (long) arg;
+  mpfr_init2(mp_res,  200);
+  mpfr_init2(mp_inpt, 53);
+  mpfr_init2(mp_inpt2, 53);
+  rand_seed_thread((seed*1000003 + test_number)*MAX_THREADS + t);
+
+  n = nb_inputs/nb_threads + ((unsigned long long) t < nb_inputs % nb_threads);
+  for(i = 0; i < n; i++) {
+#ifdef BUILD_INTERVAL_FUNCTIONS
+    if(interval_test) {
+      interval xy, r;
+      x.d = randfun();
+      y.d = randfun();
+      if(x.d > y.d) {
+        tmp = x; x = y; y = tmp;
+      }
+      ASSIGN_LOW(xy, x.d);
+      ASSIGN_UP(xy, y.d);
+      r = testfun_interval(xy);
+      /* the increasing functions only: [f_rd(x), f_ru(y)] */
+      mpfr_set_d(mp_inpt, x.d, GMP_RNDN);
+      testfun_mpfr(mp_res, mp_inpt, GMP_RNDD);
+      expected.d = mpfr_get_d(mp_res, GMP_RNDD);
+      mpfr_set_d(mp_inpt, y.d, GMP_RNDN);
+      testfun_mpfr(mp_res, mp_inpt, GMP_RNDU);
+      tmp.d = mpfr_get_d(mp_res, GMP_RNDU);
+      /* as soak_test-interval, skip the interval if an end is special */
+      if(((expected.i[HI] & 0x7ff00000) == 0x7ff00000)
+         || ((tmp.i[HI] & 0x7ff00000) == 0x7ff00000))
+        continue;
+      res.d = LOW(r);
+      if(!same_double(res, expected)) {
+        report(t, x, y, res, expected);
+        misses[t]++;
+        continue;
+      }
+      res.d = UP(r);
+      if(!same_double(res, tmp)) {
+        report(t, x, y, res, tmp);
+        misses[t]++;
+      }
+      continue;
+    }
+#endif
+    if(nbarg == 1) {
+      x.d = randfun();
+      res.d = testfun_crlibm(x.d);
+      mpfr_set_d(mp_inpt, x.d, GMP_RNDN);
+      testfun_mpfr(mp_res, mp_inpt, mpfr_rnd_mode);
+    }
+    else {
+      x.d = (*((double (*)(double *)) randfun))(&y.d);
+      res.d = testfun_crlibm(x.d, y.d);
+      mpfr_set_d(mp_inpt, x.d, GMP_RNDN);
+      mpfr_set_d(mp_inpt2, y.d, GMP_RNDN);
+      testfun_mpfr(mp_res, mp_inpt, mp_inpt2, mpfr_rnd_mode);
+    }
+    expected.d = mpfr_get_d(mp_res, mpfr_rnd_mode);
+    if(!same_double(res, expected)) {
+      report(t, x, y, res, expected);
+      misses[t]++;
+    }
+  }
+
+  mpfr_clear(mp_res);
+  mpfr_clear(mp_inpt);
+  mpfr_clear(mp_inpt2);
+  mpfr_free_cache();
+  return NULL;
+}
+
+/* Runs the test set up in the globals on all the threads, prints its
+   line and returns its misses */
+static long long run(unsigned long long *total_inputs, double *total_time) {
+#ifdef HAVE_PTHREAD_H
+  pthread_t threads[MAX_THREADS];
+#endif
+  struct timespec t1, t2;
+  double seconds;
+  int t;
+
+  reported = 0;
+  memset(misses, 0, sizeof(misses));
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+#ifdef HAVE_PTHREAD_H
+  for(t=0; t<nb_threads; t++)
+    pthread_create(&threads[t], NULL, soak, (void *) (long) t);
+  for(t=0; t<nb_threads; t++)
+    pthread_join(threads[t], NULL);
+#else
+  soak((void *) 0);
+#endif
+  clock_gettime(CLOCK_MONOTONIC, &t2);
+  seconds = (t2.tv_sec - t1.tv_sec) + 1e-9*(t2.tv_nsec - t1.tv_nsec);
+
+  for(t=1; t<nb_threads; t++)
+    misses[0] += misses[t];
+  printf("%-12s: %llu inputs, %lld misses, %.2f s, %.0f inputs/s\n",
+         test_name, nb_inputs, misses[0], seconds, nb_inputs/seconds);
+  fflush(stdout);
+  *total_inputs += nb_inputs;
+  *total_time += seconds;
+  test_number++;
+  return misses[0];
+}
+
+static void usage(char *prog_name) {
+  int i;
+  fprintf(stderr, "\nUsage: %s [-t threads] [-n inputs] [-s seed] [-m RN|RU|RD|RZ] [-i] [function ...]\n", prog_name);
+  fprintf(stderr, "  soak-tests each function on inputs random arguments (default %d) in each mode\n", DEFAULT_INPUTS);
+  fprintf(stderr, "  -i: test the interval functions instead (needs --enable-interval-functions)\n");
+  fprintf(stderr, "  function in: ");
+  for(i=0; i<NB_FUNCTIONS; i++)
+    fprintf(stderr, "%s ", function_names[i]);
+  fprintf(stderr, "(default: all)\n\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[]) {
+  double (*randfun_perf)(), (*randfun_soaktest)();
+  double (*testfun_libultim)(), (*testfun_libmcr)(), (*testfun_libm)();
+  double worstcase, total_time = 0;
+  const char *only_mode = NULL;
+  unsigned long long total_inputs = 0;
+  long long total_misses = 0;
+  int i, mode, opt, found = 0;
+
+  nb_inputs = DEFAULT_INPUTS;
+  seed = 1;
+#ifdef HAVE_PTHREAD_H
+  nb_threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#else
+  nb_threads = 1;
+#endif
+  while((opt = getopt(argc, argv, "t:n:s:m:i")) != -1) {
+    if(opt == 't')      nb_threads = atoi(optarg);
+    else if(opt == 'n') nb_inputs = strtoull(optarg, NULL, 0);
+    else if(opt == 's') seed = strtoull(optarg, NULL, 0);
+    else if(opt == 'm') only_mode = optarg;
+    else if(opt == 'i') interval_test = 1;
+    else                usage(argv[0]);
+  }
+  if(nb_threads < 1) nb_threads = 1;
+  if(nb_threads > MAX_THREADS) nb_threads = MAX_THREADS;
+#ifndef HAVE_PTHREAD_H
+  nb_threads = 1;
+#endif
+#ifndef BUILD_INTERVAL_FUNCTIONS
+  if(interval_test) {
+    fprintf(stderr, "The interval functions are not built (configure --enable-interval-functions)\n");
+    return EXIT_FAILURE;
+  }
+#endif
+
+  crlibm_init();
+  printf("%d threads, seed %llu\n", nb_threads, seed);
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+  if(interval_test) {
+    for(i=0; i<NB_INTERVAL_FUNCTIONS; i++) {
+      if(optind < argc) {
+        int j;
+        for(j=optind; j<argc; j++)
+          if(strcmp(argv[j], interval_names[i]) == 0 || (strncmp(argv[j], "j_", 2) == 0 && strcmp(argv[j] + 2, interval_names[i]) == 0))
+            break;
+        if(j == argc)
+          continue;
+      }
+      test_interval_init(&randfun, &testfun_interval, &testfun_mpfr, (char *) interval_names[i]);
+      sprintf(test_name, "j_%s", interval_names[i]);
+      found++;
+      total_misses += run(&total_inputs, &total_time);
+    }
+  }
+  else
+#endif
+  for(i=0; i<NB_FUNCTIONS; i++) {
+    if(optind < argc) {
+      int j;
+      for(j=optind; j<argc; j++)
+        if(strcmp(argv[j], function_names[i]) == 0)
+          break;
+      if(j == argc)
+        continue;
+    }
+    nbarg = (strcmp(function_names[i], "pow") == 0) ? 2 : 1;
+    for(mode=0; mode<4; mode++) {
+      if(only_mode != NULL && strcmp(only_mode, mode_names[mode]) != 0)
+        continue;
+      testfun_crlibm = NULL;
+      test_init(&randfun_perf, &randfun_soaktest, &testfun_crlibm, &testfun_mpfr,
+                &testfun_libultim, &testfun_libmcr, &testfun_libm, &worstcase,
+                (char *) function_names[i], (char *) mode_names[mode]);
+      if(testfun_crlibm == NULL)
+        continue;
+      randfun = randfun_soaktest;
+      mpfr_rnd_mode = (mode == 1) ? GMP_RNDU : (mode == 2) ? GMP_RNDD : (mode == 3) ? GMP_RNDZ : GMP_RNDN;
+      sprintf(test_name, "%s_%c%c", function_names[i],
+              mode_names[mode][0] + 'a' - 'A', mode_names[mode][1] + 'a' - 'A');
+      found++;
+      total_misses += run(&total_inputs, &total_time);
+    }
+  }
+  if(found == 0)
+    usage(argv[0]);
+
+  printf("Total: %llu inputs, %lld misses, %.2f s, %.0f inputs/s\n",
+         total_inputs, total_misses, total_time, total_inputs/total_time);
+  return (total_misses == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+#else
+int main (int argc, char *argv[])
+{
+  printf("Sorry, I need to be compiled against MPFR\n  (get it from www.mpfr.org, then:   configure --enable-mpfr)\n");
+  return 0;
+}
+#endif
@@ -43,16 +43,11 @@ db_number input, input2, res_crlibm_low, res_crlibm_up, res_mpfr_low, res_mpfr_u
 interval input_i, res_crlibm;
 mpfr_t mp_res, mp_inpt, mp_inpt2; 
 
-interval j_exp(interval x);
 interval j_log(interval x);
-interval j_expm1(interval x);
-interval j_log2(interval x);
 
 double (*randfun)       () = NULL;
 double (*randfun_perf)       () = NULL;
-interval (*testfun_crlibm_interval)() = NULL;
-double (*testfun_crlibm_low)() = NULL;
-double (*testfun_crlibm_up)() = NULL;
+interval (*testfun_crlibm_interval)(interval) = NULL;
 int    (*testfun_mpfr)  () = NULL;
 
 
@@ -310,43 +305,12 @@ int main (int argc, char *argv[])
   else{
     function_name = argv[1];
     sscanf(argv[2],"%d", &seed);
-    if ((strcmp(function_name,"exp")!=0) && (strcmp(function_name,"j_exp")!=0) && (strcmp(function_name,"log")!=0) && (strcmp(function_name,"j_log")!=0) && (strcmp(function_name,"expm1")!=0) && (strcmp(function_name,"j_expm1")!=0) && (strcmp(function_name,"log2")!=0) && (strcmp(function_name,"j_log2")!=0))
+    test_interval_init(&randfun, &testfun_crlibm_interval, &testfun_mpfr, function_name);
+    if (testfun_crlibm_interval == NULL)
     {
       fprintf (stderr, "\nUnknown function:  %s \n", function_name);
       return 1;
     }
-    if ((strcmp(function_name,"log")==0) || (strcmp(function_name,"j_log")==0))
-    {
-      randfun = rand_for_log;
-      testfun_crlibm_interval = j_log;
-      testfun_crlibm_low = log_rd;
-      testfun_crlibm_up = log_ru;
-      testfun_mpfr = mpfr_log;
-    }
-    if ((strcmp(function_name,"log2")==0) || (strcmp(function_name,"j_log2")==0))
-    {
-      randfun = rand_for_log;
-      testfun_crlibm_interval = j_log2;
-      testfun_crlibm_low = log2_rd;
-      testfun_crlibm_up = log2_ru;
-      testfun_mpfr = mpfr_log2;
-    }
-    if ((strcmp(function_name,"exp")==0) || (strcmp(function_name,"j_exp")==0))
-    {
-      randfun = rand_generic;
-      testfun_crlibm_interval = j_exp;
-      testfun_crlibm_low = exp_rd;
-      testfun_crlibm_up = exp_ru;
-      testfun_mpfr = mpfr_exp;
-    }
-    if ((strcmp(function_name,"expm1")==0) || (strcmp(function_name,"j_expm1")==0))
-    {
-      randfun = rand_for_expm1_soaktest;
-      testfun_crlibm_interval = j_expm1;
-      testfun_crlibm_low = expm1_rd;
-      testfun_crlibm_up = expm1_ru;
-      testfun_mpfr = mpfr_expm1;
-    }
 
     crlibm_init();
 
@@ -0,0 +1,197 @@
+/*
+ * Test of the tabulated 16-bit functions (crlibm16_init etc)
+ *
+ * Every table of the file given on the command line is checked:
+ * - the batch lookups against the scalar lookups,
+ * - the order of the four roundings of each input, which must be
+ *   those of one value: equal, or RD and RU consecutive,
+ * - the bfloat16 exp and log in the directed modes against the
+ *   binary32 functions, since rounding the float rounded in a directed
+ *   mode to bfloat16 in the same mode is a correct rounding,
+ * - the few exact results (exp(0) = 1, etc).
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "table16.h"
+
+#define MAX_REPORTED 10
+
+static const char *function_names[] = {"exp", "log", "tanh", "sigmoid"};
+static const char *format_names[] = {"fp16", "bf16"};
+static const char *mode_names[] = {"rn", "ru", "rd", "rz"};
+
+static long long errors = 0;
+
+static void report(int fn, int fmt, int mode, unsigned int x,
+                   unsigned int got, unsigned int expected, const char *what) {
+  if(errors < MAX_REPORTED)
+    printf("ERROR for %s_%s_%s(%#06x): %#06x instead of %#06x (%s)\n",
+           function_names[fn], format_names[fmt], mode_names[mode],
+           x, got, expected, what);
+  errors++;
+}
+
+/* The bits of the 16-bit formats, as a float (exact) */
+static float value(unsigned int x, int fmt) {
+  union {float f; unsigned int i;} u;
+  int e;
+
+  if(fmt == CRLIBM16_BF16)
+    u.i = x << 16;
+  else {
+    e = (x >> 10) & 0x1f;
+    if(e == 0x1f)
+      u.i = 0x7f800000 | ((x & 0x3ff) << 13);
+    else if(e == 0)
+      u.f = (x & 0x3ff) * 0x1p-24f;
+    else
+      u.i = ((e + 112) << 23) | ((x & 0x3ff) << 13);
+    u.i |= (x & 0x8000) << 16;
+  }
+  return u.f;
+}
+
+/* A float rounded to bfloat16 in a directed mode */
+static unsigned int bf16_from_float(float y, int mode) {
+  union {float f; unsigned int i;} u;
+  unsigned int r;
+
+  u.f = y;
+  r = u.i >> 16;
+  if((u.i & 0xffff) != 0
+     && ((mode == CRLIBM16_RU && !(r & 0x8000))
+         || (mode == CRLIBM16_RD && (r & 0x8000))))
+    r++;
+  return r;
+}
+
+static void check_table(int fn, int fmt) {
+  static unsigned short x[TABLE16_SIZE], res[TABLE16_SIZE];
+  const unsigned short *t[4];
+  float v[4];
+  unsigned int i, next;
+  int mode;
+
+  for(mode = 0; mode < 4; mode++) {
+    t[mode] = crlibm16_table(fn, fmt, mode);
+    /* the whole table, then the same shifted by one for the tail */
+    for(i = 0; i < TABLE16_SIZE; i++)
+      x[i] = i;
+    crlibm16_batch(res, x, TABLE16_SIZE, t[mode]);
+    for(i = 0; i < TABLE16_SIZE; i++)
+      if(res[i] != t[mode][i])
+        report(fn, fmt, mode, i, res[i], t[mode][i], "batch");
+    crlibm16_batch(res, x+1, TABLE16_SIZE-1, t[mode]);
+    for(i = 1; i < TABLE16_SIZE; i++)
+      if(res[i-1] != t[mode][i])
+        report(fn, fmt, mode, i, res[i-1], t[mode][i], "batch");
+  }
+
+  for(i = 0; i < TABLE16_SIZE; i++) {
+    for(mode = 0; mode < 4; mode++)
+      v[mode] = value(t[mode][i], fmt);
+    if(v[CRLIBM16_RN] != v[CRLIBM16_RN])
+      continue;
+    if(t[CRLIBM16_RD][i] != t[CRLIBM16_RU][i]) {
+      /* the float next to v[RD] toward +inf */
+      next = (v[CRLIBM16_RD] < 0 || (v[CRLIBM16_RD] == 0 && (t[CRLIBM16_RD][i] & 0x8000)))
+        ? t[CRLIBM16_RD][i] - 1 : t[CRLIBM16_RD][i] + 1;
+      if((t[CRLIBM16_RD][i] & 0x7fff) == 0)
+        next = 1;
+      if(t[CRLIBM16_RU][i] != next)
+        report(fn, fmt, CRLIBM16_RU, i, t[CRLIBM16_RU][i], next, "order");
+    }
+    if(t[CRLIBM16_RN][i] != t[CRLIBM16_RD][i] && t[CRLIBM16_RN][i] != t[CRLIBM16_RU][i])
+      report(fn, fmt, CRLIBM16_RN, i, t[CRLIBM16_RN][i], t[CRLIBM16_RD][i], "order");
+    next = (v[CRLIBM16_RD] >= 0) ? t[CRLIBM16_RD][i] : t[CRLIBM16_RU][i];
+    if(t[CRLIBM16_RZ][i] != next)
+      report(fn, fmt, CRLIBM16_RZ, i, t[CRLIBM16_RZ][i], next, "order");
+  }
+
+  if(fmt == CRLIBM16_BF16 && (fn == CRLIBM16_EXP || fn == CRLIBM16_LOG))
+    for(i = 0; i < TABLE16_SIZE; i++) {
+      float xf = value(i, fmt), y;
+      if(xf != xf)
+        continue;
+      for(mode = CRLIBM16_RU; mode <= CRLIBM16_RZ; mode++) {
+        if(fn == CRLIBM16_EXP)
+          y = (mode == CRLIBM16_RU) ? expf_ru(xf) : (mode == CRLIBM16_RD) ? expf_rd(xf) : expf_rz(xf);
+        else
+          y = (mode == CRLIBM16_RU) ? logf_ru(xf) : (mode == CRLIBM16_RD) ? logf_rd(xf) : logf_rz(xf);
+        if(y != y)
+          next = 0x7fc0;
+        else
+          next = bf16_from_float(y, mode);
+        if(t[mode][i] != next)
+          report(fn, fmt, mode, i, t[mode][i], next, "binary32");
+      }
+    }
+}
+
+int main(int argc, char *argv[]) {
+  /* exact results, for fp16 then bf16 */
+  static const struct {
+    int fn;
+    unsigned int x[2], y[2];
+  } exact[] = {
+    {CRLIBM16_EXP,     {0x0000, 0x0000}, {0x3c00, 0x3f80}},
+    {CRLIBM16_EXP,     {0x8000, 0x8000}, {0x3c00, 0x3f80}},
+    {CRLIBM16_EXP,     {0xfc00, 0xff80}, {0x0000, 0x0000}},
+    {CRLIBM16_LOG,     {0x3c00, 0x3f80}, {0x0000, 0x0000}},
+    {CRLIBM16_LOG,     {0x0000, 0x0000}, {0xfc00, 0xff80}},
+    {CRLIBM16_LOG,     {0xbc00, 0xbf80}, {0x7e00, 0x7fc0}},
+    {CRLIBM16_TANH,    {0x8000, 0x8000}, {0x8000, 0x8000}},
+    {CRLIBM16_TANH,    {0x7c00, 0x7f80}, {0x3c00, 0x3f80}},
+    {CRLIBM16_SIGMOID, {0x0000, 0x0000}, {0x3800, 0x3f00}},
+    {CRLIBM16_SIGMOID, {0xfc00, 0xff80}, {0x0000, 0x0000}}
+  };
+  int fn, fmt, mode;
+  unsigned int i;
+
+  if(argc != 2) {
+    fprintf(stderr, "Usage: %s file\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  crlibm_init();
+  if(crlibm16_init(argv[1]) != 0) {
+    printf("ERROR: cannot map %s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  for(fn = 0; fn < TABLE16_NB_FUNCTIONS; fn++)
+    for(fmt = 0; fmt < TABLE16_NB_FORMATS; fmt++)
+      check_table(fn, fmt);
+
+  for(i = 0; i < sizeof(exact)/sizeof(exact[0]); i++)
+    for(fmt = 0; fmt < TABLE16_NB_FORMATS; fmt++)
+      for(mode = 0; mode < 4; mode++)
+        if(crlibm16_table(exact[i].fn, fmt, mode)[exact[i].x[fmt]] != exact[i].y[fmt])
+          report(exact[i].fn, fmt, mode, exact[i].x[fmt],
+                 crlibm16_table(exact[i].fn, fmt, mode)[exact[i].x[fmt]],
+                 exact[i].y[fmt], "exact");
+
+  printf("crlibm16: %d tables, %lld errors\n",
+         TABLE16_NB_FUNCTIONS*TABLE16_NB_FORMATS*TABLE16_NB_MODES, errors);
+  return (errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
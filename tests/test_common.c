@@ -6,6 +6,8 @@
 #include "crlibm_private.h"
 #include "test_common.h"
 
+#include "scs_lib/tests/tbx_timing.h"
+
 #ifdef HAVE_MPFR_H
 #include <gmp.h>
 #include <mpfr.h>
@@ -33,7 +35,7 @@
 double zero ;
 
 /* Here come the various random number generators. They all use the
-   rand() function.  
+   rand() function, through test_random() below.  
 
    We may have two rand functions for each function under
    test. The first is for the soaktest, the second for testing the
@@ -54,14 +56,47 @@ double zero ;
 /**/
 
 
+/* The source of all the random bits: random(), shared by the whole
+   program and seeded by srand(), except in a thread which called
+   rand_seed_thread(), which gets its own stream (xorshift64*). This
+   lets the threads of soak_parallel draw independent reproducible
+   arguments. */
+#ifdef HAVE_PTHREAD_H
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL
+#endif
+static THREAD_LOCAL int thread_seeded;
+static THREAD_LOCAL unsigned long long thread_state;
+
+void rand_seed_thread(unsigned long long seed){
+  /* one step of splitmix64, so that close seeds give unrelated streams */
+  seed += 0x9e3779b97f4a7c15ULL;
+  seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  seed = (seed ^ (seed >> 27)) * 0x94d049bb133111ebULL;
+  thread_state = (seed ^ (seed >> 31)) | 1;
+  thread_seeded = 1;
+}
+
+/* 31 random bits, as random() */
+static long test_random(){
+  if(!thread_seeded)
+    return random();
+  thread_state ^= thread_state >> 12;
+  thread_state ^= thread_state << 25;
+  thread_state ^= thread_state >> 27;
+  return (long) ((thread_state * 0x2545f4914f6cdd1dULL) >> 33);
+}
+
+
 /* Return 'sizeof(int)' random bits    */
 int rand_int(){
   int val;
   int i;
-  val = (random() & 0x000000ff);
+  val = (test_random() & 0x000000ff);
   for(i=0; i<(sizeof(int)); i++){
     val = val << 8;
-    val += (random() & 0x000000ff ); /* we keep only 8 bits */
+    val += (test_random() & 0x000000ff ); /* we keep only 8 bits */
   }
   return val;
 }
@@ -92,7 +127,7 @@ double rand_double(){
   /* then the high bits of the mantissa, and the sign bit */
   result.i[HI]=  rand_int() & 0x000fffff;
   /* Now set the exponent (negative value) */
-  e = rand() & 0x000003ff; 
+  e = test_random() & 0x000003ff; 
   if (e>0) e-=1;
   result.i[HI] += e<<20;
   return (result.d);
@@ -475,6 +510,7 @@ int tinkered_mpfr_sinpi (mpfr_t mpr, mpfr_t mpx, mp_rnd_t rnd) {
     mpfr_div_2exp(mpr, mpx, 1, GMP_RNDN); 
     mpfr_frac(mpr, mpr, GMP_RNDN);
     double d = mpfr_get_d(mpr, GMP_RNDN); /* -1/4, 0, 1/2, 3/4 */
+    if (d < 0.0) d += 1.0;   /* negative x: its fraction is negative */
     if (d == 0.0)       { mpfr_set_si(mpr, 0, rnd); }
     else if (d == 0.25) { mpfr_set_si(mpr, 1, rnd); }
     else if (d == 0.5)  { mpfr_set_si(mpr, 0, rnd); }
@@ -501,6 +537,7 @@ int tinkered_mpfr_cospi (mpfr_t mpr, mpfr_t mpx, mp_rnd_t rnd) {
     mpfr_div_2exp(mpr, mpx, 1, GMP_RNDN); 
     mpfr_frac(mpr, mpr, GMP_RNDN);
     double d = mpfr_get_d(mpr, GMP_RNDN); /* -1/4, 0, 1/2, 3/4 */
+    if (d < 0.0) d += 1.0;   /* negative x: its fraction is negative */
     if (d == 0.0)       { mpfr_set_si(mpr, 1, rnd); }
     else if (d == 0.25) { mpfr_set_si(mpr, 0, rnd); }
     else if (d == 0.5)  { mpfr_set_si(mpr, -1, rnd); }
@@ -526,6 +563,7 @@ int tinkered_mpfr_tanpi (mpfr_t mpr, mpfr_t mpx, mp_rnd_t rnd) {
   if(mpfr_integer_p(mpr)) { /* Exact cases */ 
     mpfr_frac(mpr, mpx, GMP_RNDN); 
     double d = mpfr_get_d(mpr, GMP_RNDN); /* -1/4, 0, 1/4, 1/2 */
+    if (d < 0.0) d += 1.0;   /* negative x: its fraction is negative */
     if (d == 0.0)       { mpfr_set_ui(mpr, 0, rnd); }
     else if (d == 0.25) { mpfr_set_ui(mpr, 1, rnd); }
     else if (d == 0.5)  { mpfr_set_nan(mpr); }
@@ -1228,3 +1266,234 @@ void test_init(/* pointers to returned value */
     }
 }
 
+
+
+
+/* Returns the batch version of the function with the given rounding
+   mode, or NULL if there is none */
+void (*test_batch_init(char *func_name, char *rnd_mode))(double *, const double *, int) {
+  void (*batch[4])(double *, const double *, int) = {NULL, NULL, NULL, NULL}; /* RN, RU, RD, RZ */
+
+  if (strcmp (func_name, "exp") == 0) {
+    batch[0] = exp_rn_batch;  batch[1] = exp_ru_batch;  batch[2] = exp_rd_batch;  batch[3] = exp_rz_batch;
+  }
+  else if (strcmp (func_name, "log") == 0) {
+    batch[0] = log_rn_batch;  batch[1] = log_ru_batch;  batch[2] = log_rd_batch;  batch[3] = log_rz_batch;
+  }
+  else if (strcmp (func_name, "sin") == 0) {
+    batch[0] = sin_rn_batch;  batch[1] = sin_ru_batch;  batch[2] = sin_rd_batch;  batch[3] = sin_rz_batch;
+  }
+  else if (strcmp (func_name, "cos") == 0) {
+    batch[0] = cos_rn_batch;  batch[1] = cos_ru_batch;  batch[2] = cos_rd_batch;  batch[3] = cos_rz_batch;
+  }
+  else if (strcmp (func_name, "tan") == 0) {
+    batch[0] = tan_rn_batch;  batch[1] = tan_ru_batch;  batch[2] = tan_rd_batch;  batch[3] = tan_rz_batch;
+  }
+
+  if      ((strcmp(rnd_mode,"RU")==0) || (strcmp(rnd_mode,"P")==0)) return batch[1];
+  else if ((strcmp(rnd_mode,"RD")==0) || (strcmp(rnd_mode,"M")==0)) return batch[2];
+  else if ((strcmp(rnd_mode,"RZ")==0) || (strcmp(rnd_mode,"Z")==0)) return batch[3];
+  else return batch[0];
+}
+
+
+/* Returns the round-to-odd version of the function, or NULL if there
+   is none */
+double (*test_ro_init(char *func_name))(double) {
+  if (strcmp (func_name, "exp") == 0)   return exp_ro;
+  if (strcmp (func_name, "log") == 0)   return log_ro;
+  if (strcmp (func_name, "log2") == 0)  return log2_ro;
+  if (strcmp (func_name, "expm1") == 0) return expm1_ro;
+  if (strcmp (func_name, "log1p") == 0) return log1p_ro;
+  if (strcmp (func_name, "sin") == 0)   return sin_ro;
+  if (strcmp (func_name, "cos") == 0)   return cos_ro;
+  if (strcmp (func_name, "tan") == 0)   return tan_ro;
+  if (strcmp (func_name, "atan") == 0)  return atan_ro;
+  return NULL;
+}
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* crlibm.h is included before crlibm_config.h, which enables them */
+void j_exp_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_log_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_expm1_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_log2_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+interval j_exp(interval x);
+interval j_log(interval x);
+interval j_log2(interval x);
+interval j_log10(interval x);
+interval j_expm1(interval x);
+interval j_log1p(interval x);
+interval j_atan(interval x);
+interval j_asin(interval x);
+interval j_sinh(interval x);
+
+/* Returns the interval batch version of the function, or NULL if there
+   is none, and in *lo the lower end of the domain of the function */
+void (*test_interval_batch_init(char *func_name, double *lo))(double *, double *, const double *, const double *, int) {
+  *lo = -1.0/0.0;
+  if (strcmp (func_name, "exp") == 0)   return j_exp_batch;
+  if (strcmp (func_name, "expm1") == 0) return j_expm1_batch;
+  *lo = 0.0;
+  if (strcmp (func_name, "log") == 0)   return j_log_batch;
+  if (strcmp (func_name, "log2") == 0)  return j_log2_batch;
+  return NULL;
+}
+
+/* The increasing interval functions, for which [f_rd(inf), f_ru(sup)]
+   is the expected result, with the generators of their soak tests.
+   Returns 0 if func_name (exp or j_exp, etc) is not one of them. */
+int test_interval_init(double (**randfun)(), interval (**testfun_interval)(interval),
+		       int (**testfun_mpfr)(), char *func_name) {
+  static const struct {
+    const char *name;
+    double (*randfun)();
+    interval (*f)(interval);
+#ifdef HAVE_MPFR_H
+    int (*mpfr)();
+#endif
+  } functions[] = {
+#ifdef HAVE_MPFR_H
+#define INTERVAL_FUNCTION(name, randfun) {#name, randfun, j_##name, (int (*)()) mpfr_##name}
+#else
+#define INTERVAL_FUNCTION(name, randfun) {#name, randfun, j_##name}
+#endif
+    INTERVAL_FUNCTION(exp, rand_generic),
+    INTERVAL_FUNCTION(log, rand_for_log),
+    INTERVAL_FUNCTION(log2, rand_for_log),
+    INTERVAL_FUNCTION(log10, rand_for_log),
+    INTERVAL_FUNCTION(expm1, rand_for_expm1_soaktest),
+    INTERVAL_FUNCTION(log1p, rand_for_log1p),
+    INTERVAL_FUNCTION(atan, rand_for_atan_soaktest),
+    INTERVAL_FUNCTION(asin, rand_for_asin_soaktest),
+    INTERVAL_FUNCTION(sinh, rand_for_exp_perf),
+#undef INTERVAL_FUNCTION
+  };
+  unsigned int i;
+
+  if (strncmp (func_name, "j_", 2) == 0)
+    func_name += 2;
+  for (i = 0; i < sizeof(functions)/sizeof(functions[0]); i++)
+    if (strcmp (func_name, functions[i].name) == 0) {
+      *randfun = functions[i].randfun;
+      *testfun_interval = functions[i].f;
+#ifdef HAVE_MPFR_H
+      *testfun_mpfr = functions[i].mpfr;
+#else
+      (void) testfun_mpfr;
+#endif
+      return 1;
+    }
+  return 0;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
+
+
+
+/* Reads the next line of a .testdata file which is not blank or a
+   comment into line (200 chars), without its trailing comment.
+   Returns NULL at the end of the file. */
+char* skip_comments(FILE* f, char* line) {
+  char* r; 
+  int i;
+  do {
+    r=fgets(line, 200, f);
+  }
+    /* Look if the first char was a #, a newline or a blank character */
+  while((line[0]=='#' || line[0]=='\n' || line[0]==' ' || line[0]=='\t' || line[0]==0) && r!=NULL);
+
+  /* look for a comment in the line, and remove it */
+  i=0;
+  while(line[i]!=0 && line[i]!='#') i++;
+  line[i]=0;
+  return r;
+}
+
+
+
+/* The helpers of the benchmarks */
+
+int compare_doubles(const void *a, const void *b) {
+  double u = *(const double *) a, v = *(const double *) b;
+  return (u > v) - (u < v);
+}
+
+/* The median of the n values of t, sorted in place */
+double median_sort(double *t, int n) {
+  qsort(t, n, sizeof(double), compare_doubles);
+  return t[(n - 1)/2];
+}
+
+/* n arguments of randfun in x (and y for the functions of two
+   arguments), the same from one run to the next */
+void draw_arguments(double (*randfun)(), int nbarg, double *x, double *y, int n) {
+  int i;
+
+  srandom(42);
+  for(i = 0; i < n; i++) {
+    if(nbarg == 1)
+      x[i] = randfun();
+    else
+      x[i] = (*((double (*)(double *)) randfun))(&y[i]);
+  }
+}
+
+/* The time of two consecutive time stamps */
+unsigned long long timestamp_overhead(void) {
+  tbx_tick_t t1, t2;
+  unsigned long long dt, overhead = (unsigned long long) -1;
+  int j;
+
+  for(j = 0; j < 20000; j++) {
+    TBX_GET_TICK(t1);
+    TBX_GET_TICK(t2);
+    dt = TBX_TICK_RAW_DIFF(t1, t2);
+    if(dt < overhead)
+      overhead = dt;
+  }
+  return overhead;
+}
+
+/* The ticks dt between two time stamps, without the time stamps themselves */
+double net_ticks(unsigned long long dt, unsigned long long overhead) {
+  return (dt > overhead) ? (double) (dt - overhead) : 0;
+}
+
+/* The name of the entry point of function in mode, exp_rn etc */
+void entry_name(char *name, const char *function, const char *mode) {
+  sprintf(name, "%s_%c%c", function, mode[0] + 'a' - 'A', mode[1] + 'a' - 'A');
+}
+
+/* The usage of the options -f, -m (if with_mode) and -n, followed by
+   the other options of the benchmark: the benchmark then describes
+   these and exits */
+void bench_usage(const char *name, const char *options, int with_mode,
+                 const char *samples, int default_samples) {
+  fprintf(stderr, "\nUsage: %s [-f function]%s [-n samples]%s\n",
+          name, with_mode ? " [-m RN|RU|RD|RZ]" : "", options);
+  fprintf(stderr, " -f function : only this function (default: all)\n");
+  if(with_mode)
+    fprintf(stderr, " -m mode     : only this rounding mode (default: all)\n");
+  fprintf(stderr, " -n samples  : number of %s (default %d)\n", samples, default_samples);
+}
+
+/* Reads the option argv[*i] and its argument. Returns 0 after -f, -m
+   (if only_mode is not NULL) and -n, the letter of the other options,
+   whose argument is then argv[*i + 1], and -1 if argv[*i] is not an
+   option with an argument */
+int bench_option(int argc, char *argv[], int *i,
+                 const char **only_function, const char **only_mode, int *n) {
+  if(*i + 1 >= argc || argv[*i][0] != '-' || strlen(argv[*i]) != 2)
+    return -1;
+  switch(argv[*i][1]) {
+  case 'f': *only_function = argv[++*i]; return 0;
+  case 'm':
+    if(only_mode == NULL)
+      return 'm';
+    *only_mode = argv[++*i];
+    return 0;
+  case 'n': *n = atoi(argv[++*i]); return 0;
+  default: return argv[*i][1];
+  }
+}
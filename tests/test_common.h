@@ -13,6 +13,22 @@ void test_init(/* pointers to returned value */
 	       char *func_name,
 	       char *rnd_mode);
 
+void (*test_batch_init(char *func_name, char *rnd_mode))(double *, const double *, int);
+
+double (*test_ro_init(char *func_name))(double);
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+void (*test_interval_batch_init(char *func_name, double *lo))(double *, double *, const double *, const double *, int);
+
+#include "interval.h"
+int test_interval_init(double (**randfun)(), interval (**testfun_interval)(interval),
+		       int (**testfun_mpfr)(), char *func_name);
+#endif
+
+char* skip_comments(FILE* f, char* line);
+
+void rand_seed_thread(unsigned long long seed);
+
 int rand_int(void);
 
 double rand_generic(void);
@@ -29,3 +45,43 @@ double rand_for_exp_normal(void);
 
 double rand_for_expm1_soaktest(void);
 
+double rand_for_log1p(void);
+
+double rand_for_trig_perf(void);
+
+double rand_for_atan_perf(void);
+
+double rand_for_atan_soaktest(void);
+
+double rand_for_asin_testperf(void);
+
+double rand_for_asin_soaktest(void);
+
+double rand_for_pow_perf(double *yr);
+
+
+
+/* The helpers of the benchmarks, bench.c and the others */
+
+int compare_doubles(const void *a, const void *b);
+
+double median_sort(double *t, int n);
+
+/* f(x[i]) or f(x[i], y[i]), inlined in the timed loops */
+static inline double call_testfun(double (*f)(), int nbarg, const double *x, const double *y, int i) {
+  return (nbarg == 1) ? f(x[i]) : f(x[i], y[i]);
+}
+
+void draw_arguments(double (*randfun)(), int nbarg, double *x, double *y, int n);
+
+unsigned long long timestamp_overhead(void);
+
+double net_ticks(unsigned long long dt, unsigned long long overhead);
+
+void entry_name(char *name, const char *function, const char *mode);
+
+void bench_usage(const char *name, const char *options, int with_mode,
+                 const char *samples, int default_samples);
+
+int bench_option(int argc, char *argv[], int *i,
+                 const char **only_function, const char **only_mode, int *n);
@@ -60,8 +60,6 @@ However there is a modification to make to rand_for_log, see in this function.
 
 
 #if EVAL_PERF==1  
-/* counter of calls to the second step */
-extern int crlibm_second_step_taken; 
 int crlibm_first_step_taken;
 #endif
 
@@ -104,8 +102,33 @@ interval j_log(interval x);
 interval j_exp(interval x);
 interval j_expm1(interval x);
 interval j_log2(interval x);
+interval j_log10(interval x);
+interval j_log1p(interval x);
+interval j_sin(interval x);
+interval j_cos(interval x);
+interval j_tan(interval x);
+interval j_sinpi(interval x);
+interval j_cospi(interval x);
+interval j_atan(interval x);
+interval j_asin(interval x);
+interval j_acos(interval x);
+interval j_sinh(interval x);
+interval j_cosh(interval x);
+interval j_pow(interval x, interval y);
+void j_exp_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_log_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_expm1_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+void j_log2_batch(double *res_inf, double *res_sup, const double *inf, const double *sup, int n);
+/* The interval batch version, if any */
+void (*testfun_crlibm_batch)(double *, double *, const double *, const double *, int) = NULL;
 /* indicate the number of argument taken by the function */
 static int nbarg;          
+/* If set, the interval is [i1, i1+|i1|*2^-12] instead of [i1, i2]: 
+   random intervals would almost always span a period of the 
+   trigonometric functions, and overflow for pow */
+static int narrow;
+/* The bounds of the second interval, for pow */
+static double y_inf, y_sup;
 
 
 
@@ -235,7 +258,8 @@ static void test_without_cache(const char *name,
 #ifdef TIMING_USES_GETTIMEOFDAY /* use inaccurate timer, do many loops */
 	  for(k=0; k<TIMING_ITER;k++)
 #endif
-//	    result = testfun(i1,i2);
+	    result = testfun_crlibm_low(i1, y_inf);
+	    result = testfun_crlibm_up(i2, y_sup);
 	  TBX_GET_TICK(t2);	  
 	}
       }else{                             /* func_type = MPFR function  */
@@ -332,6 +356,16 @@ static void test_without_cache_inter(const char *name,
 /*	  printHexa("low res:",LOW(result));
           printHexa("up res:",UP(result));*/
 	  TBX_GET_TICK(t2);
+	}else{
+	  interval input_y;
+	  ASSIGN_LOW(input_y,y_inf);
+	  ASSIGN_UP(input_y,y_sup);
+	  TBX_GET_TICK(t1);
+#ifdef TIMING_USES_GETTIMEOFDAY /* use inaccurate timer, do many loops */
+	  for(k=0; k<TIMING_ITER;k++)
+#endif
+	    result = testfun_crlibm_interval(input, input_y);
+	  TBX_GET_TICK(t2);
 	}
       }
 
@@ -358,6 +392,51 @@ static void test_without_cache_inter(const char *name,
 
 
 
+/* The batch version against the loop on the scalar interval
+   function, on the n intervals [inf[i], sup[i]]: prints the time per
+   interval of each (the min of N1 runs) */
+static void test_batch(const char *name, double *inf, double *sup, int n){
+  double *res_inf, *res_sup;
+  interval input, result;
+  unsigned long long dt, batch_dtmin, loop_dtmin;
+  tbx_tick_t   t1, t2; 
+  int i, j;
+
+  res_inf = malloc(n*sizeof(double));
+  res_sup = malloc(n*sizeof(double));
+  if (res_inf==NULL || res_sup==NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  batch_dtmin=1ULL<<62;
+  loop_dtmin=1ULL<<62;
+  for(j=0; j<N1; j++) {
+    TBX_GET_TICK(t1);
+    testfun_crlibm_batch(res_inf, res_sup, inf, sup, n);
+    TBX_GET_TICK(t2);
+    dt = TBX_TICK_RAW_DIFF(t1, t2)-tbx_time;
+    if (dt<batch_dtmin)  batch_dtmin=dt;
+
+    TBX_GET_TICK(t1);
+    for(i=0; i<n; i++) {
+      ASSIGN_LOW(input,inf[i]);
+      ASSIGN_UP(input,sup[i]);
+      result = testfun_crlibm_interval(input);
+      res_inf[i] = LOW(result);
+      res_sup[i] = UP(result);
+    }
+    TBX_GET_TICK(t2);
+    dt = TBX_TICK_RAW_DIFF(t1, t2)-tbx_time;
+    if (dt<loop_dtmin)  loop_dtmin=dt;
+  }
+  printf("\nCRLIBM interval batch, %s intervals\nbatch = %f ticks per interval,\t loop = %f ticks per interval\n",
+	 name, ((double)batch_dtmin) / ((double) n), ((double)loop_dtmin) / ((double) n));
+  free(res_inf);
+  free(res_sup);
+}
+
+
+
 static void test_worst_case(double (*testfun)(), 
 		     double i1, 
 		     double i2, 
@@ -503,15 +582,11 @@ int main (int argc, char *argv[]){
   {
     function_name = argv[1];
     sscanf(argv[2],"%d", &n);
-    if ((strcmp(function_name,"exp")!=0) && (strcmp(function_name,"j_exp")!=0)  && (strcmp(function_name,"log")!=0) && (strcmp(function_name,"j_log")!=0) && (strcmp(function_name,"expm1")!=0) && (strcmp(function_name,"j_expm1")!=0) && (strcmp(function_name,"log2")!=0) && (strcmp(function_name,"j_log2")!=0))
-    {
-      fprintf (stderr, "\nUnknown function:  %s \n", function_name);
-      return 1;
-    }
     if ((strcmp(function_name,"log")==0) || (strcmp(function_name,"j_log")==0))
     {
       randfun = rand_for_log;
       testfun_crlibm_interval = j_log;
+      testfun_crlibm_batch = j_log_batch;
       testfun_crlibm_low = log_rd;
       testfun_crlibm_up = log_ru;
     }
@@ -519,6 +594,7 @@ int main (int argc, char *argv[]){
     {
       randfun = rand_for_log;
       testfun_crlibm_interval = j_log2;
+      testfun_crlibm_batch = j_log2_batch;
       testfun_crlibm_low = log2_rd;
       testfun_crlibm_up = log2_ru;
     }
@@ -526,6 +602,7 @@ int main (int argc, char *argv[]){
     {
       randfun = rand_for_exp_perf;
       testfun_crlibm_interval = j_exp;
+      testfun_crlibm_batch = j_exp_batch;
       testfun_crlibm_low = exp_rd;
       testfun_crlibm_up = exp_ru;
     }
@@ -533,9 +610,114 @@ int main (int argc, char *argv[]){
     {
       randfun = rand_for_expm1_soaktest;
       testfun_crlibm_interval = j_expm1;
+      testfun_crlibm_batch = j_expm1_batch;
       testfun_crlibm_low = expm1_rd;
       testfun_crlibm_up = expm1_ru;
     }
+    if ((strcmp(function_name,"log10")==0) || (strcmp(function_name,"j_log10")==0))
+    {
+      randfun = rand_for_log;
+      testfun_crlibm_interval = j_log10;
+      testfun_crlibm_low = log10_rd;
+      testfun_crlibm_up = log10_ru;
+    }
+    if ((strcmp(function_name,"log1p")==0) || (strcmp(function_name,"j_log1p")==0))
+    {
+      randfun = rand_for_log1p;
+      testfun_crlibm_interval = j_log1p;
+      testfun_crlibm_low = log1p_rd;
+      testfun_crlibm_up = log1p_ru;
+    }
+    if ((strcmp(function_name,"sin")==0) || (strcmp(function_name,"j_sin")==0))
+    {
+      randfun = rand_for_trig_perf;
+      narrow = 1;
+      testfun_crlibm_interval = j_sin;
+      testfun_crlibm_low = sin_rd;
+      testfun_crlibm_up = sin_ru;
+    }
+    if ((strcmp(function_name,"cos")==0) || (strcmp(function_name,"j_cos")==0))
+    {
+      randfun = rand_for_trig_perf;
+      narrow = 1;
+      testfun_crlibm_interval = j_cos;
+      testfun_crlibm_low = cos_rd;
+      testfun_crlibm_up = cos_ru;
+    }
+    if ((strcmp(function_name,"tan")==0) || (strcmp(function_name,"j_tan")==0))
+    {
+      randfun = rand_for_trig_perf;
+      narrow = 1;
+      testfun_crlibm_interval = j_tan;
+      testfun_crlibm_low = tan_rd;
+      testfun_crlibm_up = tan_ru;
+    }
+    if ((strcmp(function_name,"sinpi")==0) || (strcmp(function_name,"j_sinpi")==0))
+    {
+      randfun = rand_generic;
+      narrow = 1;
+      testfun_crlibm_interval = j_sinpi;
+      testfun_crlibm_low = sinpi_rd;
+      testfun_crlibm_up = sinpi_ru;
+    }
+    if ((strcmp(function_name,"cospi")==0) || (strcmp(function_name,"j_cospi")==0))
+    {
+      randfun = rand_generic;
+      narrow = 1;
+      testfun_crlibm_interval = j_cospi;
+      testfun_crlibm_low = cospi_rd;
+      testfun_crlibm_up = cospi_ru;
+    }
+    if ((strcmp(function_name,"atan")==0) || (strcmp(function_name,"j_atan")==0))
+    {
+      randfun = rand_for_atan_perf;
+      testfun_crlibm_interval = j_atan;
+      testfun_crlibm_low = atan_rd;
+      testfun_crlibm_up = atan_ru;
+    }
+    if ((strcmp(function_name,"asin")==0) || (strcmp(function_name,"j_asin")==0))
+    {
+      randfun = rand_for_asin_testperf;
+      testfun_crlibm_interval = j_asin;
+      testfun_crlibm_low = asin_rd;
+      testfun_crlibm_up = asin_ru;
+    }
+    if ((strcmp(function_name,"acos")==0) || (strcmp(function_name,"j_acos")==0))
+    {
+      randfun = rand_for_asin_testperf;
+      testfun_crlibm_interval = j_acos;
+      testfun_crlibm_low = acos_rd;
+      testfun_crlibm_up = acos_ru;
+    }
+    if ((strcmp(function_name,"sinh")==0) || (strcmp(function_name,"j_sinh")==0))
+    {
+      randfun = rand_for_exp_perf;
+      testfun_crlibm_interval = j_sinh;
+      testfun_crlibm_low = sinh_rd;
+      testfun_crlibm_up = sinh_ru;
+    }
+    if ((strcmp(function_name,"cosh")==0) || (strcmp(function_name,"j_cosh")==0))
+    {
+      randfun = rand_for_exp_perf;
+      testfun_crlibm_interval = j_cosh;
+      testfun_crlibm_low = cosh_rd;
+      testfun_crlibm_up = cosh_ru;
+    }
+    if ((strcmp(function_name,"pow")==0) || (strcmp(function_name,"j_pow")==0))
+    {
+      /* There is no directed pow: compare with two calls to pow_rn */
+      nbarg = 2;
+      narrow = 1;
+      randfun = (double (*)()) rand_for_pow_perf;
+      testfun_crlibm_interval = (interval (*)()) j_pow;
+      testfun_crlibm_low = pow_rn;
+      testfun_crlibm_up = pow_rn;
+    }
+    if (testfun_crlibm_interval == NULL)
+    {
+      fprintf (stderr, "\nUnknown function:  %s \n", function_name);
+      return 1;
+    }
 
   crlibm_init();
   
@@ -567,14 +749,29 @@ int main (int argc, char *argv[]){
   /* take the min of N1 identical calls to leverage interruptions */
   /* As a consequence, the cache impact of these calls disappear...*/
   for(i=0; i< n; i++){ 
-    i1 = randfun();
-    i2 = randfun();
+    if (nbarg==2) {
+      i1 = randfun(&y_inf);
+      i2 = randfun(&y_sup);
+    } else {
+      i1 = randfun();
+      i2 = randfun();
+    }
+    if (narrow) {
+      i2 = i1 + ABS(i1) * (1.0/4096.0);
+      y_sup = y_inf + ABS(y_inf) * (1.0/4096.0);
+    }
     if(!(i1<=i2))
     {
       double temp=i1;
       i1=i2;
       i2=temp;
     }
+    if(!(y_inf<=y_sup))
+    {
+      double temp=y_inf;
+      y_inf=y_sup;
+      y_sup=temp;
+    }
     /*    db_number ia,ib;
     ia.i[HI]=0x31100afb;
     ia.i[LO]=0x198a95fe;
@@ -598,6 +795,31 @@ int main (int argc, char *argv[]){
 #endif
 
 
+  /************  BATCH TESTS   *************************/
+  /* The same intervals all at once, then the thin intervals [i1, i1] */
+  if (testfun_crlibm_batch != NULL) {
+    double *binf, *bsup;
+    binf = malloc(n*sizeof(double));
+    bsup = malloc(n*sizeof(double));
+    if (binf==NULL || bsup==NULL) {
+      fprintf(stderr, "out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+    srandom(n);
+    for(i=0; i< n; i++){ 
+      i1 = randfun();
+      i2 = randfun();
+      if (narrow) i2 = i1 + ABS(i1) * (1.0/4096.0);
+      binf[i] = (i1<=i2) ? i1 : i2;
+      bsup[i] = (i1<=i2) ? i2 : i1;
+    }
+    test_batch("random", binf, bsup, n);
+    test_batch("thin", binf, binf, n);
+    free(binf);
+    free(bsup);
+  }
+
+
   /************  WORST CASE TESTS   *********************/
   /* worst case test */
   i1 = worstcase;
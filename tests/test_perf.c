@@ -54,8 +54,6 @@ Beware to compile without optimizations
 
 
 #if EVAL_PERF==1  
-/* counter of calls to the second step */
-extern int crlibm_second_step_taken; 
 int crlibm_first_step_taken;
 #endif
 
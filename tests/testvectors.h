@@ -0,0 +1,57 @@
+/*
+ * Layout of the binary file of test vectors
+ *
+ * The file is written by testvectors_convert.c from the .testdata
+ * files, and mapped by blind_test_mmap.c. It holds, after a header, the
+ * names of the functions, then one fixed-size record per vector. It is
+ * stored in the byte order of the machine that built it.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef TESTVECTORS_H
+#define TESTVECTORS_H
+
+#define TESTVECTORS_MAGIC       "crlibmtv"
+#define TESTVECTORS_VERSION     1
+#define TESTVECTORS_BYTE_ORDER  0x01020304
+
+/* Header: the 8 magic characters, then the version, the byte order
+   mark, the number of functions and the number of vectors as unsigned
+   ints, zero padded */
+#define TESTVECTORS_HEADER_SIZE 32
+
+/* The names of the functions follow, zero padded */
+#define TESTVECTORS_NAME_SIZE   16
+#define TESTVECTORS_MAX_FUNCTIONS 64
+
+/* Then the vectors. The mode is CRLIBM_RN, CRLIBM_RU, CRLIBM_RD or
+   CRLIBM_RZ; y is zero for the functions of one argument. */
+typedef struct {
+  unsigned int function;   /* index of the name */
+  unsigned int mode;
+  db_number x, y, expected;
+} test_vector;
+
+#define TESTVECTORS_OFFSET(nb_functions)                                \
+  (TESTVECTORS_HEADER_SIZE + (nb_functions)*TESTVECTORS_NAME_SIZE)
+
+#define TESTVECTORS_FILE_SIZE(nb_functions, nb_vectors)                 \
+  (TESTVECTORS_OFFSET(nb_functions) + (size_t) (nb_vectors)*sizeof(test_vector))
+
+#endif /* TESTVECTORS_H */
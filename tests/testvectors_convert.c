@@ -0,0 +1,149 @@
+/*
+ * Conversion of .testdata files to the binary file of test vectors
+ *
+ * Usage: crlibm_testvectors_convert output file.testdata ...
+ *
+ * All the vectors of all the given files go to one file, whose layout
+ * is described in testvectors.h, to be checked by blind_test_mmap.c.
+ * The text files are read as blind_test.c reads them.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crlibm.h"
+#include "crlibm_private.h"
+#include "test_common.h"
+#include "testvectors.h"
+
+static char names[TESTVECTORS_MAX_FUNCTIONS][TESTVECTORS_NAME_SIZE];
+static unsigned int nb_functions;
+static test_vector *vectors;
+static unsigned int nb_vectors, max_vectors;
+
+static int mode_code(const char *mode) {
+  if((strcmp(mode,"RN")==0) || (strcmp(mode,"N")==0)) return CRLIBM_RN;
+  if((strcmp(mode,"RU")==0) || (strcmp(mode,"P")==0)) return CRLIBM_RU;
+  if((strcmp(mode,"RD")==0) || (strcmp(mode,"M")==0)) return CRLIBM_RD;
+  if((strcmp(mode,"RZ")==0) || (strcmp(mode,"Z")==0)) return CRLIBM_RZ;
+  return -1;
+}
+
+/* Appends the vectors of one .testdata file */
+static int convert(const char *filename) {
+  char line[400], function_name[TESTVECTORS_NAME_SIZE], rounding_mode[10];
+  test_vector v;
+  unsigned int function;
+  int nbarg, mode, n;
+  FILE *f;
+
+  f = fopen(filename, "r");
+  if(f == NULL) {
+    fprintf(stderr, "problem opening %s\n", filename);
+    return -1;
+  }
+  if(skip_comments(f, line) == NULL
+     || sscanf(line, "%15s", function_name) != 1) {
+    fprintf(stderr, "%s: no function name\n", filename);
+    fclose(f);
+    return -1;
+  }
+  nbarg = (strcmp(function_name, "pow") == 0) ? 2 : 1;
+
+  for(function = 0; function < nb_functions; function++)
+    if(strcmp(names[function], function_name) == 0)
+      break;
+  if(function == nb_functions) {
+    if(nb_functions == TESTVECTORS_MAX_FUNCTIONS) {
+      fprintf(stderr, "%s: too many functions\n", filename);
+      fclose(f);
+      return -1;
+    }
+    strcpy(names[nb_functions++], function_name);
+  }
+
+  while(skip_comments(f, line) != NULL) {
+    memset(&v, 0, sizeof(v));
+    if(nbarg == 2)
+      n = sscanf(line, "%9s %x %x %x %x %x %x", rounding_mode,
+                 &v.x.i[HI], &v.x.i[LO], &v.y.i[HI], &v.y.i[LO],
+                 &v.expected.i[HI], &v.expected.i[LO]);
+    else
+      n = sscanf(line, "%9s %x %x %x %x", rounding_mode,
+                 &v.x.i[HI], &v.x.i[LO],
+                 &v.expected.i[HI], &v.expected.i[LO]);
+    mode = (n == 3 + 2*nbarg) ? mode_code(rounding_mode) : -1;
+    if(mode < 0) {
+      fprintf(stderr, "%s: cannot read the line: %s\n", filename, line);
+      fclose(f);
+      return -1;
+    }
+    v.function = function;
+    v.mode = mode;
+    if(nb_vectors == max_vectors) {
+      max_vectors = 2*max_vectors + 1024;
+      vectors = realloc(vectors, max_vectors*sizeof(test_vector));
+      if(vectors == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(EXIT_FAILURE);
+      }
+    }
+    vectors[nb_vectors++] = v;
+  }
+  fclose(f);
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  unsigned int header[4];
+  FILE *out;
+  int i;
+
+  if(argc < 3) {
+    fprintf(stderr, "\nUsage: %s output file.testdata ...\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+  for(i = 2; i < argc; i++)
+    if(convert(argv[i]) != 0)
+      exit(EXIT_FAILURE);
+
+  out = fopen(argv[1], "wb");
+  if(out == NULL) {
+    fprintf(stderr, "problem opening %s\n", argv[1]);
+    exit(EXIT_FAILURE);
+  }
+  header[0] = TESTVECTORS_VERSION;
+  header[1] = TESTVECTORS_BYTE_ORDER;
+  header[2] = nb_functions;
+  header[3] = nb_vectors;
+  if(fwrite(TESTVECTORS_MAGIC, 1, 8, out) != 8
+     || fwrite(header, sizeof(header), 1, out) != 1
+     || fwrite("\0\0\0\0\0\0\0\0", 1, TESTVECTORS_HEADER_SIZE - 8 - sizeof(header), out)
+        != TESTVECTORS_HEADER_SIZE - 8 - sizeof(header)
+     || fwrite(names, TESTVECTORS_NAME_SIZE, nb_functions, out) != nb_functions
+     || fwrite(vectors, sizeof(test_vector), nb_vectors, out) != nb_vectors
+     || fclose(out) != 0) {
+    fprintf(stderr, "problem writing %s\n", argv[1]);
+    exit(EXIT_FAILURE);
+  }
+  printf("%s: %u vectors of %u functions\n", argv[1], nb_vectors, nb_functions);
+  free(vectors);
+  return EXIT_SUCCESS;
+}
@@ -37,6 +37,7 @@
 
 
 extern int rem_pio2_scs(scs_ptr, scs_ptr);
+extern int rem_pio2_scs_dd(scs_ptr, scs_ptr, scs_ptr);
 
 
 /* Polynomial evaluation of sin(x) over [-Pi/4, +Pi/4] 	
@@ -499,3 +500,129 @@ double scs_tan_rz(double x){
 }
 
 
+
+
+/* Functions sin_td, cos_td, sin_dd and cos_dd, see crlibm.h
+
+   The accurate phase, its SCS result being split into a
+   triple-double. The polynomial errors (2^-125 for the sine, 2^-132
+   for the cosine) dominate the errors of the SCS reduction and
+   operations, hence a relative error below 2^-120. For |x| < 2^-60
+   the first terms of the Taylor series are exact enough. */
+
+/* sin(xh + xl), or cos(xh + xl) if cosine is set, in SCS, where xh
+   and xl are SCS numbers of at most three digits each, such as
+   doubles, possibly scaled by powers of 2^30 (sinl_rn etc) */
+void scs_sincos_scs(scs_ptr res, scs_ptr xh, scs_ptr xl, int cosine){
+  scs_t sc2;
+  int N;
+
+  N = rem_pio2_scs_dd(sc2, xh, xl);
+  N = (N + cosine) & 0x0000003;	/* cos(x) = sin(x + Pi/2) */
+  if (N & 1)
+    scs_cos(sc2);
+  else
+    scs_sin(sc2);
+  if (N & 2)
+    sc2->sign = -sc2->sign;
+  scs_set(res, sc2);
+}
+
+/* The same for two doubles */
+static void scs_sincos(scs_ptr res, double xh, double xl, int cosine){
+  scs_t sc1, sc2, sc3;
+  int N;
+
+  scs_set_d(sc1, xh);
+  if (xl != 0) {
+    scs_set_d(sc3, xl);
+    scs_sincos_scs(res, sc1, sc3, cosine);
+    return;
+  }
+  N = rem_pio2_scs(sc2, sc1);
+  N = (N + cosine) & 0x0000003;
+  if (N & 1)
+    scs_cos(sc2);
+  else
+    scs_sin(sc2);
+  if (N & 2)
+    sc2->sign = -sc2->sign;
+  scs_set(res, sc2);
+}
+
+static void scs_sincos_td(double *resh, double *resm, double *resl, double x, int cosine){
+  scs_t res;
+  db_number xdb;
+
+  xdb.d = x;
+  *resm = 0;
+  *resl = 0;
+  if ((xdb.i[HI] & 0x7fffffff) >= 0x7ff00000) {
+    *resh = x-x;                /* sin(Inf) = cos(Inf) = NaN */
+    return;
+  }
+  if ((xdb.i[HI] & 0x7fffffff) < 0x3c300000) {
+    if (cosine) {
+      *resh = 1.0;
+      *resm = -0.5*x*x;
+    }
+    else {
+      *resh = x;
+      *resm = -x*x*x*(1.0/6.0);
+    }
+    return;
+  }
+
+  scs_sincos(res, x, 0, cosine);
+  scs_get_td(resh, resm, resl, res);
+}
+
+void sin_td(double *resh, double *resm, double *resl, double x){
+  scs_sincos_td(resh, resm, resl, x, 0);
+}
+
+void cos_td(double *resh, double *resm, double *resl, double x){
+  scs_sincos_td(resh, resm, resl, x, 1);
+}
+
+void sin_dd(double *resh, double *resl, double x){
+  double resm, resll;
+
+  scs_sincos_td(resh, &resm, &resll, x, 0);
+  *resl = resm + resll;
+}
+
+void cos_dd(double *resh, double *resl, double x){
+  double resm, resll;
+
+  scs_sincos_td(resh, &resm, &resll, x, 1);
+  *resl = resm + resll;
+}
+
+
+/* The accurate phases of sin_dd_rn and cos_dd_rn (trigo_fast.c):
+   the rounding to nearest of the SCS result */
+
+double scs_sin_dd_rn(double xh, double xl){
+  scs_t res;
+  double resd;
+
+#if EVAL_PERF
+  crlibm_second_step_taken++;
+#endif
+  scs_sincos(res, xh, xl, 0);
+  scs_get_d(&resd, res);
+  return resd;
+}
+
+double scs_cos_dd_rn(double xh, double xl){
+  scs_t res;
+  double resd;
+
+#if EVAL_PERF
+  crlibm_second_step_taken++;
+#endif
+  scs_sincos(res, xh, xl, 1);
+  scs_get_d(&resd, res);
+  return resd;
+}
@@ -26,6 +26,10 @@
 #include "crlibm.h"
 #include "crlibm_private.h"
 #include "trigo_fast.h"
+#include "vector_abi.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
 
 extern double scs_sin_rn(double);
 extern double scs_sin_ru(double);
@@ -39,6 +43,8 @@ extern double scs_tan_rn(double);
 extern double scs_tan_rd(double);  
 extern double scs_tan_ru(double);  
 extern double scs_tan_rz(double);  
+extern double scs_sin_dd_rn(double, double);
+extern double scs_cos_dd_rn(double, double);
 extern int rem_pio2_scs(scs_ptr, scs_ptr);
 
 
@@ -291,6 +297,33 @@ static int rem_pio256_scs(scs_ptr result, const scs_ptr x){
   scs_mul(result, Pio256_ptr, result);
   return N*X_SGN;
 }
+
+
+/* The same for x + xl, x being a double in SCS and |xl| <= ulp(x)/2.
+   rem_pio256_scs only reads the first three digits of its argument,
+   so x and xl are reduced separately. The sum of the two reduced
+   arguments lies in [-Pi/256, Pi/256] and is brought back to
+   [-Pi/512, Pi/512]. */
+static int rem_pio256_scs_dd(scs_ptr result, const scs_ptr x, double xl){
+  scs_t XL, YL;
+  double d;
+  int N;
+
+  scs_set_d(XL, xl);
+  N = rem_pio256_scs(result, x);
+  N += rem_pio256_scs(YL, XL);
+  scs_add(result, result, YL);
+  scs_get_d(&d, result);
+  if (d+d > -RR_DD_MCH) {
+    scs_sub(result, result, Pio256_ptr);
+    N++;
+  }
+  else if (d+d < RR_DD_MCH) {
+    scs_add(result, result, Pio256_ptr);
+    N--;
+  }
+  return N;
+}
  
 
 
@@ -356,8 +389,12 @@ do {                                                                \
 do { 							   \
   db_number nb;   double x0,x1,x2,x3;                      \
   scs_t X, Y;						   \
+  SLOW_PATH(CRLIBM_SLOW_SCS_RR);                           \
   scs_set_d(X, rri->x); 			  	   \
-  k= rem_pio256_scs(Y, X);				   \
+  if (xl == 0)                                             \
+    k= rem_pio256_scs(Y, X);				   \
+  else                                                     \
+    k= rem_pio256_scs_dd(Y, X, xl);                        \
   index=(k&127)<<2;                                        \
   quadrant = (k>>7)&3;                                     \
   x0 = (double)(Y->h_word[0]);                             \
@@ -387,19 +424,35 @@ do { 							   \
    result to the the last moment using rri->changesign.
 
    All this is not very elegant, but it is safe.
+
+   ComputeTrigWithArgredDD is the same for the double-double argument
+   rri->x + xl, with |xl| <= ulp(rri->x)/2 (sin_dd_rn etc): xl is
+   accounted for in the computation of k, then added to the reduced
+   argument yh + yl. For xl = 0 it performs exactly the operations of
+   ComputeTrigWithArgred.
+
+   The interval functions also need to know in which quarter period
+   x lies, to detect extrema and poles: it is kept in rri->quarter,
+   only when they are built.
 */
 
+#ifdef BUILD_INTERVAL_FUNCTIONS
+struct rrinfo_s {double rh; double rl; double x; int absxhi; int function; int quarter;} ;
+#define SET_QUARTER(q) rri->quarter = (q)
+#else
 struct rrinfo_s {double rh; double rl; double x; int absxhi; int function;} ;
+#define SET_QUARTER(q)
+#endif
 typedef struct rrinfo_s rrinfo;
 #define changesign function  /* saves one int in the rrinfo structure */
 
-static void ComputeTrigWithArgred(rrinfo *rri){ 
+static void ComputeTrigWithArgredDD(rrinfo *rri, double xl){ 
   double sah,sal,cah,cal, yh, yl, yh2, ts,tc, kd; 
   double kch_h,kch_l, kcm_h,kcm_l, th, tl,sh,sl,ch,cl;
   int k, quadrant, index;
   int64_t kl;
 
-  if  (rri->absxhi < XMAX_CODY_WAITE_3) {
+  if  (rri->absxhi < XMAX_CODY_WAITE_3 && !FORCE_SCS_RR) {
     /* Compute k, deduce the table index and the quadrant */
 #if 0
     DOUBLE2INT(k, rri->x * INV_PIO256);
@@ -407,6 +460,8 @@ static void ComputeTrigWithArgred(rrinfo *rri){
 #else
 		{db_number _t;
 			double _d = rri->x * INV_PIO256;
+			if (xl != 0)
+			  _d += xl * INV_PIO256;
 			_t.d = (_d+6755399441055744.0);
 			k = _t.i[LO];
 			kd=_t.d-6755399441055744.0;
@@ -423,6 +478,8 @@ static void ComputeTrigWithArgred(rrinfo *rri){
       Add12 (th,tl,  kch_l, kcm_h) ;
       /* only rounding error in the last multiplication and addition */ 
       Add22 (&yh, &yl,    (rri->x + kch_h) , (kcm_l - kd*RR_DD_CL),   th, tl) ;
+      if (xl != 0)
+	Add22Cond(&yh, &yl, yh, yl, xl, 0);
       goto computeZero;
     } 
     else {      
@@ -435,13 +492,15 @@ static void ComputeTrigWithArgred(rrinfo *rri){
 	/* CW 3: all this is exact but the rightmost multiplication */
 	Add12Cond(yh,yl,  (rri->x - kd*RR_CW3_CH) -  kd*RR_CW3_CM,   kd*RR_CW3_MCL);
       }
+      if (xl != 0)
+	Add22Cond(&yh, &yl, yh, yl, xl, 0);
     }
     goto computeNotZero;
   }
 
-  else if ( rri->absxhi < XMAX_DDRR ) {
+  else if ( rri->absxhi < XMAX_DDRR && !FORCE_SCS_RR) {
     /* x sufficiently small for a Cody and Waite in double-double */
-    DOUBLE2LONGINT(kl, rri->x*INV_PIO256);
+    DOUBLE2LONGINT(kl, rri->x*INV_PIO256 + xl*INV_PIO256);
     kd=(double)kl;
     quadrant = (kl>>7)&3;
     index=(kl&127)<<2;
@@ -462,7 +521,10 @@ static void ComputeTrigWithArgred(rrinfo *rri){
       Add12 (th,tl,  kch_l, kcm_h) ;
       /* only rounding error in the last multiplication and addition */ 
       Add22 (&yh, &yl,    (rri->x + kch_h) , (kcm_l - kd*RR_DD_CL),   th, tl) ;
+      if (xl != 0)
+	Add22Cond(&yh, &yl, yh, yl, xl, 0);
       //      printf("%f\n", yh);
+      k = (int)(kl & 1023); /* only used for the quarter */
       goto computeNotZero;
     }
   } /* closes if ( absxhi < XMAX_DDRR ) */ 
@@ -480,6 +542,8 @@ static void ComputeTrigWithArgred(rrinfo *rri){
 
 
  computeZero:
+  /* x = k*Pi/256 + y with k a multiple of 128 and y of either sign */
+  SET_QUARTER((k>>7) - (yh<0));
   switch(rri->function) {
  
   case SIN: 
@@ -512,6 +576,7 @@ static void ComputeTrigWithArgred(rrinfo *rri){
   }
   
  computeNotZero:
+  SET_QUARTER(k>>7);
   if(index<=(64<<2)) {                                    
     sah=sincosTable[index+0].d; /* sin(a), high part */   
     sal=sincosTable[index+1].d; /* sin(a), low part  */   
@@ -559,6 +624,10 @@ static void ComputeTrigWithArgred(rrinfo *rri){
   }
 }
 
+static void ComputeTrigWithArgred(rrinfo *rri){ 
+  ComputeTrigWithArgredDD(rri, 0.0);
+}
+
 
 /*************************************************************
  *************************************************************
@@ -591,7 +660,7 @@ double sin_rn(double x){
     x2 = x*x ;
     ts = x2 * (s3.d + x2*(s5.d + x2*s7.d));
     Add12(rri.rh,rri.rl,   x, ts*x);
-    if(rri.rh == (rri.rh + (rri.rl * RN_CST_SIN_CASE2)))	
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_SIN_CASE2)))	
       return rri.rh;
     else
       return scs_sin_rn(x); 
@@ -607,7 +676,7 @@ double sin_rn(double x){
     if(rri.changesign) r= -rri.rh; else r= rri.rh;
 
     rncst= RN_CST_SINCOS_CASE3;
-    if(rri.rh == (rri.rh + (rri.rl * rncst)))	
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * rncst)))	
       return r;
     else
       return scs_sin_rn(x); 
@@ -834,7 +903,7 @@ double cos_rn(double x){
       x2 = x*x;
       tc = x2 * (c2.d + x2*(c4.d + x2*c6.d ));
       Add12(rri.rh,rri.rl, 1.0, tc);
-      if(rri.rh == (rri.rh + (rri.rl * RN_CST_COS_CASE2)))	
+      if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_COS_CASE2)))	
 	return rri.rh;
       else
 	return scs_cos_rn(x); 
@@ -845,7 +914,7 @@ double cos_rn(double x){
     rri.x=x;
     rri.function=COS;
     ComputeTrigWithArgred(&rri);
-    if(rri.rh == (rri.rh + (rri.rl * RN_CST_SINCOS_CASE3)))	
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_SINCOS_CASE3)))	
       if(rri.changesign) return -rri.rh; else return rri.rh;
     else
       return scs_cos_rn(x); 
@@ -1043,7 +1112,7 @@ double tan_rn(double x){
     tt = x2*(t3h.d + (t3l.d + x2*p5));
     Add12(rri.rh, rri.rl, x, x*tt);  
     /* Test if round to nearest achieved */ 
-    if(rri.rh == (rri.rh + (rri.rl * rndcst.d)))
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * rndcst.d)))
       return rri.rh;
     else
       return scs_tan_rn(x); 
@@ -1055,7 +1124,7 @@ double tan_rn(double x){
     ComputeTrigWithArgred(&rri);
 
     /* Test if round to nearest achieved */ 
-    if(rri.rh == (rri.rh + (rri.rl * RN_CST_TAN_CASE3)))
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_TAN_CASE3)))
       if(rri.changesign) return -rri.rh; else return rri.rh;
     else
       return scs_tan_rn(x); 
@@ -1241,3 +1310,920 @@ double tan_rz(double x){
   return  scs_tan_rz(x); 
 }
 
+
+
+
+/*************************************************************
+ *************************************************************
+ *               ROUND TO ODD                                *
+ *************************************************************
+ *************************************************************/
+
+/* See RETURN_RO_FROM_RZ in crlibm_private.h. The sine, cosine and
+   tangent of a non-zero double are never exact: only zero, where
+   sin_rz and tan_rz return x, has to be filtered. Infinities and
+   NaNs return a NaN, which the macro leaves unchanged. */
+
+double sin_ro(double x){
+  if (x == 0.0)
+    return x;
+  RETURN_RO_FROM_RZ(sin_rz(x));
+}
+
+double cos_ro(double x){
+  if (x == 0.0)
+    return 1.0;
+  RETURN_RO_FROM_RZ(cos_rz(x));
+}
+
+double tan_ro(double x){
+  if (x == 0.0)
+    return x;
+  RETURN_RO_FROM_RZ(tan_rz(x));
+}
+
+
+
+
+
+/*************************************************************
+ *************************************************************
+ *      SIN AND COS OF A DOUBLE-DOUBLE, ROUNDED TO NEAREST    *
+ *************************************************************
+ *************************************************************/
+
+/* sin(xh + xl) and cos(xh + xl) for a double-double with
+   |xl| <= ulp(xh)/2. The low part is added to the reduced argument
+   (ComputeTrigWithArgredDD), or in CASE 2 taken into account by the
+   first order term of the Taylor expansion in xl, which costs one
+   more rounding error of order 2^-66.7: the rounding constants of
+   CASE 2 are those of twice the error bound. CASE 1 is skipped, as
+   x may be close to a midpoint. */
+
+#define RN_CST_SIN_DD_CASE2 (2*RN_CST_SIN_CASE2 - 1)
+#define RN_CST_COS_DD_CASE2 (2*RN_CST_COS_CASE2 - 1)
+
+double sin_dd_rn(double xh, double xl){
+  double ts,x2,r;
+  rrinfo rri;
+  db_number x_split;
+
+  x_split.d=xh;
+  rri.absxhi = x_split.i[HI] & 0x7fffffff;
+
+  /* SPECIAL CASES: x=(Nan, Inf) sin(x)=Nan */
+  if (rri.absxhi>=0x7ff00000) {
+    x_split.l=0xfff8000000000000LL;
+    return x_split.d - x_split.d;
+  }
+
+  else if (rri.absxhi < XMAX_SIN_CASE2){
+    /* sin(xh+xl) = sin(xh) + xl(1 - xh^2/2) + O(xl xh^4) */
+    x2 = xh*xh;
+    ts = x2 * (s3.d + x2*(s5.d + x2*s7.d));
+    Add12(rri.rh,rri.rl,   xh, ts*xh + xl*(1.0 - 0.5*x2));
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_SIN_DD_CASE2)))
+      return rri.rh;
+    else
+      return scs_sin_dd_rn(xh, xl);
+  }
+
+  else {
+    rri.x=xh;
+    rri.function=SIN;
+    ComputeTrigWithArgredDD(&rri, xl);
+    if(rri.changesign) r= -rri.rh; else r= rri.rh;
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_SINCOS_CASE3)))
+      return r;
+    else
+      return scs_sin_dd_rn(xh, xl);
+  }
+}
+
+double cos_dd_rn(double xh, double xl){
+  double tc,x2;
+  rrinfo rri;
+  db_number x_split;
+
+  x_split.d=xh;
+  rri.absxhi = x_split.i[HI] & 0x7fffffff;
+
+  /* SPECIAL CASES: x=(Nan, Inf) cos(x)=Nan */
+  if (rri.absxhi>=0x7ff00000) {
+    x_split.l=0xfff8000000000000LL;
+    return x_split.d - x_split.d;
+  }
+
+  if (rri.absxhi < XMAX_COS_CASE2){
+    /* cos(xh+xl) = cos(xh) - xl xh + O(xl xh^3) */
+    x2 = xh*xh;
+    tc = x2 * (c2.d + x2*(c4.d + x2*c6.d ));
+    Add12(rri.rh,rri.rl, 1.0, tc - xh*xl);
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_COS_DD_CASE2)))
+      return rri.rh;
+    else
+      return scs_cos_dd_rn(xh, xl);
+  }
+  else {
+    rri.x=xh;
+    rri.function=COS;
+    ComputeTrigWithArgredDD(&rri, xl);
+    if(QUICK_PHASE && rri.rh == (rri.rh + (rri.rl * RN_CST_SINCOS_CASE3)))
+      if(rri.changesign) return -rri.rh; else return rri.rh;
+    else
+      return scs_cos_dd_rn(xh, xl);
+  }
+}
+
+
+
+
+
+/*************************************************************
+ *************************************************************
+ *               BATCH VERSIONS                              *
+ *************************************************************
+ *************************************************************/
+
+/* The batch versions compute res[i]=f(x[i]) for 0<=i<n.
+
+   Calling the scalar functions in a loop over mixed inputs is slow:
+   the branches of ComputeTrigWithArgred on the magnitude of x and on
+   index==0 are unpredictable, and each function call handles one
+   single lane. Here the inputs are processed by blocks of
+   TRIG_BATCH_BLOCK lanes, in three passes:
+
+   1/ classification: k is computed for every lane, and the lane index
+   is appended to the compacted list of the range reduction path it
+   will take (this pass has no data-dependent branch);
+
+   2/ each list is then reduced by a homogeneous loop (Cody and Waite
+   with 2 or 3 constants, or double-double), and all the reduced
+   arguments are evaluated together: both the sine and the cosine
+   reconstructions are computed, and the quadrant only selects
+   between them;
+
+   3/ the rounding test is performed lane-wise, and only the lanes
+   which fail it are handed to the accurate phase.
+
+   Special inputs, small inputs (cases 1 and 2 of the scalar
+   functions) and inputs which need the SCS range reduction are rare
+   in practice: they are sent to the scalar function.
+*/
+
+#define TRIG_BATCH_BLOCK 256
+
+#define TRIG_PATH_SCALAR 0  /* special, small, or SCS range reduction */
+#define TRIG_PATH_CW2    1  /* Cody and Waite with 2 constants        */
+#define TRIG_PATH_CW3    2  /* Cody and Waite with 3 constants        */
+#define TRIG_PATH_DD     3  /* double-double Cody and Waite, index<>0 */
+#define TRIG_PATH_ZERO   4  /* double-double Cody and Waite, index==0 */
+#define TRIG_NB_PATHS    5
+
+static double (* const trig_scalar[3][4])(double) = {
+  {sin_rn, sin_ru, sin_rd, sin_rz},
+  {cos_rn, cos_ru, cos_rd, cos_rz},
+  {tan_rn, tan_ru, tan_rd, tan_rz}
+};
+
+static double (* const trig_accurate[3][4])(double) = {
+  {scs_sin_rn, scs_sin_ru, scs_sin_rd, scs_sin_rz},
+  {scs_cos_rn, scs_cos_ru, scs_cos_rd, scs_cos_rz},
+  {scs_tan_rn, scs_tan_ru, scs_tan_rd, scs_tan_rz}
+};
+
+
+/* Selects, according to the quadrant, the result of the function out
+   of the approximations sh+sl to sin(y') and ch+cl to cos(y'), where y' is
+   the reduced argument plus the tabulated point. Changes its sign if needed. */
+#define TrigSelect(prh, prl)                                          \
+do {                                                                  \
+  double _nh, _nl, _dh, _dl;                                          \
+  int _odd = quadrant&1, _neg;                                        \
+  if(function==SIN) {                                                 \
+    *(prh) = _odd ? ch : sh;   *(prl) = _odd ? cl : sl;               \
+    _neg = (quadrant==2)||(quadrant==3);                              \
+  }                                                                   \
+  else if(function==COS) {                                            \
+    *(prh) = _odd ? sh : ch;   *(prl) = _odd ? sl : cl;               \
+    _neg = (quadrant==1)||(quadrant==2);                              \
+  }                                                                   \
+  else {                                                              \
+    _nh = _odd ? ch : sh;      _nl = _odd ? cl : sl;                  \
+    _dh = _odd ? sh : ch;      _dl = _odd ? sl : cl;                  \
+    Div22(prh, prl, _nh, _nl, _dh, _dl);                              \
+    _neg = _odd;                                                      \
+  }                                                                   \
+  if(_neg) {*(prh) = -*(prh);  *(prl) = -*(prl);}                     \
+} while(0)
+
+
+static void TrigBatch(double *res, const double *x, int n, int function, int mode){
+  int lanes[TRIG_NB_PATHS][TRIG_BATCH_BLOCK], count[TRIG_NB_PATHS];
+  int kb[TRIG_BATCH_BLOCK], lane[TRIG_BATCH_BLOCK], failed[TRIG_BATCH_BLOCK];
+  double kdb[TRIG_BATCH_BLOCK], yhb[TRIG_BATCH_BLOCK], ylb[TRIG_BATCH_BLOCK];
+  double rhb[TRIG_BATCH_BLOCK], rlb[TRIG_BATCH_BLOCK];
+  double sah,sal,cah,cal, yh, yl, yh2, ts,tc, kd;
+  double kch_h,kch_l, kcm_h,kcm_l, th, tl, sh,sl,ch,cl;
+  double t0,t1,t2,t3, rncst, epsilon;
+  double (*scalar)(double), (*accurate)(double);
+  const double *xb;
+  double *resb;
+  db_number xdb, t;
+  int absxhi, xmax_case2, nb, nnz, nz, nfailed, ok, i, j, p, base;
+  int k, index, quadrant, fold;
+
+  scalar   = trig_scalar[function][mode];
+  accurate = trig_accurate[function][mode];
+  if(function==SIN)      xmax_case2 = XMAX_SIN_CASE2;
+  else if(function==COS) xmax_case2 = XMAX_COS_CASE2;
+  else                   xmax_case2 = XMAX_TAN_CASE2;
+  if(function==TAN) { rncst = RN_CST_TAN_CASE3;     epsilon = EPS_TAN_CASE3; }
+  else              { rncst = RN_CST_SINCOS_CASE3;  epsilon = EPS_SINCOS_CASE3; }
+
+  for(base=0; base<n; base+=TRIG_BATCH_BLOCK) {
+    nb = (n-base < TRIG_BATCH_BLOCK) ? n-base : TRIG_BATCH_BLOCK;
+    xb = x + base;
+    resb = res + base;
+
+    /* Pass 1: classification. For |x| < XMAX_DDRR, the k computed by
+       the magic number trick is exact, and its low 32 bits are those
+       of the long long int used in the double-double range reduction */
+    for(p=0; p<TRIG_NB_PATHS; p++)
+      count[p]=0;
+    for(i=0; i<nb; i++) {
+      xdb.d = xb[i];
+      absxhi = xdb.i[HI] & 0x7fffffff;
+      t.d = xb[i]*INV_PIO256 + 6755399441055744.0;
+      kb[i] = t.i[LO];
+      kdb[i] = t.d - 6755399441055744.0;
+      if((absxhi < xmax_case2) || (absxhi >= XMAX_DDRR))
+	p = TRIG_PATH_SCALAR;
+      else if ((kb[i]&127) == 0)
+	p = (absxhi < XMAX_CODY_WAITE_3) ? TRIG_PATH_ZERO : TRIG_PATH_SCALAR;
+      else if (absxhi < XMAX_CODY_WAITE_2)
+	p = TRIG_PATH_CW2;
+      else 
+	p = (absxhi < XMAX_CODY_WAITE_3) ? TRIG_PATH_CW3 : TRIG_PATH_DD;
+      lanes[p][count[p]++] = i;
+    }
+
+    /* Scalar lanes */
+    for(j=0; j<count[TRIG_PATH_SCALAR]; j++) {
+      i = lanes[TRIG_PATH_SCALAR][j];
+      resb[i] = scalar(xb[i]);
+    }
+
+    /* Pass 2: range reduction of the index<>0 lanes, one loop per path,
+       the reduced arguments being stored contiguously */
+    nnz=0;
+    for(j=0; j<count[TRIG_PATH_CW2]; j++, nnz++) {
+      i = lanes[TRIG_PATH_CW2][j];
+      kd = kdb[i];
+      Add12 (yhb[nnz],ylb[nnz],  (xb[i] - kd*RR_CW2_CH),  (kd*RR_CW2_MCL) ) ; 
+      lane[nnz] = i;
+    }
+    for(j=0; j<count[TRIG_PATH_CW3]; j++, nnz++) {
+      i = lanes[TRIG_PATH_CW3][j];
+      kd = kdb[i];
+      Add12Cond(yhb[nnz],ylb[nnz],  (xb[i] - kd*RR_CW3_CH) -  kd*RR_CW3_CM,   kd*RR_CW3_MCL);
+      lane[nnz] = i;
+    }
+    for(j=0; j<count[TRIG_PATH_DD]; j++, nnz++) {
+      i = lanes[TRIG_PATH_DD][j];
+      kd = kdb[i];
+      Mul12(&kch_h, &kch_l,   kd, RR_DD_MCH);
+      Mul12(&kcm_h, &kcm_l,   kd, RR_DD_MCM);
+      Add12 (th,tl,  kch_l, kcm_h) ;
+      Add22 (&yhb[nnz], &ylb[nnz],    (xb[i] + kch_h) , (kcm_l - kd*RR_DD_CL),   th, tl) ;
+      lane[nnz] = i;
+    }
+
+    /* Evaluation of the index<>0 lanes */
+    for(j=0; j<nnz; j++) {
+      k = kb[lane[j]];
+      quadrant = (k>>7)&3;
+      index=(k&127)<<2;
+      fold = (index > (64<<2));  /* then cah <= sah */
+      if(fold) index=(128<<2) - index;
+      t0=sincosTable[index+0].d;
+      t1=sincosTable[index+1].d;
+      t2=sincosTable[index+2].d;
+      t3=sincosTable[index+3].d;
+      sah = fold ? t2 : t0; 
+      sal = fold ? t3 : t1;
+      cah = fold ? t0 : t2;
+      cal = fold ? t1 : t3;
+      yh = yhb[j];
+      yl = ylb[j];
+      yh2 = yh*yh ;
+      ts = yh2 * (s3.d + yh2*(s5.d + yh2*s7.d));	
+      tc = yh2 * (c2.d + yh2*(c4.d + yh2*c6.d ));	
+      DoSinNotZero(&sh, &sl);
+      DoCosNotZero(&ch, &cl);
+      TrigSelect(&rhb[j], &rlb[j]);
+    }
+
+    /* Range reduction and evaluation of the index==0 lanes, appended
+       after the others */
+    nz = count[TRIG_PATH_ZERO];
+    for(j=0; j<nz; j++) {
+      i = lanes[TRIG_PATH_ZERO][j];
+      kd = kdb[i];
+      quadrant = (kb[i]>>7)&3;
+      Mul12(&kch_h, &kch_l,   kd, RR_DD_MCH);
+      Mul12(&kcm_h, &kcm_l,   kd, RR_DD_MCM);
+      Add12 (th,tl,  kch_l, kcm_h) ;
+      Add22 (&yh, &yl,    (xb[i] + kch_h) , (kcm_l - kd*RR_DD_CL),   th, tl) ;
+      DoSinZero(&sh, &sl);
+      DoCosZero(&ch, &cl);
+      TrigSelect(&rhb[nnz+j], &rlb[nnz+j]);
+      lane[nnz+j] = i;
+    }
+    nnz += nz;
+
+    /* Pass 3: lane-wise rounding test */
+    nfailed = 0;
+    switch(mode) {
+    case CRLIBM_RN:
+      for(j=0; j<nnz; j++) {
+	resb[lane[j]] = rhb[j];
+	failed[nfailed] = lane[j];
+	nfailed += (rhb[j] != (rhb[j] + (rlb[j] * rncst)));
+      }
+      break;
+    case CRLIBM_RU:
+      for(j=0; j<nnz; j++) {
+	TEST_AND_COPY_RU(ok, resb[lane[j]], rhb[j], rlb[j], epsilon);
+	failed[nfailed] = lane[j];
+	nfailed += !ok;
+      }
+      break;
+    case CRLIBM_RD:
+      for(j=0; j<nnz; j++) {
+	TEST_AND_COPY_RD(ok, resb[lane[j]], rhb[j], rlb[j], epsilon);
+	failed[nfailed] = lane[j];
+	nfailed += !ok;
+      }
+      break;
+    case CRLIBM_RZ:
+      for(j=0; j<nnz; j++) {
+	TEST_AND_COPY_RZ(ok, resb[lane[j]], rhb[j], rlb[j], epsilon);
+	failed[nfailed] = lane[j];
+	nfailed += !ok;
+      }
+      break;
+    }
+
+    /* Accurate phase for the lanes which failed the rounding test */
+    for(j=0; j<nfailed; j++) {
+      i = failed[j];
+      resb[i] = accurate(xb[i]);
+    }
+  }
+}
+
+
+void sin_rn_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, SIN, CRLIBM_RN); }
+void sin_ru_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, SIN, CRLIBM_RU); }
+void sin_rd_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, SIN, CRLIBM_RD); }
+void sin_rz_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, SIN, CRLIBM_RZ); }
+
+void cos_rn_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, COS, CRLIBM_RN); }
+void cos_ru_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, COS, CRLIBM_RU); }
+void cos_rd_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, COS, CRLIBM_RD); }
+void cos_rz_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, COS, CRLIBM_RZ); }
+
+void tan_rn_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, TAN, CRLIBM_RN); }
+void tan_ru_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, TAN, CRLIBM_RU); }
+void tan_rd_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, TAN, CRLIBM_RD); }
+void tan_rz_batch(double *res, const double *x, int n){ TrigBatch(res, x, n, TAN, CRLIBM_RZ); }
+
+
+
+
+#ifdef BUILD_VECTOR_ABI
+/*************************************************************
+ *************************************************************
+ *               VECTOR VERSIONS                             *
+ *************************************************************
+ *************************************************************/
+
+/* The lane kernels of the vector variants, see vector_abi.h. The
+   vector path is the one of case 3 with the Cody and Waite range
+   reduction with 2 or 3 constants (both are computed, and selected
+   lane-wise) and index<>0. Both the sine and the cosine
+   reconstructions are computed, and the quadrant selects between them
+   and gives the sign, as in TrigSelect. The lanes which are special,
+   small, too large, with index==0, or which fail the rounding test go
+   through the scalar function. */
+
+#define TRIG_LANES(name, vd, vl, n)                                     \
+VECTOR_KERNEL void name(double *res, const double *x, int function, int mode) { \
+  vd xv, t, kd, yh, yl, yh2, y2h, y2l, ts, tc, sah, sal, cah, cal;      \
+  vd thi, tlo, cahyh_h, cahyh_l, sahyh_h, sahyh_l;                      \
+  vd sh, sl, ch, cl, nh, nl, dh, dl, rh, rl;                            \
+  vl xAbs, k, quadrant, index, fold, odd, neg, is, ic, roundable, fail; \
+  long long int xmax_case2;                                             \
+  double rncst, epsilon;                                                \
+  int l;                                                                \
+                                                                        \
+  if(function==SIN)      xmax_case2 = XMAX_SIN_CASE2;                   \
+  else if(function==COS) xmax_case2 = XMAX_COS_CASE2;                   \
+  else                   xmax_case2 = XMAX_TAN_CASE2;                   \
+  if(function==TAN) { rncst = RN_CST_TAN_CASE3;     epsilon = EPS_TAN_CASE3; }    \
+  else              { rncst = RN_CST_SINCOS_CASE3;  epsilon = EPS_SINCOS_CASE3; } \
+                                                                        \
+  memcpy(&xv, x, sizeof(xv));                                           \
+  xAbs = ((vl) xv) & ULL(7fffffffffffffff);                             \
+                                                                        \
+  t = xv*INV_PIO256 + 6755399441055744.0;                               \
+  kd = t - 6755399441055744.0;                                          \
+  k = ((vl) t) - ((vl) VSplat(vd, 6755399441055744.0));                 \
+  quadrant = (k>>7)&3;                                                  \
+  index = k&127;                                                        \
+  fold = (index > 64);  /* then cah <= sah */                           \
+  index = VSelect(fold, 128 - index, index) << 2;                       \
+  is = index + (fold & 2);                                              \
+  ic = index + (~fold & 2);                                             \
+  VECTOR_UNROLL                                                         \
+  for(l=0; l<n; l++) {                                                  \
+    sah[l] = sincosTable[is[l]+0].d;                                    \
+    sal[l] = sincosTable[is[l]+1].d;                                    \
+    cah[l] = sincosTable[ic[l]+0].d;                                    \
+    cal[l] = sincosTable[ic[l]+1].d;                                    \
+  }                                                                     \
+                                                                        \
+  VAdd12(yh, yl, (xv - kd*RR_CW2_CH), (kd*RR_CW2_MCL));                 \
+  VAdd12Cond(y2h, y2l, (xv - kd*RR_CW3_CH) - kd*RR_CW3_CM, kd*RR_CW3_MCL); \
+  yh = VSelect(xAbs < (((long long int) XMAX_CODY_WAITE_2) << 32), yh, y2h); \
+  yl = VSelect(xAbs < (((long long int) XMAX_CODY_WAITE_2) << 32), yl, y2l); \
+                                                                        \
+  yh2 = yh*yh ;                                                         \
+  ts = yh2 * (s3.d + yh2*(s5.d + yh2*s7.d));                            \
+  tc = yh2 * (c2.d + yh2*(c4.d + yh2*c6.d ));                           \
+                                                                        \
+  /* DoSinNotZero */                                                    \
+  VMul12(cahyh_h, cahyh_l, cah, yh);                                    \
+  VAdd12(thi, tlo, sah, cahyh_h);                                       \
+  tlo = tc*sah+(ts*cahyh_h+(sal+(tlo+(cahyh_l+(cal*yh + cah*yl)))));    \
+  VAdd12(sh, sl, thi, tlo);                                             \
+                                                                        \
+  /* DoCosNotZero */                                                    \
+  VMul12(sahyh_h, sahyh_l, sah, yh);                                    \
+  VAdd12(thi, tlo, cah, -sahyh_h);                                      \
+  tlo = tc*cah-(ts*sahyh_h-(cal+(tlo-(sahyh_l+(sal*yh+sah*yl)))));      \
+  VAdd12(ch, cl, thi, tlo);                                             \
+                                                                        \
+  odd = ((quadrant&1) != 0);                                            \
+  if(function==SIN) {                                                   \
+    rh = VSelect(odd, ch, sh);  rl = VSelect(odd, cl, sl);              \
+    neg = ((quadrant&2) != 0);                                          \
+  }                                                                     \
+  else if(function==COS) {                                              \
+    rh = VSelect(odd, sh, ch);  rl = VSelect(odd, sl, cl);              \
+    neg = (((quadrant+1)&2) != 0);                                      \
+  }                                                                     \
+  else {                                                                \
+    nh = VSelect(odd, ch, sh);  nl = VSelect(odd, cl, sl);              \
+    dh = VSelect(odd, sh, ch);  dl = VSelect(odd, sl, cl);              \
+    VDiv22(rh, rl, nh, nl, dh, dl);                                     \
+    neg = odd;                                                          \
+  }                                                                     \
+  rh = (vd) (((vl) rh) ^ (neg & ULL(8000000000000000)));                \
+  rl = (vd) (((vl) rl) ^ (neg & ULL(8000000000000000)));                \
+                                                                        \
+  VTestAndCopy(roundable, rh, rl,                                       \
+               (mode==CRLIBM_RN) ? rncst : epsilon, mode, vd, vl);      \
+  memcpy(res, &rh, sizeof(rh));                                         \
+                                                                        \
+  fail = ~roundable                                                     \
+    | (xAbs < (xmax_case2 << 32))                                       \
+    | (xAbs >= (((long long int) XMAX_CODY_WAITE_3) << 32))             \
+    | ((k&127) == 0);                                                   \
+  for(l=0; l<n; l++) {                                                  \
+    if(fail[l])                                                         \
+      res[l] = trig_scalar[function][mode](x[l]);                       \
+  }                                                                     \
+}
+
+VECTOR_LANE_KERNELS(TRIG_LANES, trig_lanes)
+
+VECTOR_ABI_VARIANTS(sin_rn, trig_lanes, SIN, CRLIBM_RN)
+VECTOR_ABI_VARIANTS(sin_ru, trig_lanes, SIN, CRLIBM_RU)
+VECTOR_ABI_VARIANTS(sin_rd, trig_lanes, SIN, CRLIBM_RD)
+VECTOR_ABI_VARIANTS(sin_rz, trig_lanes, SIN, CRLIBM_RZ)
+
+VECTOR_ABI_VARIANTS(cos_rn, trig_lanes, COS, CRLIBM_RN)
+VECTOR_ABI_VARIANTS(cos_ru, trig_lanes, COS, CRLIBM_RU)
+VECTOR_ABI_VARIANTS(cos_rd, trig_lanes, COS, CRLIBM_RD)
+VECTOR_ABI_VARIANTS(cos_rz, trig_lanes, COS, CRLIBM_RZ)
+
+VECTOR_ABI_VARIANTS(tan_rn, trig_lanes, TAN, CRLIBM_RN)
+VECTOR_ABI_VARIANTS(tan_ru, trig_lanes, TAN, CRLIBM_RU)
+VECTOR_ABI_VARIANTS(tan_rd, trig_lanes, TAN, CRLIBM_RD)
+VECTOR_ABI_VARIANTS(tan_rz, trig_lanes, TAN, CRLIBM_RZ)
+
+#endif /* BUILD_VECTOR_ABI */
+
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Quick phase of sin, cos or tan for one bound of an interval, without
+   the final rounding. Returns the index modulo 8 of the quarter period
+   containing x, so that x is in [q*Pi/2, (q+1)*Pi/2]. The cases where
+   the scalar functions return without any polynomial are left to them,
+   by setting rh = rl = 0 so that the rounding test fails. */
+static int TrigQuickBound(rrinfo *rri, double *epsilon, double x, int function){
+  double x2, ts, tc, p5, tt;
+  db_number x_split;
+  int xmax_case2, xmax_case1, quarter;
+
+  x_split.d=x;
+  rri->absxhi = x_split.i[HI] & 0x7fffffff;
+
+  switch(function) {
+  case SIN: xmax_case2=XMAX_SIN_CASE2; xmax_case1=XMAX_RETURN_X_FOR_SIN; break;
+  case COS: xmax_case2=XMAX_COS_CASE2; xmax_case1=XMAX_RETURN_1_FOR_COS_RDIR; break;
+  default:  xmax_case2=XMAX_TAN_CASE2; xmax_case1=XMAX_RETURN_X_FOR_TAN; break;
+  }
+
+  if (rri->absxhi < xmax_case2){
+    rri->rh = 0;
+    rri->rl = 0;
+    *epsilon = EPS_SINCOS_CASE3;
+    if (rri->absxhi >= xmax_case1) {
+      x2 = x*x;
+      switch(function) {
+      case SIN:
+	ts = x * x2 * (s3.d + x2*(s5.d + x2*s7.d ));
+	Add12(rri->rh,rri->rl, x, ts);
+	*epsilon=EPS_SIN_CASE2;
+	break;
+      case COS:
+	tc = x2 * (c2.d + x2*(c4.d + x2*c6.d ));
+	Add12(rri->rh,rri->rl, 1, tc);
+	*epsilon=EPS_COS_CASE2;
+	break;
+      default:
+	p5 = t5.d + x2*(t7.d + x2*(t9.d + x2*t11.d));
+	tt = x2*(t3h.d + (t3l.d +x2*p5));
+	Add12(rri->rh, rri->rl, x, x*tt);
+	*epsilon=EPS_TAN_CASE2;
+	break;
+      }
+    }
+    return (x<0) ? 7 : 0;
+  }
+
+  rri->x=x;
+  rri->function=function;
+  ComputeTrigWithArgred(rri);
+  quarter = rri->quarter & 7;
+  *epsilon = (function==TAN) ? EPS_TAN_CASE3 : EPS_SINCOS_CASE3;
+  if(rri->changesign) {
+    rri->rh = -rri->rh;
+    rri->rl = -rri->rl;
+  }
+  return quarter;
+}
+
+
+/* Common part of j_sin and j_cos */
+static interval SineLikeInterval(double x_inf, double x_sup, int function){
+  interval res;
+  rrinfo rri_inf, rri_sup;
+  double eps_inf, eps_sup, res_inf, res_sup, r1, r2;
+  int q_inf, q_sup, has_max, has_min, inc, roundable, ok1, ok2;
+  double (*f_rd)(double) = (function==SIN) ? sin_rd : cos_rd;
+  double (*f_ru)(double) = (function==SIN) ? sin_ru : cos_ru;
+
+  /* Empty, or both bounds at the same infinity */
+  if (!(x_inf<=x_sup) || (x_inf == 1.0/0.0) || (x_sup == -1.0/0.0)) RETURN_EMPTY_INTERVAL;
+
+  /* More than a period: this also catches infinite bounds */
+  if (!(x_sup - x_inf < 7.0)) {
+    ASSIGN_LOW(res,-1.0);
+    ASSIGN_UP(res,1.0);
+    return res;
+  }
+
+  q_inf = TrigQuickBound(&rri_inf, &eps_inf, x_inf, function);
+  q_sup = TrigQuickBound(&rri_sup, &eps_sup, x_sup, function);
+
+  SINE_EXTREMA(has_max, has_min, inc, q_inf, (q_sup - q_inf) & 7, (function==COS));
+
+  if (has_max && has_min) {
+    res_inf = -1.0;
+    res_sup = 1.0;
+  }
+  else if (has_max) {
+    res_sup = 1.0;
+    TEST_AND_COPY_RD(ok1, r1, rri_inf.rh, rri_inf.rl, eps_inf);
+    TEST_AND_COPY_RD(ok2, r2, rri_sup.rh, rri_sup.rl, eps_sup);
+    if (!ok1) r1 = f_rd(x_inf);
+    if (!ok2) r2 = f_rd(x_sup);
+    res_inf = (r1 < r2) ? r1 : r2;
+  }
+  else if (has_min) {
+    res_inf = -1.0;
+    TEST_AND_COPY_RU(ok1, r1, rri_inf.rh, rri_inf.rl, eps_inf);
+    TEST_AND_COPY_RU(ok2, r2, rri_sup.rh, rri_sup.rl, eps_sup);
+    if (!ok1) r1 = f_ru(x_inf);
+    if (!ok2) r2 = f_ru(x_sup);
+    res_sup = (r1 > r2) ? r1 : r2;
+  }
+  else if (inc) {
+    TEST_AND_COPY_RDRU(roundable, res_inf, rri_inf.rh, rri_inf.rl, res_sup, rri_sup.rh, rri_sup.rl, eps_inf, eps_sup);
+    if ((roundable & 1) == 0) res_inf = f_rd(x_inf);
+    if ((roundable & 2) == 0) res_sup = f_ru(x_sup);
+  }
+  else {
+    TEST_AND_COPY_RDRU(roundable, res_inf, rri_sup.rh, rri_sup.rl, res_sup, rri_inf.rh, rri_inf.rl, eps_sup, eps_inf);
+    if ((roundable & 1) == 0) res_inf = f_rd(x_sup);
+    if ((roundable & 2) == 0) res_sup = f_ru(x_inf);
+  }
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+
+
+interval j_sin(interval x)
+{
+  return SineLikeInterval(LOW(x), UP(x), SIN);
+}
+
+
+interval j_cos(interval x)
+{
+  return SineLikeInterval(LOW(x), UP(x), COS);
+}
+
+
+interval j_tan(interval x)
+{
+  interval res;
+  rrinfo rri_inf, rri_sup;
+  double x_inf, x_sup, eps_inf, eps_sup, res_inf, res_sup;
+  int q_inf, q_sup, d, roundable;
+
+  x_inf=LOW(x);
+  x_sup=UP(x);
+  if (!(x_inf<=x_sup) || (x_inf == 1.0/0.0) || (x_sup == -1.0/0.0)) RETURN_EMPTY_INTERVAL;
+  if (!(x_sup - x_inf < 3.0)) RETURN_ENTIRE_INTERVAL;
+
+  q_inf = TrigQuickBound(&rri_inf, &eps_inf, x_inf, TAN);
+  q_sup = TrigQuickBound(&rri_sup, &eps_sup, x_sup, TAN);
+
+  /* The poles are the odd multiples of Pi/2 */
+  d = (q_sup - q_inf) & 7;
+  if ((d >= 2) || ((d == 1) && (q_sup & 1))) RETURN_ENTIRE_INTERVAL;
+
+  TEST_AND_COPY_RDRU(roundable, res_inf, rri_inf.rh, rri_inf.rl, res_sup, rri_sup.rh, rri_sup.rl, eps_inf, eps_sup);
+  if ((roundable & 1) == 0) res_inf = tan_rd(x_inf);
+  if ((roundable & 2) == 0) res_sup = tan_ru(x_sup);
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
+
+
+
+
+/*************************************************************
+ *************************************************************
+ *               BINARY32 VERSIONS                           *
+ *************************************************************
+ *************************************************************/
+
+/* sinf and cosf, for a float x, in one step in double precision.
+
+   x = k Pi/256 + y, where y is a double-double: for |x| <
+   XMAX_CODY_WAITE_3, by the Cody and Waite reduction with 3 constants
+   when k mod 128 <> 0 and in double-double otherwise, as in
+   ComputeTrigWithArgred. Above, x is the product of a 24-bit integer
+   and a power of two, and its product by a chunk of 26 bits of 256/Pi
+   is exact: the chunks of inv_pio256_chunks are multiplied by x and
+   reduced modulo 512, the ones which only give multiples of 512 being
+   skipped, and the residues are summed in double-double. This leaves
+   an absolute error below 2^-90 on x*256/Pi, whereas for a float x
+   this number is never closer to an integer multiple of 128 than
+   2^-40 (the kernel checks it).
+
+   With a = (k mod 128) Pi/256 and |y| < Pi/512, sin(a+y) and
+   cos(a+y) are reconstructed as in DoSinNotZero and DoCosNotZero,
+   from the table of sin(a) and cos(a) (sah, sal, cah, cal), where
+   cos(y) = 1 + tc and sin(y) = yh + (yl + yh ts):
+
+     sin(a+y) = sah + (sal + sah tc + cah sin(y)),
+     cos(a+y) = cah + (cal + cah tc - sah sin(y)).
+
+   For index 0, sah=sal=cal=0 and cah=1, and these are DoSinZero and
+   DoCosZero. Otherwise the result is larger than sin(Pi/512), and
+   the cancellation in cos(a+y) is at most one bit, so the relative
+   error is below 2^-49 (see TEST_AND_COPY_FLOAT). The quadrant
+   selects the reconstruction and the sign as in the vector kernels.
+
+   The kernels return 0 for Inf and NaN, so that the rounding test
+   fails and the double function is called. */
+
+/* 256/Pi in chunks of 26 bits, the first at 2^6 */
+static const double inv_pio256_chunks[10] = {
+  0x1.45f3068p+6,   0x1.72722080p-20, 0x1.4a7f09p-47,  0x1.abe8fa8p-72,
+  0x1.a6ee06p-100,  0x1.b629590p-125, 0x1.2788720p-150, 0x1.07f944p-179,
+  0x1.8eaf7ap-203,  0x1.de2b0d8p-228
+};
+
+#define SINCOSF_NB_CHUNKS 6
+
+static int sincosf_reduce_large(double x, int *k, double *yh, double *yl) {
+  db_number xdb;
+  double t, q, r, s, e, sh, sl, kd, fh, fl;
+  int j, j0, ex;
+
+  xdb.d = x;
+  ex = ((xdb.i[HI] >> 20) & 0x7ff) - 1023;
+  /* the chunks before j0 only give multiples of 512 */
+  j0 = (ex > 51) ? (ex - 51 + 25) / 26 : 0;
+  sh = 0.0;
+  sl = 0.0;
+  for(j=j0; j<j0+SINCOSF_NB_CHUNKS; j++) {
+    t = x * inv_pio256_chunks[j];                     /* exact */
+    q = (t * (1.0/512.0) + 6755399441055744.0) - 6755399441055744.0;
+    r = t - 512.0 * q;                                /* exact */
+    Add12Cond(s, e, sh, r);
+    sh = s;
+    sl += e;
+  }
+  kd = (sh + 6755399441055744.0) - 6755399441055744.0;
+  Add12Cond(fh, fl, sh - kd, sl);
+  if((fh > -0x1p-40) && (fh < 0x1p-40))
+    return 0;
+  *k = (int) kd;
+  Mul12(yh, &t, fh, -RR_DD_MCH);
+  *yl = t + (fh * -RR_DD_MCM + fl * -RR_DD_MCH);
+  return 1;
+}
+
+static inline double sincosf_quick(double x, int function) {
+  db_number xdb, tdb;
+  double kd, yh, yl, yh2, ts, tc, sy, sah, sal, cah, cal;
+  double kch_h, kch_l, kcm_h, kcm_l, th, tl, res;
+  int absxhi, k, quadrant, index, fold, is, ic;
+
+  xdb.d = x;
+  absxhi = xdb.i[HI] & 0x7fffffff;
+  if(absxhi >= 0x7ff00000)
+    return 0.0;
+
+  if(absxhi < XMAX_CODY_WAITE_3) {
+    tdb.d = x * INV_PIO256 + 6755399441055744.0;
+    kd = tdb.d - 6755399441055744.0;
+    k = (int) tdb.l;
+    if((k & 127) == 0) {
+      Mul12(&kch_h, &kch_l,   kd, RR_DD_MCH);
+      Mul12(&kcm_h, &kcm_l,   kd, RR_DD_MCM);
+      Add12 (th,tl,  kch_l, kcm_h) ;
+      Add22 (&yh, &yl,    (x + kch_h) , (kcm_l - kd*RR_DD_CL),   th, tl) ;
+    }
+    else
+      Add12Cond(yh,yl,  (x - kd*RR_CW3_CH) -  kd*RR_CW3_CM,   kd*RR_CW3_MCL);
+  }
+  else if(!sincosf_reduce_large(x, &k, &yh, &yl))
+    return 0.0;
+
+  quadrant = (k>>7)&3;
+  index = k&127;
+  fold = (index > 64);  /* then cah <= sah */
+  index = (fold ? 128 - index : index) << 2;
+  is = index + (fold << 1);
+  ic = index + 2 - (fold << 1);
+  sah = sincosTable[is+0].d;
+  sal = sincosTable[is+1].d;
+  cah = sincosTable[ic+0].d;
+  cal = sincosTable[ic+1].d;
+
+  yh2 = yh*yh ;
+  ts = yh2 * (s3.d + yh2*(s5.d + yh2*s7.d));
+  tc = yh2 * (c2.d + yh2*(c4.d + yh2*c6.d ));
+  sy = yh + (yl + yh*ts);
+
+  if((quadrant + function) & 1)
+    res = cah + (cal + cah*tc - sah*sy);
+  else
+    res = sah + (sal + sah*tc + cah*sy);
+  return ((quadrant + function) & 2) ? -res : res;
+}
+
+
+#ifdef BUILD_VECTOR_ABI
+/* The same on four lanes, for the batch versions: both reductions and
+   both reconstructions are computed, and selected lane-wise. The
+   lanes above XMAX_CODY_WAITE_3 return 0 and go through the scalar
+   function. */
+VECTOR_KERNEL void sincosf_lanes(v4df *res, const v4df *xp, int function) {
+  v4df x, t, kd, yh, yl, y2h, y2l, kch_h, kch_l, kcm_h, kcm_l, th, tl;
+  v4df yh2, ts, tc, sy, sah, sal, cah, cal, rs, rc, r;
+  v4di k, quadrant, index, fold, is, ic, odd, neg;
+  int l;
+
+  x = *xp;
+
+  t = x*INV_PIO256 + 6755399441055744.0;
+  kd = t - 6755399441055744.0;
+  k = ((v4di) t) - ((v4di) VSplat(v4df, 6755399441055744.0));
+  quadrant = (k>>7)&3;
+  index = k&127;
+  fold = (index > 64);
+  index = VSelect(fold, 128 - index, index) << 2;
+  is = index + (fold & 2);
+  ic = index + (~fold & 2);
+  VECTOR_UNROLL
+  for(l=0; l<4; l++) {
+    sah[l] = sincosTable[is[l]+0].d;
+    sal[l] = sincosTable[is[l]+1].d;
+    cah[l] = sincosTable[ic[l]+0].d;
+    cal[l] = sincosTable[ic[l]+1].d;
+  }
+
+  VAdd12Cond(yh, yl, (x - kd*RR_CW3_CH) - kd*RR_CW3_CM, kd*RR_CW3_MCL);
+  VMul12(kch_h, kch_l, kd, VSplat(v4df, RR_DD_MCH));
+  VMul12(kcm_h, kcm_l, kd, VSplat(v4df, RR_DD_MCM));
+  VAdd12(th, tl, kch_l, kcm_h);
+  VAdd22(y2h, y2l, (x + kch_h), (kcm_l - kd*RR_DD_CL), th, tl);
+  yh = VSelect((k&127) == 0, y2h, yh);
+  yl = VSelect((k&127) == 0, y2l, yl);
+
+  yh2 = yh*yh ;
+  ts = yh2 * (s3.d + yh2*(s5.d + yh2*s7.d));
+  tc = yh2 * (c2.d + yh2*(c4.d + yh2*c6.d ));
+  sy = yh + (yl + yh*ts);
+  rs = sah + (sal + sah*tc + cah*sy);
+  rc = cah + (cal + cah*tc - sah*sy);
+
+  odd = (((quadrant + function) & 1) != 0);
+  neg = (((quadrant + function) & 2) != 0);
+  r = VSelect(odd, rc, rs);
+  r = (v4df) (((v4di) r) ^ (neg & ULL(8000000000000000)));
+  *res = VSelect(((v4di) VAbs(x, v4di)) < (((long long int) XMAX_CODY_WAITE_3) << 32),
+                 r, VSplat(v4df, 0.0));
+}
+
+VECTOR_KERNEL void sinf_lanes_4(v4df *res, const v4df *x) { sincosf_lanes(res, x, SIN); }
+VECTOR_KERNEL void cosf_lanes_4(v4df *res, const v4df *x) { sincosf_lanes(res, x, COS); }
+#endif /* BUILD_VECTOR_ABI */
+
+
+static inline float sinf_round(float x, int mode) {
+  float res;
+  int roundable;
+
+  TEST_AND_COPY_FLOAT(roundable, res, sincosf_quick(x, SIN), mode);
+  if(roundable)
+    return res;
+  return float_from_ro(sin_ro(x), mode);
+}
+
+static inline float cosf_round(float x, int mode) {
+  float res;
+  int roundable;
+
+  TEST_AND_COPY_FLOAT(roundable, res, sincosf_quick(x, COS), mode);
+  if(roundable)
+    return res;
+  return float_from_ro(cos_ro(x), mode);
+}
+
+float sinf_rn(float x){ return sinf_round(x, CRLIBM_RN); }
+float sinf_rd(float x){ return sinf_round(x, CRLIBM_RD); }
+float sinf_ru(float x){ return sinf_round(x, CRLIBM_RU); }
+float sinf_rz(float x){ return sinf_round(x, CRLIBM_RZ); }
+
+float cosf_rn(float x){ return cosf_round(x, CRLIBM_RN); }
+float cosf_rd(float x){ return cosf_round(x, CRLIBM_RD); }
+float cosf_ru(float x){ return cosf_round(x, CRLIBM_RU); }
+float cosf_rz(float x){ return cosf_round(x, CRLIBM_RZ); }
+
+#ifdef BUILD_VECTOR_ABI
+VECTOR_FLOAT_BATCH(sinf_rn, sinf_lanes_4, CRLIBM_RN)
+VECTOR_FLOAT_BATCH(sinf_rd, sinf_lanes_4, CRLIBM_RD)
+VECTOR_FLOAT_BATCH(sinf_ru, sinf_lanes_4, CRLIBM_RU)
+VECTOR_FLOAT_BATCH(sinf_rz, sinf_lanes_4, CRLIBM_RZ)
+VECTOR_FLOAT_BATCH(cosf_rn, cosf_lanes_4, CRLIBM_RN)
+VECTOR_FLOAT_BATCH(cosf_rd, cosf_lanes_4, CRLIBM_RD)
+VECTOR_FLOAT_BATCH(cosf_ru, cosf_lanes_4, CRLIBM_RU)
+VECTOR_FLOAT_BATCH(cosf_rz, cosf_lanes_4, CRLIBM_RZ)
+#else
+FLOAT_BATCH(sinf_rn)
+FLOAT_BATCH(sinf_rd)
+FLOAT_BATCH(sinf_ru)
+FLOAT_BATCH(sinf_rz)
+FLOAT_BATCH(cosf_rn)
+FLOAT_BATCH(cosf_rd)
+FLOAT_BATCH(cosf_ru)
+FLOAT_BATCH(cosf_rz)
+#endif
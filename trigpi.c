@@ -29,6 +29,9 @@
 #include "crlibm_private.h"
 #include "triple-double.h"
 #include "trigpi.h"
+#ifdef BUILD_INTERVAL_FUNCTIONS
+#include "interval.h"
+#endif
  
 
 /*   TODO
@@ -380,13 +383,13 @@ void sinpiquick(double *rh, double *rm, double x, int index, int quadrant) {
      xh = (x-tt)+tt;
      xl = x-xh;   
      Add12(rh,rl, xh*PIHH, (xl*PIHH + xh*PIHM) + (xh*PIM + xl*PIHM) );               
-     if(rh == (rh + (rl * PIX_RNCST_SIN)))
+     if(QUICK_PHASE && rh == (rh + (rl * PIX_RNCST_SIN)))
        return rh;
    }
    /* Fall here either if we have a large input, or if we have a small
       input and the rounding test fails.  */
    sinpiquick(&rh, &rm,  y, index, quadrant);
-   if (rh==rh+1.00001*rm) /* See trigpiquick.gappa. This first step is ridiculously too accurate */
+   if (QUICK_PHASE && rh==rh+1.00001*rm) /* See trigpiquick.gappa. This first step is ridiculously too accurate */
      return rh;
    sinpi_accurate(&rh, &rm, &rl, y, index, quadrant);
    ReturnRoundToNearest3(rh,rm,rl);   
@@ -926,7 +929,7 @@ double cospi_rz(double x){
      xh = (x-tt)+tt;
      xl = x-xh;   
      Add12(rh,rl, xh*PIHH, (xl*PIHH + xh*PIHM) + (xh*PIM + xl*PIHM) );               
-     if(rh == (rh + (rl * PIX_RNCST_TAN)))
+     if(QUICK_PHASE && rh == (rh + (rl * PIX_RNCST_TAN)))
        return rh;
    }
    /* Fall here either if we have a large input, or if we have a small
@@ -1167,3 +1170,95 @@ double cospi_rz(double x){
 }; 
 
 
+
+
+#ifdef BUILD_INTERVAL_FUNCTIONS
+/* Index modulo 8 of the quarter period containing x, i.e. floor(2x)
+   mod 8, using the same exact argument reduction as above */
+static int trigpi_quarter(double x){
+  double xs, y, u, absx;
+  db_number xdb, t;
+  int32_t k;
+
+  xdb.d = x;
+  if ((xdb.i[HI] & 0x7fffffff) >= 0x43500000) /* 2^54: x is a multiple of 4 */
+    return 0;
+
+  if (x<0) absx = -x;   else absx = x;
+  xs = x*128.0;
+  if(absx > TWOTO42) {
+    t.d = xs;
+    t.i[LO] = 0; /* removes a multiple of 512, i.e. of 4 in x */
+    xs = xs-t.d;
+  }
+  t.d = TWOTO5251 + xs;
+  u = t.d - TWOTO5251;
+  y = xs - u;
+  k = t.i[LO];
+  return ((k>>6) - (((k&63) == 0) && (y < 0))) & 7;
+}
+
+
+/* Common part of j_sinpi and j_cospi. The period is 2, so that an
+   interval of width 3 or more always contains both extrema. */
+static interval sincospi_interval(double x_inf, double x_sup, int is_cos){
+  interval res;
+  double res_inf, res_sup, r1, r2;
+  int q_inf, q_sup, has_max, has_min, inc;
+  double (*f_rd)(double) = is_cos ? cospi_rd : sinpi_rd;
+  double (*f_ru)(double) = is_cos ? cospi_ru : sinpi_ru;
+
+  if (!(x_inf<=x_sup) || (x_inf == 1.0/0.0) || (x_sup == -1.0/0.0)) RETURN_EMPTY_INTERVAL;
+
+  if (!(x_sup - x_inf < 3.0)) {
+    ASSIGN_LOW(res,-1.0);
+    ASSIGN_UP(res,1.0);
+    return res;
+  }
+
+  q_inf = trigpi_quarter(x_inf);
+  q_sup = trigpi_quarter(x_sup);
+  SINE_EXTREMA(has_max, has_min, inc, q_inf, (q_sup - q_inf) & 7, is_cos);
+
+  if (has_max && has_min) {
+    res_inf = -1.0;
+    res_sup = 1.0;
+  }
+  else if (has_max) {
+    r1 = f_rd(x_inf);
+    r2 = f_rd(x_sup);
+    res_inf = (r1 < r2) ? r1 : r2;
+    res_sup = 1.0;
+  }
+  else if (has_min) {
+    r1 = f_ru(x_inf);
+    r2 = f_ru(x_sup);
+    res_inf = -1.0;
+    res_sup = (r1 > r2) ? r1 : r2;
+  }
+  else if (inc) {
+    res_inf = f_rd(x_inf);
+    res_sup = f_ru(x_sup);
+  }
+  else {
+    res_inf = f_rd(x_sup);
+    res_sup = f_ru(x_inf);
+  }
+
+  ASSIGN_LOW(res,res_inf);
+  ASSIGN_UP(res,res_sup);
+  return res;
+}
+
+
+interval j_sinpi(interval x)
+{
+  return sincospi_interval(LOW(x), UP(x), 0);
+}
+
+
+interval j_cospi(interval x)
+{
+  return sincospi_interval(LOW(x), UP(x), 1);
+}
+#endif /* BUILD_INTERVAL_FUNCTIONS */
@@ -11,6 +11,7 @@
 #include "scs_lib/scs.h"
 #include "scs_lib/scs_private.h"
 
+#ifdef HAVE_CONFIG_H
  /* undef all the variables that might have been defined in
     scs_lib/scs_private.h */
 #undef VERSION 
@@ -20,6 +21,8 @@
 #undef HAVE_MATHLIB_H
 /* then include the proper definitions  */
 #include "crlibm_config.h"
+#endif
+/* otherwise CMake is used, and defines all the useful variables using -D switch */
 
 #ifdef HAVE_INTTYPES_H
 #include <inttypes.h>
@@ -0,0 +1,426 @@
+/*
+ * Vector variants of the correctly rounded functions, following the
+ * x86-64 vector function ABI (the one used by glibc's libmvec)
+ *
+ * These are the functions a compiler calls when it vectorizes a loop
+ * which calls exp_rn etc, declared with #pragma omp declare simd in
+ * crlibm.h. For a function f, the variants are
+ *
+ *   _ZGVbN2v_f  two doubles in an xmm register     (SSE2)
+ *   _ZGVcN4v_f  four doubles in an ymm register    (AVX)
+ *   _ZGVdN4v_f  four doubles in an ymm register    (AVX2)
+ *   _ZGVeN8v_f  eight doubles in a zmm register    (AVX-512)
+ *
+ * They are all unmasked ("notinbranch"). Each function defines them in
+ * its own file with the macros below, out of a kernel written with the
+ * vector extensions of gcc: the quick phase is evaluated on the whole
+ * register, with straight-line code where the table lookups are the
+ * only per-lane operations, the rounding test gives a lane mask, and
+ * only the lanes which are special or fail the test go through the
+ * scalar function, hence the accurate phase.
+ *
+ * This file is part of the crlibm library developed by the Arenaire
+ * project at Ecole Normale Superieure de Lyon
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or 
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  
+ */
+
+#ifndef VECTOR_ABI_H
+#define VECTOR_ABI_H
+
+#ifdef BUILD_VECTOR_ABI  /* defined by configure, on x86-64 with gcc */
+
+#include <string.h>
+#include <emmintrin.h>
+#include "crlibm_private.h"
+
+/* The vector types of gcc: the usual arithmetic operators act
+   lane-wise, a comparison gives a lane mask of the integer vector type
+   of the same width (-1 for true, 0 for false), and a cast between
+   vector types of the same size copies the bits */
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef double v4df __attribute__ ((vector_size (32)));
+typedef double v8df __attribute__ ((vector_size (64)));
+typedef long long int v2di __attribute__ ((vector_size (16)));
+typedef long long int v4di __attribute__ ((vector_size (32)));
+typedef long long int v8di __attribute__ ((vector_size (64)));
+typedef float v4sf __attribute__ ((vector_size (16)));
+
+#define VECTOR_KERNEL static inline __attribute__ ((always_inline))
+
+/* For the loops over the lanes doing the table lookups: unrolled, they
+   assemble the vectors in registers, whereas a vector loaded from
+   memory just after the scalar stores of its lanes stalls */
+#if (__GNUC__ >= 8)
+#define VECTOR_UNROLL _Pragma("GCC unroll 8")
+#else
+#define VECTOR_UNROLL
+#endif
+
+/* A vector of type t with all its lanes equal to c */
+#define VSplat(t, c) (((t) {}) + (c))
+
+/* The lanes of a where the mask m is set, those of b elsewhere */
+#define VSelect(m, a, b) \
+  ((__typeof__(a)) ((((__typeof__(m)) (a)) & (m)) | (((__typeof__(m)) (b)) & ~(m))))
+
+#define VAbs(x, vl) \
+  ((__typeof__(x)) (((vl) (x)) & ULL(7fffffffffffffff)))
+
+/* The exact conversion of an integer vector to a double vector, for
+   lanes in [-2^51, 2^51], without the 64-bit conversion instruction
+   which AVX2 lacks */
+#define VToDouble(vd, i) \
+  (((vd) ((i) + ULL(4338000000000000))) - 6755399441055744.0)
+
+
+/* The double-double operators of crlibm_private.h on vectors, where
+   all the operands are vectors of the same type */
+
+#define VAdd12(s, r, a, b)                              \
+{ __typeof__(a) _z, _a=(a), _b=(b);                     \
+  (s) = _a + _b;                                        \
+  _z = (s) - _a;                                        \
+  (r) = _b - _z;                                        }
+
+#define VAdd12Cond(s, r, a, b)                          \
+{ __typeof__(a) _u1, _u2, _u3, _u4, _a=(a), _b=(b);     \
+  (s) = _a + _b;                                        \
+  _u1 = (s) - _a;                                       \
+  _u2 = (s) - _u1;                                      \
+  _u3 = _b - _u1;                                       \
+  _u4 = _a - _u2;                                       \
+  (r) = _u4 + _u3;                                      }
+
+#define VMul12(rh, rl, u, v)                            \
+{ __typeof__(u) _up, _u1, _u2, _vp, _v1, _v2, _u=(u), _v=(v); \
+  _up = _u * 134217729.;  _vp = _v * 134217729.;        \
+  _u1 = (_u - _up) + _up; _v1 = (_v - _vp) + _vp;       \
+  _u2 = _u - _u1;         _v2 = _v - _v1;               \
+  (rh) = _u * _v;                                       \
+  (rl) = (((_u1*_v1 - (rh)) + (_u1*_v2)) + (_u2*_v1)) + (_u2*_v2); }
+
+#define VMul22(zh, zl, xh, xl, yh, yl)                  \
+{ __typeof__(xh) _mh, _ml;                              \
+  VMul12(_mh, _ml, (xh), (yh));                         \
+  _ml += (xh)*(yl) + (xl)*(yh);                         \
+  (zh) = _mh + _ml;                                     \
+  (zl) = _mh - (zh) + _ml;                              }
+
+#define VAdd22(zh, zl, xh, xl, yh, yl)                  \
+{ __typeof__(xh) _r, _s;                                \
+  _r = (xh) + (yh);                                     \
+  _s = ((((xh) - _r) + (yh)) + (yl)) + (xl);            \
+  (zh) = _r + _s;                                       \
+  (zl) = (_r - (zh)) + _s;                              }
+
+#define VAdd22Cond(zh, zl, xh, xl, yh, yl)              \
+{ __typeof__(xh) _v1, _v2, _v3, _v4;                    \
+  VAdd12Cond(_v1, _v2, (xh), (yh));                     \
+  _v3 = (xl) + (yl);                                    \
+  _v4 = _v2 + _v3;                                      \
+  VAdd12((zh), (zl), _v1, _v4);                         }
+
+#define VDiv22(zh, zl, xh, xl, yh, yl)                  \
+{ __typeof__(xh) _ch, _cl, _uh, _ul;                    \
+  _ch = (xh) / (yh);                                    \
+  VMul12(_uh, _ul, _ch, (yh));                          \
+  _cl = (((((xh) - _uh) - _ul) + (xl)) - _ch*(yl)) / (yh); \
+  (zh) = _ch + _cl;                                     \
+  (zl) = (_ch - (zh)) + _cl;                            }
+
+
+/* A pseudo rounding mode for the interval functions: the even lanes
+   hold lower bounds, rounded down, and the odd lanes upper bounds,
+   rounded up, so that an interval {INF, SUP} is evaluated as one
+   vector of two doubles. It uses RDROUNDCST like the directed modes. */
+#define VECTOR_RDRU 4
+
+/* A second pseudo mode, for the thin intervals [x, x] of the interval
+   batches: x is evaluated once, and the kernel stores its value
+   rounded down in res[0..n-1] and rounded up in res[n..2n-1]. Where
+   the rounding test succeeds, the value is not a double, so that the
+   upper bound is the successor of the lower one (VNextUp). */
+#define VECTOR_THIN 5
+
+/* The successor of the nonzero doubles of the vector y: one more in
+   magnitude for a positive lane, one less for a negative one */
+#define VNextUp(y, vl) \
+  ((__typeof__(y)) (((vl) (y)) + (1 + 2*(((vl) (y)) < 0))))
+
+/* The vector {a, b} of two doubles, assembled in a register: gcc
+   builds (v2df) {a, b} by storing the lanes and loading the vector
+   back, which stalls like the table lookups above */
+#define VPair(a, b) \
+  ((v2df) _mm_unpacklo_pd(_mm_set_sd(a), _mm_set_sd(b)))
+
+/* The mask of the odd lanes of the mask type vl */
+#define VOddLanes(vl)                                                   \
+({ vl _m; int _l;                                                       \
+  for(_l=0; _l<(int) (sizeof(vl)/sizeof(long long int)); _l++)          \
+    _m[_l] = -(long long int) (_l & 1);                                 \
+  _m; })
+
+/* The rounding test of the quick phase on vectors: sets the lane mask
+   ok where yh+yl can be rounded in the given mode with the constant
+   cst (ROUNDCST in round to nearest, RDROUNDCST in the directed
+   modes), and in the directed modes replaces yh by its rounding, as
+   the TEST_AND_COPY_RU/RD/RZ macros do, without a branch. */
+#define VTestAndCopy(ok, yh, yl, cst, mode, vd, vl)                     \
+{ vl _yhl, _yh_neg, _yl_neg, _adjust;                                   \
+  vd _u53;                                                              \
+  if((mode)==CRLIBM_RN) {                                               \
+    (ok) = ((yh) == ((yh) + ((yl) * (cst))));                           \
+  }                                                                     \
+  else {                                                                \
+    _yhl = (vl) (yh);                                                   \
+    _yh_neg = (_yhl < 0);                                               \
+    _yl_neg = (((vl) (yl)) < 0);                                        \
+    _u53 = (vd) ((_yhl & ULL(7ff0000000000000)) + ULL(0010000000000000)); \
+    (ok) = (VAbs((yl), vl) > (cst) * _u53);                             \
+    if((mode)==CRLIBM_RU)        /* next up if yl>0 */                  \
+      _adjust = ~_yl_neg & (1 + 2*_yh_neg);                             \
+    else if((mode)==CRLIBM_RD                                           \
+            || (mode)==VECTOR_THIN) /* next down if yl<0 */             \
+      _adjust = _yl_neg & (-1 - 2*_yh_neg);                             \
+    else if((mode)==VECTOR_RDRU) /* down in even lanes, up in odd ones */ \
+      _adjust = VSelect(VOddLanes(vl),                                  \
+                        ~_yl_neg & (1 + 2*_yh_neg),                     \
+                        _yl_neg & (-1 - 2*_yh_neg));                    \
+    else                         /* toward zero if opposite signs */    \
+      _adjust = _yl_neg ^ _yh_neg;                                      \
+    (yh) = (vd) (_yhl + _adjust);                                       \
+  }                                                                     }
+
+
+/* TEST_AND_COPY_FLOAT of crlibm_private.h on a vector y of doubles,
+   sets the lane mask ok, and the vector r of floats of the same
+   number of lanes to the rounding of y (meaningless where the test
+   fails). The 64-bit integer comparisons and shifts are not in SSE2,
+   so that the test is expressed with double operations: y is split
+   into yf, its rounding to nearest on 24 bits (Veltkamp), and the
+   exact remainder d = y - yf; the ulp of y is ulpy = 2^e * 2^-52,
+   from the exponent bits 2^e of y. */
+#define VTestAndCopyFloat(ok, r, y, mode, vd, vl)                       \
+{ vd _c, _yf, _d, _ulpy, _ulpf, _absd;                                  \
+  _c = (y) * 536870913.0;  /* 2^29+1 */                                 \
+  _yf = _c - (_c - (y));                                                \
+  _d = (y) - _yf;                                                       \
+  _absd = VAbs(_d, vl);                                                 \
+  _ulpy = (vd) (((vl) (y)) & ULL(7ff0000000000000));                    \
+  (ok) = (_ulpy >= 0x1p-126) & (_ulpy < 0x1p127);                       \
+  _ulpy *= 0x1p-52;                                                     \
+  _ulpf = _ulpy * 0x1p29;                                               \
+  if((mode)==CRLIBM_RN)                                                 \
+    (ok) &= (_absd < (0x1p28 - FLOAT_ROUND_MARGIN) * _ulpy);            \
+  else {                                                                \
+    (ok) &= (_absd > FLOAT_ROUND_MARGIN * _ulpy);                       \
+    if((mode)==CRLIBM_RU)                                               \
+      _yf += VSelect(_d > 0, _ulpf, VSplat(vd, 0.0));                   \
+    else if((mode)==CRLIBM_RD)                                          \
+      _yf -= VSelect(_d < 0, _ulpf, VSplat(vd, 0.0));                   \
+    else                                                                \
+      _yf -= VSelect((_d < 0) ^ ((y) < 0), _ulpf, VSplat(vd, 0.0))      \
+        * VSelect((y) < 0, VSplat(vd, -1.0), VSplat(vd, 1.0));          \
+  }                                                                     \
+  (r) = __builtin_convertvector(_yf, __typeof__(r));                    \
+}
+
+/* The lane kernels of a function are written once, as a macro
+   KERNEL(name, vd, vl, n) defining 
+
+     VECTOR_KERNEL void name(double *res, const double *x, int mode)
+
+   for the vector type vd of n doubles and the mask type vl (a kernel
+   shared by several functions takes further constant arguments). It
+   computes the quick phase on the whole vector, then calls the scalar
+   function for the lanes which are special or fail the rounding test.
+   VECTOR_LANE_KERNELS instantiates it for the three widths, and
+   VECTOR_ABI_VARIANTS defines the exported functions, which call the
+   kernels with constant arguments (the rounding mode), so that their
+   dispatch compiles away. */
+
+#define VECTOR_LANE_KERNELS(KERNEL, name)                               \
+KERNEL(name##_2, v2df, v2di, 2)                                         \
+KERNEL(name##_4, v4df, v4di, 4)                                         \
+KERNEL(name##_8, v8df, v8di, 8)
+
+#define VECTOR_ABI_VARIANTS(f, name, ...)                               \
+v2df _ZGVbN2v_##f(v2df x);                                              \
+v2df _ZGVbN2v_##f(v2df x) {                                             \
+  v2df r;                                                               \
+  name##_2((double*) &r, (const double*) &x, __VA_ARGS__);              \
+  return r;                                                             \
+}                                                                       \
+__attribute__ ((target ("avx"))) v4df _ZGVcN4v_##f(v4df x);             \
+__attribute__ ((target ("avx"))) v4df _ZGVcN4v_##f(v4df x) {            \
+  v4df r;                                                               \
+  name##_4((double*) &r, (const double*) &x, __VA_ARGS__);              \
+  return r;                                                             \
+}                                                                       \
+__attribute__ ((target ("avx2"))) v4df _ZGVdN4v_##f(v4df x);            \
+__attribute__ ((target ("avx2"))) v4df _ZGVdN4v_##f(v4df x) {           \
+  v4df r;                                                               \
+  name##_4((double*) &r, (const double*) &x, __VA_ARGS__);              \
+  return r;                                                             \
+}                                                                       \
+__attribute__ ((target ("avx512f"))) v8df _ZGVeN8v_##f(v8df x);         \
+__attribute__ ((target ("avx512f"))) v8df _ZGVeN8v_##f(v8df x) {        \
+  v8df r;                                                               \
+  name##_8((double*) &r, (const double*) &x, __VA_ARGS__);              \
+  return r;                                                             \
+}
+
+
+/* The interval batches jf_batch(res_inf, res_sup, inf, sup, n) of
+   crlibm.h, on the kernels name_4. The intervals of a block are first
+   partitioned without a branch, as in log_batch: those for which
+   SPECIAL(inf, sup) holds go to the scalar jf; the thin ones [x, x]
+   are gathered and evaluated once, in the mode VECTOR_THIN; for the
+   others, the lower bounds are gathered and evaluated rounded down,
+   the upper bounds rounded up. The last vector of a list is completed
+   with copies of its first lane. */
+
+#define VECTOR_BATCH_BLOCK 256
+
+#define VECTOR_INTERVAL_BATCH(jf, name, SPECIAL)                        \
+void jf##_batch(double *res_inf, double *res_sup,                       \
+                const double *inf, const double *sup, int n) {          \
+  int special[VECTOR_BATCH_BLOCK], thin[VECTOR_BATCH_BLOCK], wide[VECTOR_BATCH_BLOCK]; \
+  double xl[VECTOR_BATCH_BLOCK+3], xu[VECTOR_BATCH_BLOCK+3];           \
+  double rl[VECTOR_BATCH_BLOCK+3], ru[VECTOR_BATCH_BLOCK+3], r[8];     \
+  interval x, y;                                                        \
+  int base, nb, nspecial, nthin, nwide, isspecial, isthin, i, j, l;     \
+                                                                        \
+  for(base=0; base<n; base+=VECTOR_BATCH_BLOCK) {                       \
+    nb = (n-base < VECTOR_BATCH_BLOCK) ? n-base : VECTOR_BATCH_BLOCK;   \
+    nspecial = 0;                                                       \
+    nthin = 0;                                                          \
+    nwide = 0;                                                          \
+    for(i=base; i<base+nb; i++) {                                       \
+      isspecial = SPECIAL(inf[i], sup[i]);                              \
+      isthin = !isspecial & (inf[i] == sup[i]);                         \
+      special[nspecial] = i;                                            \
+      thin[nthin] = i;                                                  \
+      wide[nwide] = i;                                                  \
+      nspecial += isspecial;                                            \
+      nthin += isthin;                                                  \
+      nwide += !isspecial & !isthin;                                    \
+    }                                                                   \
+                                                                        \
+    for(j=0; j<nspecial; j++) {                                         \
+      i = special[j];                                                   \
+      ASSIGN_LOW(x, inf[i]);                                            \
+      ASSIGN_UP(x, sup[i]);                                             \
+      y = jf(x);                                                        \
+      res_inf[i] = LOW(y);                                              \
+      res_sup[i] = UP(y);                                               \
+    }                                                                   \
+                                                                        \
+    for(j=0; j<nthin; j++)                                              \
+      xl[j] = inf[thin[j]];                                             \
+    for(; j&3; j++)                                                     \
+      xl[j] = xl[0];                                                    \
+    for(j=0; j<nthin; j+=4) {                                           \
+      name##_4(r, xl+j, VECTOR_THIN);                                   \
+      for(l=0; l<4; l++) {                                              \
+        rl[j+l] = r[l];                                                 \
+        ru[j+l] = r[4+l];                                               \
+      }                                                                 \
+    }                                                                   \
+    for(j=0; j<nthin; j++) {                                            \
+      res_inf[thin[j]] = rl[j];                                         \
+      res_sup[thin[j]] = ru[j];                                         \
+    }                                                                   \
+                                                                        \
+    for(j=0; j<nwide; j++) {                                            \
+      xl[j] = inf[wide[j]];                                             \
+      xu[j] = sup[wide[j]];                                             \
+    }                                                                   \
+    for(; j&3; j++) {                                                   \
+      xl[j] = xl[0];                                                    \
+      xu[j] = xu[0];                                                    \
+    }                                                                   \
+    for(j=0; j<nwide; j+=4) {                                           \
+      name##_4(rl+j, xl+j, CRLIBM_RD);                                  \
+      name##_4(ru+j, xu+j, CRLIBM_RU);                                  \
+    }                                                                   \
+    for(j=0; j<nwide; j++) {                                            \
+      res_inf[wide[j]] = rl[j];                                         \
+      res_sup[wide[j]] = ru[j];                                         \
+    }                                                                   \
+  }                                                                     \
+}
+
+
+/* The batches f_batch(res, x, n) of the binary32 functions of
+   crlibm.h (expf_rn etc), on a kernel 
+
+     VECTOR_KERNEL void name(v4df *res, const v4df *x)
+
+   which computes the approximation of f(x) of TEST_AND_COPY_FLOAT on
+   four floats converted to double (the vectors are passed by address,
+   as in the other kernels), with 0 in the lanes it does not handle. The rounding test and the rounding to float are
+   performed on the whole vector, and the lanes which fail the test go
+   through the scalar function f. The last vector is completed with
+   copies of x[0]. 
+
+   Four doubles fill an AVX register, but take two SSE2 ones, where
+   the table lookups and the lane masks cost more than the scalar
+   function: the vector loop is compiled for AVX2, and used only on
+   the processors which have it. */
+
+#define VECTOR_FLOAT_BATCH(f, name, mode)                               \
+__attribute__ ((target ("avx2")))                                       \
+static void f##_batch_avx2(float *res, const float *x, int n) {         \
+  float xl[4], rl[4];                                                   \
+  v4sf xv, r;                                                           \
+  v4df xd, y;                                                           \
+  v4di ok;                                                              \
+  int i, l;                                                             \
+                                                                        \
+  for(i=0; i<n; i+=4) {                                                 \
+    if(i+4 <= n)                                                        \
+      memcpy(&xv, x+i, sizeof(xv));                                     \
+    else {                                                              \
+      for(l=0; l<4; l++)                                                \
+        xl[l] = x[(i+l < n) ? i+l : 0];                                 \
+      memcpy(&xv, xl, sizeof(xv));                                      \
+    }                                                                   \
+    xd = __builtin_convertvector(xv, v4df);                             \
+    name(&y, &xd);                                                      \
+    VTestAndCopyFloat(ok, r, y, mode, v4df, v4di);                      \
+    if(i+4 <= n && (ok[0] & ok[1] & ok[2] & ok[3]))                     \
+      memcpy(res+i, &r, sizeof(r));                                     \
+    else {                                                              \
+      memcpy(rl, &r, sizeof(r));                                        \
+      for(l=0; l<4 && i+l<n; l++)                                       \
+        res[i+l] = ok[l] ? rl[l] : f(x[i+l]);                           \
+    }                                                                   \
+  }                                                                     \
+}                                                                       \
+                                                                        \
+void f##_batch(float *res, const float *x, int n) {                     \
+  int i;                                                                \
+  if(__builtin_cpu_supports("avx2"))                                    \
+    f##_batch_avx2(res, x, n);                                          \
+  else                                                                  \
+    for(i=0; i<n; i++)                                                  \
+      res[i] = f(x[i]);                                                 \
+}
+
+#endif /* BUILD_VECTOR_ABI */
+
+#endif /* VECTOR_ABI_H */